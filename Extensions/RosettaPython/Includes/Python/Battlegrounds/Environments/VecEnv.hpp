@@ -0,0 +1,14 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PYTHON_BATTLEGROUNDS_VEC_ENV_HPP
+#define ROSETTASTONE_PYTHON_BATTLEGROUNDS_VEC_ENV_HPP
+
+#include <pybind11/pybind11.h>
+
+void AddBattlegroundsVecEnv(pybind11::module& m);
+
+#endif  // ROSETTASTONE_PYTHON_BATTLEGROUNDS_VEC_ENV_HPP
@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+void AddBattlegroundsActionSpace(pybind11::module& m)
+{
+    pybind11::enum_<Battlegrounds::ActionType>(
+        m, "ActionType", R"pbdoc(The type of action.)pbdoc")
+        .value("SELECT_HERO", Battlegrounds::ActionType::SELECT_HERO)
+        .value("PURCHASE", Battlegrounds::ActionType::PURCHASE)
+        .value("PLAY_CARD", Battlegrounds::ActionType::PLAY_CARD)
+        .value("SELL", Battlegrounds::ActionType::SELL)
+        .value("REARRANGE", Battlegrounds::ActionType::REARRANGE)
+        .value("REFRESH", Battlegrounds::ActionType::REFRESH)
+        .value("UPGRADE", Battlegrounds::ActionType::UPGRADE)
+        .value("FREEZE", Battlegrounds::ActionType::FREEZE)
+        .value("END_RECRUIT", Battlegrounds::ActionType::END_RECRUIT);
+
+    pybind11::class_<ActionSpace>(
+        m, "ActionSpace",
+        R"pbdoc(This class defines a fixed discrete action space of a player
+        in Battlegrounds: select hero (index of hero choices), purchase
+        (Tavern position), play card (hand position x field position x
+        target), sell (field position), rearrange (current position x new
+        position), refresh, upgrade, freeze and end recruit.)pbdoc")
+        .def_readonly_static("size", &ActionSpace::SIZE)
+        .def_readonly_static("num_targets", &ActionSpace::NUM_TARGETS)
+        .def_readonly_static("select_hero_offset",
+                             &ActionSpace::SELECT_HERO_OFFSET)
+        .def_readonly_static("purchase_offset", &ActionSpace::PURCHASE_OFFSET)
+        .def_readonly_static("play_card_offset",
+                             &ActionSpace::PLAY_CARD_OFFSET)
+        .def_readonly_static("sell_offset", &ActionSpace::SELL_OFFSET)
+        .def_readonly_static("rearrange_offset",
+                             &ActionSpace::REARRANGE_OFFSET)
+        .def_readonly_static("refresh", &ActionSpace::REFRESH)
+        .def_readonly_static("upgrade", &ActionSpace::UPGRADE)
+        .def_readonly_static("freeze", &ActionSpace::FREEZE)
+        .def_readonly_static("end_recruit", &ActionSpace::END_RECRUIT)
+        .def_static("select_hero_action", &ActionSpace::SelectHeroAction,
+                    R"pbdoc(Returns the select hero action.
+
+                    Parameters
+                    ----------
+                    idx : The index of hero choices.)pbdoc",
+                    pybind11::arg("idx"))
+        .def_static("purchase_action", &ActionSpace::PurchaseAction,
+                    R"pbdoc(Returns the purchase action.
+
+                    Parameters
+                    ----------
+                    tavern_pos : The position of minion in Tavern.)pbdoc",
+                    pybind11::arg("tavern_pos"))
+        .def_static("play_card_action", &ActionSpace::PlayCardAction,
+                    R"pbdoc(Returns the play card action.
+
+                    Parameters
+                    ----------
+                    hand_pos : The position of card in hand.
+                    field_pos : The position of minion to place on the field.
+                    target : The index of target: 0 for no target and i + 1
+                    for the minion at position i of the field.)pbdoc",
+                    pybind11::arg("hand_pos"), pybind11::arg("field_pos"),
+                    pybind11::arg("target") = 0)
+        .def_static("sell_action", &ActionSpace::SellAction,
+                    R"pbdoc(Returns the sell action.
+
+                    Parameters
+                    ----------
+                    field_pos : The position of minion on the field.)pbdoc",
+                    pybind11::arg("field_pos"))
+        .def_static("rearrange_action", &ActionSpace::RearrangeAction,
+                    R"pbdoc(Returns the rearrange action.
+
+                    Parameters
+                    ----------
+                    cur_pos : The current position of minion.
+                    new_pos : The new position of minion.)pbdoc",
+                    pybind11::arg("cur_pos"), pybind11::arg("new_pos"))
+        .def_static("action_type", &ActionSpace::GetActionType,
+                    R"pbdoc(Returns the type of action.
+
+                    Parameters
+                    ----------
+                    action : The action.)pbdoc",
+                    pybind11::arg("action"));
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Battlegrounds/Environments/VecEnv.hpp>
+#include <Rosetta/Battlegrounds/Environments/VecEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+//! Returns a NumPy view of the buffer of \p self without copying it.
+//! The view keeps \p self alive while it is used.
+template <typename T>
+pybind11::array_t<T> MakeView(pybind11::object& self, T* data,
+                              std::vector<pybind11::ssize_t> shape)
+{
+    return pybind11::array_t<T>(shape, data, self);
+}
+
+pybind11::ssize_t GetNumLobbies(const VecEnv& env)
+{
+    return static_cast<pybind11::ssize_t>(env.GetNumLobbies());
+}
+
+pybind11::array_t<float> GetObservations(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(
+        self, env.GetObservations(),
+        { GetNumLobbies(env), VecEnv::NUM_PLAYERS, VecEnv::OBSERVATION_SIZE });
+}
+
+pybind11::array_t<float> GetRewards(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(self, env.GetRewards(),
+                    { GetNumLobbies(env), VecEnv::NUM_PLAYERS });
+}
+
+pybind11::array_t<bool> GetDones(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(self, reinterpret_cast<bool*>(env.GetDones()),
+                    { GetNumLobbies(env) });
+}
+
+pybind11::array_t<bool> GetActionMasks(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(
+        self, reinterpret_cast<bool*>(env.GetActionMasks()),
+        { GetNumLobbies(env), VecEnv::NUM_PLAYERS, VecEnv::ACTION_SIZE });
+}
+}  // namespace
+
+void AddBattlegroundsVecEnv(pybind11::module& m)
+{
+    pybind11::class_<VecEnv>(
+        m, "VecEnv",
+        R"pbdoc(This class owns a number of 8-player lobbies and steps all of
+        them in parallel on C++ threads. Every player is an agent, so a step
+        takes an action for each player of each lobby. Finished lobbies are
+        reset automatically.
+
+        A player that is ready, defeated or out of actions in the phase has
+        only end_recruit in its action mask. A player gets a reward when its
+        rank is decided: 1 for the first place and -1 for the last place.
+
+        Observations, rewards, dones and action masks are NumPy views of
+        buffers owned by the environment. They are overwritten by the next
+        call of reset() or step(), so copy them to keep them.)pbdoc")
+        .def(pybind11::init<ThreadPool&, std::size_t, std::uint64_t>(),
+             R"pbdoc(Constructs vectorized environment.
+
+             Parameters
+             ----------
+             pool : The thread pool to step lobbies.
+             num_lobbies : The number of lobbies.
+             seed : The base seed.)pbdoc",
+             pybind11::arg("pool"), pybind11::arg("num_lobbies"),
+             pybind11::arg("seed") = 0, pybind11::keep_alive<1, 2>())
+        .def_readonly_static("num_players", &VecEnv::NUM_PLAYERS)
+        .def_readonly_static("observation_size", &VecEnv::OBSERVATION_SIZE)
+        .def_readonly_static("action_size", &VecEnv::ACTION_SIZE)
+        .def_readonly_static("max_num_rounds", &VecEnv::MAX_NUM_ROUNDS)
+        .def("num_lobbies", &VecEnv::GetNumLobbies,
+             R"pbdoc(Returns the number of lobbies.)pbdoc")
+        .def("round", &VecEnv::GetRound,
+             R"pbdoc(Returns the number of the current round of the lobby at
+             idx. Round 0 is select hero phase.
+
+             Parameters
+             ----------
+             idx : The index of lobby.)pbdoc",
+             pybind11::arg("idx"))
+        .def(
+            "reset",
+            [](pybind11::object self) {
+                auto& env = self.cast<VecEnv&>();
+
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Reset();
+                }
+
+                return GetObservations(self);
+            },
+            R"pbdoc(Resets all lobbies and returns the observations.)pbdoc")
+        .def(
+            "step",
+            [](pybind11::object self,
+               const pybind11::array_t<int, pybind11::array::c_style |
+                                                pybind11::array::forcecast>&
+                   actions) {
+                auto& env = self.cast<VecEnv&>();
+                const std::vector<int> actionList(
+                    actions.data(), actions.data() + actions.size());
+
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Step(actionList);
+                }
+
+                return pybind11::make_tuple(
+                    GetObservations(self), GetRewards(self), GetDones(self),
+                    GetActionMasks(self));
+            },
+            R"pbdoc(Processes the actions of all players of each lobby.
+
+            It returns observations, rewards, dones and action masks.
+
+            Parameters
+            ----------
+            actions : An array of action indices (num_lobbies x
+            num_players).)pbdoc",
+            pybind11::arg("actions"))
+        .def_property_readonly("observations", &GetObservations,
+                               R"pbdoc(The observations of players.)pbdoc")
+        .def_property_readonly("rewards", &GetRewards,
+                               R"pbdoc(The rewards of the last step.)pbdoc")
+        .def_property_readonly("dones", &GetDones,
+                               R"pbdoc(The dones of the last step.)pbdoc")
+        .def_property_readonly("action_masks", &GetActionMasks,
+                               R"pbdoc(The masks of valid actions.)pbdoc");
+}
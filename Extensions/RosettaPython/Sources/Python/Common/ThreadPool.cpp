@@ -0,0 +1,29 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Common/ThreadPool.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace RosettaStone;
+
+void AddThreadPool(pybind11::module& m)
+{
+    pybind11::class_<ThreadPool>(
+        m, "ThreadPool",
+        R"pbdoc(This class runs jobs on a fixed number of threads.)pbdoc")
+        .def(pybind11::init<std::size_t>(),
+             R"pbdoc(Constructs thread pool with given number of threads.
+
+             Parameters
+             ----------
+             num_threads : The number of threads including the calling
+             thread. If it is 0, the number of hardware threads is used.)pbdoc",
+             pybind11::arg("num_threads") = 0)
+        .def("num_threads", &ThreadPool::GetNumThreads,
+             R"pbdoc(Returns the number of threads.)pbdoc");
+}
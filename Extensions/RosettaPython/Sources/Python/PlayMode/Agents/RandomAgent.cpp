@@ -0,0 +1,54 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+void AddRandomAgent(pybind11::module& m)
+{
+    pybind11::class_<RandomAgent>(
+        m, "RandomAgent",
+        R"pbdoc(This class plays games by choosing a random valid task.)pbdoc")
+        .def_static("get_valid_tasks", &RandomAgent::GetValidTasks,
+                    R"pbdoc(Returns a list of valid tasks of the player.
+
+                    Parameters
+                    ----------
+                    player : The player to get valid tasks.)pbdoc",
+                    pybind11::arg("player"))
+        .def_static("get_random_task", &RandomAgent::GetRandomTask,
+                    R"pbdoc(Returns a random task among valid tasks.
+
+                    Parameters
+                    ----------
+                    player : The player to get a random task.)pbdoc",
+                    pybind11::arg("player"))
+        .def_static("process_mulligan", &RandomAgent::ProcessMulligan,
+                    R"pbdoc(Processes mulligan of both players if the game
+                    waits for it.
+
+                    Parameters
+                    ----------
+                    game : The game to process mulligan.)pbdoc",
+                    pybind11::arg("game"),
+                    pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def_static("play_game", &RandomAgent::PlayGame,
+                    R"pbdoc(Plays the game until it is over with random tasks.
+
+                    It returns the play state of player 1.
+
+                    Parameters
+                    ----------
+                    game : The game to play.)pbdoc",
+                    pybind11::arg("game"),
+                    pybind11::call_guard<pybind11::gil_scoped_release>());
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Cards/CardFeatures.hpp>
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+struct CardFeaturesWrapper
+{
+    //! Returns a read-only NumPy view of the matrix without copying it.
+    //! The features live until the end of the program, so the view has an
+    //! empty capsule as its base.
+    static pybind11::array_t<std::int32_t> GetData()
+    {
+        const CardFeatures& features = CardFeatures::GetInstance();
+        const pybind11::capsule base(features.GetData(), [](void*) {});
+
+        pybind11::array_t<std::int32_t> data(
+            { static_cast<pybind11::ssize_t>(features.GetNumCards()),
+              static_cast<pybind11::ssize_t>(CardFeatures::NUM_FEATURES) },
+            features.GetData(), base);
+        pybind11::detail::array_proxy(data.ptr())->flags &=
+            ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+        return data;
+    }
+
+    static std::size_t GetNumCards()
+    {
+        return CardFeatures::GetInstance().GetNumCards();
+    }
+
+    static std::vector<std::string> GetIDs()
+    {
+        const CardFeatures& features = CardFeatures::GetInstance();
+        std::vector<std::string> ids;
+        ids.reserve(features.GetNumCards());
+
+        for (std::size_t i = 0; i < features.GetNumCards(); ++i)
+        {
+            ids.emplace_back(features.GetCard(i)->id);
+        }
+
+        return ids;
+    }
+
+    static Card* GetCard(std::size_t index)
+    {
+        return CardFeatures::GetInstance().GetCard(index);
+    }
+
+    static std::size_t GetIndexByDbfID(int dbfID)
+    {
+        return CardFeatures::GetInstance().GetIndexByDbfID(dbfID);
+    }
+
+    static std::size_t GetIndexByID(const std::string& id)
+    {
+        return CardFeatures::GetInstance().GetIndexByID(id);
+    }
+
+    static void Save(const std::string& path)
+    {
+        const CardFeatures& features = CardFeatures::GetInstance();
+        pybind11::gil_scoped_release release;
+        features.Save(path);
+    }
+
+    static std::vector<GameTag> GetKeywords()
+    {
+        return { CardFeatures::KEYWORDS.begin(),
+                 CardFeatures::KEYWORDS.end() };
+    }
+};
+}  // namespace
+
+void AddCardFeatures(pybind11::module& m)
+{
+    pybind11::class_<CardFeaturesWrapper>(
+        m, "CardFeatures",
+        R"pbdoc(This class exports all cards as a matrix of int32 features.
+        Row i is the card at index i, sorted by dbfID, and the columns are
+        dbf_id, cost, attack, health, card_type, card_class, race, rarity,
+        card_set and keyword_bits.)pbdoc")
+        .def_readonly_static("dbf_id", &CardFeatures::DBF_ID)
+        .def_readonly_static("cost", &CardFeatures::COST)
+        .def_readonly_static("attack", &CardFeatures::ATTACK)
+        .def_readonly_static("health", &CardFeatures::HEALTH)
+        .def_readonly_static("card_type", &CardFeatures::CARD_TYPE)
+        .def_readonly_static("card_class", &CardFeatures::CARD_CLASS)
+        .def_readonly_static("race", &CardFeatures::RACE)
+        .def_readonly_static("rarity", &CardFeatures::RARITY)
+        .def_readonly_static("card_set", &CardFeatures::CARD_SET)
+        .def_readonly_static("keyword_bits", &CardFeatures::KEYWORD_BITS)
+        .def_readonly_static("num_features", &CardFeatures::NUM_FEATURES)
+        .def_readonly_static("header_size", &CardFeatures::HEADER_SIZE)
+        .def_static("keywords", &CardFeaturesWrapper::GetKeywords,
+                    R"pbdoc(Returns the game tags of keyword bits.)pbdoc")
+        .def_static("data", &CardFeaturesWrapper::GetData,
+                    R"pbdoc(Returns a read-only view of the matrix of
+                    features without copying it.)pbdoc")
+        .def_static("num_cards", &CardFeaturesWrapper::GetNumCards,
+                    R"pbdoc(Returns the number of cards.)pbdoc")
+        .def_static("ids", &CardFeaturesWrapper::GetIDs,
+                    R"pbdoc(Returns the IDs of cards in order of index.)pbdoc")
+        .def_static("card", &CardFeaturesWrapper::GetCard,
+                    R"pbdoc(Returns the card at index.
+
+                    Parameters
+                    ----------
+                    index : The index of the card.)pbdoc",
+                    pybind11::return_value_policy::reference,
+                    pybind11::arg("index"))
+        .def_static("index_by_dbf_id", &CardFeaturesWrapper::GetIndexByDbfID,
+                    R"pbdoc(Returns the index of the card that has dbf_id.
+
+                    Parameters
+                    ----------
+                    dbf_id : The dbfID of the card.)pbdoc",
+                    pybind11::arg("dbf_id"))
+        .def_static("index_by_id", &CardFeaturesWrapper::GetIndexByID,
+                    R"pbdoc(Returns the index of the card that has id.
+
+                    Parameters
+                    ----------
+                    id : The ID of the card.)pbdoc",
+                    pybind11::arg("id"))
+        .def_static("save", &CardFeaturesWrapper::Save,
+                    R"pbdoc(Writes a header of header_size bytes and the
+                    matrix of features to path. The matrix can be mapped with
+                    numpy.memmap(path, dtype=numpy.int32, offset=header_size).
+
+                    Parameters
+                    ----------
+                    path : The path of the file to write.)pbdoc",
+                    pybind11::arg("path"));
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+void AddActionSpace(pybind11::module& m)
+{
+    pybind11::enum_<ActionType>(m, "ActionType",
+                                R"pbdoc(The type of action.)pbdoc")
+        .value("PLAY_CARD", ActionType::PLAY_CARD)
+        .value("ATTACK", ActionType::ATTACK)
+        .value("HERO_POWER", ActionType::HERO_POWER)
+        .value("CHOOSE", ActionType::CHOOSE)
+        .value("END_TURN", ActionType::END_TURN);
+
+    pybind11::class_<ActionSpace>(
+        m, "ActionSpace",
+        R"pbdoc(This class defines a fixed discrete action space of a player:
+        play card (hand position x target x field position x choose one),
+        attack (attacker x defender), hero power (target), choose (index of
+        choice) and end turn.)pbdoc")
+        .def_readonly_static("size", &ActionSpace::SIZE)
+        .def_readonly_static("num_targets", &ActionSpace::NUM_TARGETS)
+        .def_readonly_static("num_choose_ones", &ActionSpace::NUM_CHOOSE_ONES)
+        .def_readonly_static("num_characters", &ActionSpace::NUM_CHARACTERS)
+        .def_readonly_static("num_choices", &ActionSpace::NUM_CHOICES)
+        .def_readonly_static("play_card_offset",
+                             &ActionSpace::PLAY_CARD_OFFSET)
+        .def_readonly_static("attack_offset", &ActionSpace::ATTACK_OFFSET)
+        .def_readonly_static("hero_power_offset",
+                             &ActionSpace::HERO_POWER_OFFSET)
+        .def_readonly_static("choose_offset", &ActionSpace::CHOOSE_OFFSET)
+        .def_readonly_static("end_turn", &ActionSpace::END_TURN)
+        .def_static("play_card_action", &ActionSpace::PlayCardAction,
+                    R"pbdoc(Returns the play card action.
+
+                    Parameters
+                    ----------
+                    hand_pos : The position of card in hand.
+                    target : The index of target.
+                    field_pos : The position of minion to place on the field.
+                    choose_one : The index of chosen card from two cards.)pbdoc",
+                    pybind11::arg("hand_pos"), pybind11::arg("target"),
+                    pybind11::arg("field_pos") = 0,
+                    pybind11::arg("choose_one") = 0)
+        .def_static("attack_action", &ActionSpace::AttackAction,
+                    R"pbdoc(Returns the attack action.
+
+                    Parameters
+                    ----------
+                    attacker : The index of attacker.
+                    defender : The index of defender.)pbdoc",
+                    pybind11::arg("attacker"), pybind11::arg("defender"))
+        .def_static("hero_power_action", &ActionSpace::HeroPowerAction,
+                    R"pbdoc(Returns the hero power action.
+
+                    Parameters
+                    ----------
+                    target : The index of target.)pbdoc",
+                    pybind11::arg("target"))
+        .def_static("choose_action", &ActionSpace::ChooseAction,
+                    R"pbdoc(Returns the choose action.
+
+                    Parameters
+                    ----------
+                    choice : The index of choice.)pbdoc",
+                    pybind11::arg("choice"))
+        .def_static("action_type", &ActionSpace::GetActionType,
+                    R"pbdoc(Returns the type of action.
+
+                    Parameters
+                    ----------
+                    action : The action.)pbdoc",
+                    pybind11::arg("action"))
+        .def_static(
+            "action_mask",
+            [](Player& player) {
+                pybind11::array_t<bool> mask(
+                    static_cast<pybind11::ssize_t>(ActionSpace::SIZE));
+                auto* buffer = reinterpret_cast<std::uint8_t*>(
+                    mask.mutable_data());
+
+                {
+                    pybind11::gil_scoped_release release;
+                    ActionSpace::GetActionMask(player, buffer);
+                }
+
+                return mask;
+            },
+            R"pbdoc(Returns the mask of legal actions of the player.
+
+            Parameters
+            ----------
+            player : The player to act.)pbdoc",
+            pybind11::arg("player"))
+        .def_static("decode", &ActionSpace::Decode,
+                    R"pbdoc(Returns the task of action.
+
+                    Parameters
+                    ----------
+                    player : The player to act.
+                    action : The action.)pbdoc",
+                    pybind11::arg("player"), pybind11::arg("action"));
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+void AddDeltaEncoder(pybind11::module& m)
+{
+    pybind11::class_<DeltaEncoder>(
+        m, "DeltaEncoder",
+        R"pbdoc(This class encodes a game with the layout of
+        ObservationEncoder, but re-encodes only the slots that changed since
+        the previous call into the same array.)pbdoc")
+        .def(pybind11::init<PlayerType, bool>(),
+             R"pbdoc(Constructs delta encoder.
+
+             Parameters
+             ----------
+             player_type : The type of the player to observe the game.
+             is_filtered : Whether to hide unknown opponent cards.)pbdoc",
+             pybind11::arg("player_type"), pybind11::arg("is_filtered") = true)
+        .def("reset", &DeltaEncoder::Reset,
+             R"pbdoc(Forgets the previous encoding, so the next call writes
+             all values.)pbdoc")
+        .def(
+            "encode",
+            [](DeltaEncoder& self, const Game& game, pybind11::array out) {
+                if (!out.writeable() ||
+                    !(out.flags() & pybind11::array::c_style) ||
+                    static_cast<std::size_t>(out.size()) <
+                        ObservationEncoder::SIZE)
+                {
+                    throw std::invalid_argument(
+                        "encode() - out must be a writable C-contiguous array "
+                        "that has at least ObservationEncoder.size values!");
+                }
+
+                if (out.dtype().is(pybind11::dtype::of<float>()))
+                {
+                    auto* buffer = static_cast<float*>(out.mutable_data());
+                    pybind11::gil_scoped_release release;
+                    self.Encode(game, buffer);
+                }
+                else if (out.dtype().is(pybind11::dtype::of<std::int32_t>()))
+                {
+                    auto* buffer =
+                        static_cast<std::int32_t*>(out.mutable_data());
+                    pybind11::gil_scoped_release release;
+                    self.Encode(game, buffer);
+                }
+                else
+                {
+                    throw std::invalid_argument(
+                        "encode() - The dtype of out must be float32 or "
+                        "int32!");
+                }
+
+                return self.GetChangedRanges();
+            },
+            R"pbdoc(Re-encodes the changed slots of the game into out and
+            returns the list of changed ranges as (start, stop) tuples.
+
+            Parameters
+            ----------
+            game : The game to encode.
+            out : A writable C-contiguous array of float32 or int32 that
+                holds the result of the previous call.)pbdoc",
+            pybind11::arg("game"), pybind11::arg("out"))
+        .def("changed_ranges", &DeltaEncoder::GetChangedRanges,
+             R"pbdoc(Returns the ranges of values that the last encode
+             wrote.)pbdoc");
+}
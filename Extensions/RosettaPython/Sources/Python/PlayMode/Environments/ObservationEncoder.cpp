@@ -0,0 +1,110 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Encodes \p game into \p out without copying. \p out should be a writable
+//! C-contiguous array of float32 or int32 that has at least SIZE values.
+void EncodeInto(const Game& game, PlayerType playerType, pybind11::array& out,
+                bool isFiltered)
+{
+    if (!out.writeable() ||
+        !(out.flags() & pybind11::array::c_style) ||
+        static_cast<std::size_t>(out.size()) < ObservationEncoder::SIZE)
+    {
+        throw std::invalid_argument(
+            "encode() - out must be a writable C-contiguous array that has "
+            "at least ObservationEncoder.size values!");
+    }
+
+    if (out.dtype().is(pybind11::dtype::of<float>()))
+    {
+        auto* buffer = static_cast<float*>(out.mutable_data());
+        pybind11::gil_scoped_release release;
+        ObservationEncoder::Encode(game, playerType, buffer, isFiltered);
+    }
+    else if (out.dtype().is(pybind11::dtype::of<std::int32_t>()))
+    {
+        auto* buffer = static_cast<std::int32_t*>(out.mutable_data());
+        pybind11::gil_scoped_release release;
+        ObservationEncoder::Encode(game, playerType, buffer, isFiltered);
+    }
+    else
+    {
+        throw std::invalid_argument(
+            "encode() - The dtype of out must be float32 or int32!");
+    }
+}
+}  // namespace
+
+void AddObservationEncoder(pybind11::module& m)
+{
+    pybind11::class_<ObservationEncoder>(
+        m, "ObservationEncoder",
+        R"pbdoc(This class encodes a game from the perspective of a player
+        into a tensor with a fixed layout: global values, the block of the
+        player and the block of the opponent.)pbdoc")
+        .def_readonly_static("size", &ObservationEncoder::SIZE)
+        .def_readonly_static("global_size", &ObservationEncoder::GLOBAL_SIZE)
+        .def_readonly_static("hero_size", &ObservationEncoder::HERO_SIZE)
+        .def_readonly_static("minion_size", &ObservationEncoder::MINION_SIZE)
+        .def_readonly_static("hand_card_size",
+                             &ObservationEncoder::HAND_CARD_SIZE)
+        .def_readonly_static("secret_size", &ObservationEncoder::SECRET_SIZE)
+        .def_readonly_static("field_offset",
+                             &ObservationEncoder::FIELD_OFFSET)
+        .def_readonly_static("hand_offset", &ObservationEncoder::HAND_OFFSET)
+        .def_readonly_static("secret_offset",
+                             &ObservationEncoder::SECRET_OFFSET)
+        .def_readonly_static("player_size", &ObservationEncoder::PLAYER_SIZE)
+        .def_static(
+            "encode",
+            [](const Game& game, PlayerType playerType, pybind11::array out,
+               bool isFiltered) {
+                EncodeInto(game, playerType, out, isFiltered);
+                return out;
+            },
+            R"pbdoc(Encodes the game into out without copying and returns it.
+
+            Parameters
+            ----------
+            game : The game to encode.
+            player_type : The type of the player to observe the game.
+            out : A writable C-contiguous array of float32 or int32.
+            is_filtered : Whether to hide unknown cards of the opponent.)pbdoc",
+            pybind11::arg("game"), pybind11::arg("player_type"),
+            pybind11::arg("out"), pybind11::arg("is_filtered") = true)
+        .def_static(
+            "encode",
+            [](const Game& game, PlayerType playerType, bool isFiltered) {
+                pybind11::array out = pybind11::array_t<float>(
+                    static_cast<pybind11::ssize_t>(ObservationEncoder::SIZE));
+                EncodeInto(game, playerType, out, isFiltered);
+                return out;
+            },
+            R"pbdoc(Encodes the game into a new float32 array.
+
+            Parameters
+            ----------
+            game : The game to encode.
+            player_type : The type of the player to observe the game.
+            is_filtered : Whether to hide unknown cards of the opponent.)pbdoc",
+            pybind11::arg("game"), pybind11::arg("player_type"),
+            pybind11::arg("is_filtered") = true);
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryReader.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Returns a read-only NumPy view of a column of the mapped file.
+//! The view keeps \p self alive while it is used.
+template <typename T>
+pybind11::array_t<T> MakeView(const pybind11::object& self, const T* data,
+                              std::vector<pybind11::ssize_t> shape)
+{
+    pybind11::array_t<T> view(shape, data, self);
+    pybind11::detail::array_proxy(view.ptr())->flags &=
+        ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+    return view;
+}
+
+pybind11::dict GetChunk(const pybind11::object& self, std::size_t idx)
+{
+    const auto& reader = self.cast<const TrajectoryReader&>();
+    const TrajectoryShape& shape = reader.GetShape();
+    const TrajectoryChunk chunk = reader.GetChunk(idx);
+
+    const auto numSteps = static_cast<pybind11::ssize_t>(chunk.numSteps);
+    const auto getSize = [](std::size_t size) {
+        return static_cast<pybind11::ssize_t>(size);
+    };
+
+    pybind11::dict result;
+    result["observations"] =
+        MakeView(self, chunk.observations,
+                 { numSteps, getSize(shape.observationSize) });
+    result["actions"] = MakeView(self, chunk.actions, { numSteps });
+    result["masks"] = MakeView(
+        self, reinterpret_cast<const bool*>(chunk.masks),
+        { numSteps, getSize(shape.actionSize) });
+    result["rewards"] = MakeView(self, chunk.rewards, { numSteps });
+    result["dones"] =
+        MakeView(self, reinterpret_cast<const bool*>(chunk.dones),
+                 { numSteps });
+    result["stats"] =
+        MakeView(self, chunk.stats, { numSteps, getSize(shape.numStats) });
+
+    return result;
+}
+}  // namespace
+
+void AddTrajectoryReader(pybind11::module& m)
+{
+    pybind11::class_<TrajectoryReader>(
+        m, "TrajectoryReader",
+        R"pbdoc(This class memory-maps a trajectory file written by
+        TrajectoryWriter. The columns of chunks are read-only NumPy views of
+        the mapped file, so reading them doesn't copy data.)pbdoc")
+        .def(pybind11::init<const std::string&>(),
+             R"pbdoc(Constructs trajectory reader.
+
+             Parameters
+             ----------
+             path : The path of file to read.)pbdoc",
+             pybind11::arg("path"))
+        .def(
+            "observation_size",
+            [](const TrajectoryReader& reader) {
+                return reader.GetShape().observationSize;
+            },
+            R"pbdoc(Returns the number of values of an observation.)pbdoc")
+        .def(
+            "action_size",
+            [](const TrajectoryReader& reader) {
+                return reader.GetShape().actionSize;
+            },
+            R"pbdoc(Returns the number of values of an action mask.)pbdoc")
+        .def(
+            "num_stats",
+            [](const TrajectoryReader& reader) {
+                return reader.GetShape().numStats;
+            },
+            R"pbdoc(Returns the number of policy stats of a step.)pbdoc")
+        .def("chunk_size", &TrajectoryReader::GetChunkSize,
+             R"pbdoc(Returns the number of steps per chunk.)pbdoc")
+        .def("num_chunks", &TrajectoryReader::GetNumChunks,
+             R"pbdoc(Returns the number of chunks.)pbdoc")
+        .def("num_steps", &TrajectoryReader::GetNumSteps,
+             R"pbdoc(Returns the number of steps of all chunks.)pbdoc")
+        .def("chunk", &GetChunk,
+             R"pbdoc(Returns a dict of the columns of the chunk at idx:
+             observations, actions, masks, rewards, dones and stats.
+
+             Parameters
+             ----------
+             idx : The index of chunk.)pbdoc",
+             pybind11::arg("idx"));
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryWriter.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+template <typename T>
+using Array =
+    pybind11::array_t<T, pybind11::array::c_style | pybind11::array::forcecast>;
+
+void Append(TrajectoryWriter& writer, const Array<float>& observations,
+            const Array<std::int32_t>& actions,
+            const Array<std::uint8_t>& masks, const Array<float>& rewards,
+            const Array<std::uint8_t>& dones,
+            const std::optional<Array<float>>& stats)
+{
+    const TrajectoryShape& shape = writer.GetShape();
+    const auto numSteps = static_cast<std::size_t>(actions.size());
+
+    const auto hasSize = [](const pybind11::array& array, std::size_t size) {
+        return static_cast<std::size_t>(array.size()) == size;
+    };
+
+    if (!hasSize(observations, numSteps * shape.observationSize) ||
+        !hasSize(masks, numSteps * shape.actionSize) ||
+        !hasSize(rewards, numSteps) || !hasSize(dones, numSteps) ||
+        (stats.has_value() && !hasSize(*stats, numSteps * shape.numStats)))
+    {
+        throw std::invalid_argument(
+            "TrajectoryWriter.append() - The sizes of arrays don't match the "
+            "number of actions!");
+    }
+
+    pybind11::gil_scoped_release release;
+    writer.Append(numSteps, observations.data(), actions.data(), masks.data(),
+                  rewards.data(), dones.data(),
+                  stats.has_value() ? stats->data() : nullptr);
+}
+}  // namespace
+
+void AddTrajectoryWriter(pybind11::module& m)
+{
+    pybind11::class_<TrajectoryWriter>(
+        m, "TrajectoryWriter",
+        R"pbdoc(This class appends steps of (observation, action, action mask,
+        reward, done, policy stats) to a chunked columnar trajectory file.
+        Full chunks are written by a background thread, so append() only
+        copies the steps. Use it as a context manager or call close() to
+        write the index.)pbdoc")
+        .def(pybind11::init([](const std::string& path,
+                               std::size_t observationSize,
+                               std::size_t actionSize, std::size_t numStats,
+                               std::size_t chunkSize,
+                               std::size_t maxPendingChunks) {
+                 return std::make_unique<TrajectoryWriter>(
+                     path,
+                     TrajectoryShape{ observationSize, actionSize, numStats },
+                     chunkSize, maxPendingChunks);
+             }),
+             R"pbdoc(Constructs trajectory writer. It creates a new file or
+             truncates an existing file.
+
+             Parameters
+             ----------
+             path : The path of file to write.
+             observation_size : The number of values of an observation.
+             action_size : The number of values of an action mask.
+             num_stats : The number of policy stats of a step.
+             chunk_size : The number of steps per chunk.
+             max_pending_chunks : The maximum number of full chunks that are
+             not written yet. append() waits while it is reached.)pbdoc",
+             pybind11::arg("path"), pybind11::arg("observation_size"),
+             pybind11::arg("action_size"), pybind11::arg("num_stats") = 0,
+             pybind11::arg("chunk_size") = 4096,
+             pybind11::arg("max_pending_chunks") = 4)
+        .def("append", &Append,
+             R"pbdoc(Appends steps. The first dimension of each array is the
+             number of steps.
+
+             Parameters
+             ----------
+             observations : The observations (n x observation_size).
+             actions : The actions (n).
+             masks : The action masks (n x action_size).
+             rewards : The rewards (n).
+             dones : The dones (n).
+             stats : The policy stats (n x num_stats) or None for zeros.)pbdoc",
+             pybind11::arg("observations"), pybind11::arg("actions"),
+             pybind11::arg("masks"), pybind11::arg("rewards"),
+             pybind11::arg("dones"), pybind11::arg("stats") = pybind11::none())
+        .def("flush", &TrajectoryWriter::Flush,
+             R"pbdoc(Writes the steps appended so far and waits until they
+             are written.)pbdoc",
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("close", &TrajectoryWriter::Close,
+             R"pbdoc(Writes the index and closes the file.)pbdoc",
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("num_steps", &TrajectoryWriter::GetNumSteps,
+             R"pbdoc(Returns the number of steps appended so far.)pbdoc")
+        .def("__enter__",
+             [](TrajectoryWriter& writer) -> TrajectoryWriter& {
+                 return writer;
+             },
+             pybind11::return_value_policy::reference)
+        .def(
+            "__exit__",
+            [](TrajectoryWriter& writer, const pybind11::object&,
+               const pybind11::object&, const pybind11::object&) {
+                pybind11::gil_scoped_release release;
+                writer.Close();
+            });
+}
@@ -0,0 +1,176 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Environments/VecEnv.hpp>
+#include <Rosetta/PlayMode/Environments/VecEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <optional>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Returns a NumPy view of the buffer of \p self without copying it.
+//! The view keeps \p self alive while it is used.
+template <typename T>
+pybind11::array_t<T> MakeView(pybind11::object& self, T* data,
+                              std::vector<pybind11::ssize_t> shape)
+{
+    return pybind11::array_t<T>(shape, data, self);
+}
+
+pybind11::array_t<float> GetObservations(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(self, env.GetObservations(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()),
+                      static_cast<pybind11::ssize_t>(
+                          VecEnv::OBSERVATION_SIZE) });
+}
+
+pybind11::array_t<float> GetRewards(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(self, env.GetRewards(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()) });
+}
+
+pybind11::array_t<bool> GetDones(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(self, reinterpret_cast<bool*>(env.GetDones()),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()) });
+}
+
+pybind11::array_t<bool> GetActionMasks(pybind11::object self)
+{
+    auto& env = self.cast<VecEnv&>();
+    return MakeView(
+        self, reinterpret_cast<bool*>(env.GetActionMasks()),
+        { static_cast<pybind11::ssize_t>(env.GetNumEnvs()),
+          static_cast<pybind11::ssize_t>(VecEnv::ACTION_SIZE) });
+}
+}  // namespace
+
+void AddVecEnv(pybind11::module& m)
+{
+    pybind11::class_<VecEnv>(
+        m, "VecEnv",
+        R"pbdoc(This class owns a number of games and steps all of them in
+        parallel on C++ threads. The agent plays player 1 and a random agent
+        plays player 2. Finished games are reset automatically.
+
+        Observations, rewards, dones and action masks are NumPy views of
+        buffers owned by the environment. They are overwritten by the next
+        call of reset() or step(), so copy them to keep them.)pbdoc")
+        .def(pybind11::init<ThreadPool&, const GameConfig&, std::size_t,
+                            std::uint64_t>(),
+             R"pbdoc(Constructs vectorized environment.
+
+             Parameters
+             ----------
+             pool : The thread pool to step games.
+             game_config : The game config to create games.
+             num_envs : The number of games.
+             seed : The base seed.)pbdoc",
+             pybind11::arg("pool"), pybind11::arg("game_config"),
+             pybind11::arg("num_envs"), pybind11::arg("seed") = 0,
+             pybind11::keep_alive<1, 2>())
+        .def_readonly_static("observation_size", &VecEnv::OBSERVATION_SIZE)
+        .def_readonly_static("action_size", &VecEnv::ACTION_SIZE)
+        .def("num_envs", &VecEnv::GetNumEnvs,
+             R"pbdoc(Returns the number of games.)pbdoc")
+        .def("game", &VecEnv::GetGame,
+             R"pbdoc(Returns the game at idx.
+
+             Parameters
+             ----------
+             idx : The index of game.)pbdoc",
+             pybind11::arg("idx"),
+             pybind11::return_value_policy::reference_internal)
+        .def(
+            "reset",
+            [](pybind11::object self) {
+                auto& env = self.cast<VecEnv&>();
+
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Reset();
+                }
+
+                return GetObservations(self);
+            },
+            R"pbdoc(Resets all games and returns the observations.)pbdoc")
+        .def(
+            "step",
+            [](pybind11::object self,
+               const pybind11::array_t<int, pybind11::array::c_style |
+                                                pybind11::array::forcecast>&
+                   actions,
+               TrajectoryWriter* writer,
+               const std::optional<pybind11::array_t<
+                   float, pybind11::array::c_style |
+                              pybind11::array::forcecast>>& stats) {
+                auto& env = self.cast<VecEnv&>();
+                const std::vector<int> actionList(
+                    actions.data(), actions.data() + actions.size());
+
+                if (stats.has_value() &&
+                    (writer == nullptr ||
+                     static_cast<std::size_t>(stats->size()) !=
+                         env.GetNumEnvs() * writer->GetShape().numStats))
+                {
+                    throw std::invalid_argument(
+                        "VecEnv.step() - The stats need a writer and must "
+                        "have num_envs x num_stats values!");
+                }
+
+                {
+                    pybind11::gil_scoped_release release;
+                    if (writer == nullptr)
+                    {
+                        env.Step(actionList);
+                    }
+                    else
+                    {
+                        env.Step(actionList, *writer,
+                                 stats.has_value() ? stats->data() : nullptr);
+                    }
+                }
+
+                return pybind11::make_tuple(
+                    GetObservations(self), GetRewards(self), GetDones(self),
+                    GetActionMasks(self));
+            },
+            R"pbdoc(Processes the action of each game.
+
+            It returns observations, rewards, dones and action masks. If a
+            writer is given, each step is appended to it with the
+            observation and the action mask that the action was chosen with.
+
+            Parameters
+            ----------
+            actions : An array of action indices of all games.
+            writer : The TrajectoryWriter to record steps or None.
+            stats : The policy stats of actions (num_envs x num_stats) or
+            None.)pbdoc",
+            pybind11::arg("actions"), pybind11::arg("writer") = nullptr,
+            pybind11::arg("stats") = pybind11::none())
+        .def_property_readonly("observations", &GetObservations,
+                               R"pbdoc(The observations of games.)pbdoc")
+        .def_property_readonly("rewards", &GetRewards,
+                               R"pbdoc(The rewards of the last step.)pbdoc")
+        .def_property_readonly("dones", &GetDones,
+                               R"pbdoc(The dones of the last step.)pbdoc")
+        .def_property_readonly("action_masks", &GetActionMasks,
+                               R"pbdoc(The masks of valid actions.)pbdoc");
+}
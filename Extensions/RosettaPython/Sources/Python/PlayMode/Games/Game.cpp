@@ -0,0 +1,150 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Managers/GameManager.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+#include <Rosetta/PlayMode/Utils/DeckCode.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+std::unique_ptr<Game> MakeGame(const std::string& deckCode1,
+                               const std::string& deckCode2,
+                               PlayerType startPlayer, bool skipMulligan,
+                               FormatType formatType)
+{
+    GameConfig config = MatchSimulator::MakeGameConfig(
+        DeckCode::Decode(deckCode1), DeckCode::Decode(deckCode2), formatType);
+    config.startPlayer = startPlayer;
+    config.skipMulligan = skipMulligan;
+
+    return std::make_unique<Game>(config);
+}
+
+std::tuple<PlayState, PlayState> Process(Game& game, Player& player,
+                                         ITask& task)
+{
+    auto result = game.Process(&player, std::move(task));
+
+    // NOTE: ChooseTask only marks the mulligan of the player as done, so
+    // advance to the main phase when both players have finished it.
+    if (game.step == Step::BEGIN_MULLIGAN &&
+        game.GetPlayer1()->mulliganState == Mulligan::DONE &&
+        game.GetPlayer2()->mulliganState == Mulligan::DONE)
+    {
+        game.nextStep = Step::MAIN_BEGIN;
+        GameManager::ProcessNextStep(game, game.nextStep);
+        result = { game.GetPlayer1()->playState,
+                   game.GetPlayer2()->playState };
+    }
+
+    return result;
+}
+
+int GetReward(const Game& game, PlayerType playerType)
+{
+    const Player* player = playerType == PlayerType::PLAYER1
+                               ? game.GetPlayer1()
+                               : game.GetPlayer2();
+
+    switch (player->playState)
+    {
+        case PlayState::WON:
+            return 1;
+        case PlayState::LOST:
+        case PlayState::CONCEDED:
+            return -1;
+        default:
+            return 0;
+    }
+}
+}  // namespace
+
+void AddGame(pybind11::module& m)
+{
+    pybind11::class_<Game>(
+        m, "Game",
+        R"pbdoc(This class stores Hearthstone game state such as players,
+        turn and step. It also processes tasks of players.)pbdoc")
+        .def(pybind11::init<const GameConfig&>(),
+             R"pbdoc(Constructs game with given game config.
+
+             Parameters
+             ----------
+             game_config : The game config holds all configuration values.)pbdoc",
+             pybind11::arg("game_config"))
+        .def_static("from_deck_codes", &MakeGame,
+                    R"pbdoc(Constructs game with given deck codes.
+
+                    Parameters
+                    ----------
+                    deck_code1 : The deck code of player 1.
+                    deck_code2 : The deck code of player 2.
+                    start_player : The player who goes first.
+                    skip_mulligan : Skips the mulligan step.
+                    format_type : The format type of the game.)pbdoc",
+                    pybind11::arg("deck_code1"), pybind11::arg("deck_code2"),
+                    pybind11::arg("start_player") = PlayerType::RANDOM,
+                    pybind11::arg("skip_mulligan") = true,
+                    pybind11::arg("format_type") = FormatType::STANDARD)
+        .def("start", &Game::Start,
+             R"pbdoc(Starts the game.)pbdoc",
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("process", &Process,
+             R"pbdoc(Processes the task of the player.
+
+             If both players have finished the mulligan, the game proceeds
+             to the main phase. It returns the play states of player 1 and
+             player 2.
+
+             Parameters
+             ----------
+             player : The player to run task.
+             task : The task to process.)pbdoc",
+             pybind11::arg("player"), pybind11::arg("task"),
+             pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("player1", pybind11::overload_cast<>(&Game::GetPlayer1),
+             R"pbdoc(Returns the first player.)pbdoc",
+             pybind11::return_value_policy::reference_internal)
+        .def("player2", pybind11::overload_cast<>(&Game::GetPlayer2),
+             R"pbdoc(Returns the second player.)pbdoc",
+             pybind11::return_value_policy::reference_internal)
+        .def("current_player",
+             pybind11::overload_cast<>(&Game::GetCurrentPlayer),
+             R"pbdoc(Returns the player controlling the current turn.)pbdoc",
+             pybind11::return_value_policy::reference_internal)
+        .def("opponent_player",
+             pybind11::overload_cast<>(&Game::GetOpponentPlayer),
+             R"pbdoc(Returns the opponent player.)pbdoc",
+             pybind11::return_value_policy::reference_internal)
+        .def("turn", &Game::GetTurn, R"pbdoc(Returns the turn of the game.)pbdoc")
+        .def("format_type", &Game::GetFormatType,
+             R"pbdoc(Returns the format type of the game.)pbdoc")
+        .def_readonly("state", &Game::state,
+                      R"pbdoc(The state of the game.)pbdoc")
+        .def_readonly("step", &Game::step, R"pbdoc(The step of the game.)pbdoc")
+        .def(
+            "is_done",
+            [](const Game& game) { return game.state == State::COMPLETE; },
+            R"pbdoc(Returns true if the game is over.)pbdoc")
+        .def("reward", &GetReward,
+             R"pbdoc(Returns the reward of the player.
+
+             It returns 1 if the player won, -1 if the player lost and 0
+             otherwise.
+
+             Parameters
+             ----------
+             player_type : The type of the player.)pbdoc",
+             pybind11::arg("player_type"));
+}
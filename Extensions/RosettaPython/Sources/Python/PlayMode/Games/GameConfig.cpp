@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+#include <Rosetta/PlayMode/Utils/DeckCode.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+void SetDeck(std::array<Card*, START_DECK_SIZE>& deck, const DeckInfo& info)
+{
+    const auto cards = info.GetPrimitiveDeck();
+
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        deck[i] = i < cards.size() ? cards[i] : nullptr;
+    }
+}
+}  // namespace
+
+void AddGameConfig(pybind11::module& m)
+{
+    pybind11::class_<GameConfig>(
+        m, "GameConfig",
+        R"pbdoc(This struct holds all configuration values of the game.)pbdoc")
+        .def(pybind11::init<>(), R"pbdoc(Default constructor.)pbdoc")
+        .def_static(
+            "from_deck_codes",
+            [](const std::string& deckCode1, const std::string& deckCode2,
+               FormatType formatType) {
+                return MatchSimulator::MakeGameConfig(
+                    DeckCode::Decode(deckCode1), DeckCode::Decode(deckCode2),
+                    formatType);
+            },
+            R"pbdoc(Makes a game config from two deck codes.
+
+            The first player is chosen randomly, decks are shuffled and
+            mulligan is skipped.
+
+            Parameters
+            ----------
+            deck_code1 : The deck code of player 1.
+            deck_code2 : The deck code of player 2.
+            format_type : The format type of the game.)pbdoc",
+            pybind11::arg("deck_code1"), pybind11::arg("deck_code2"),
+            pybind11::arg("format_type") = FormatType::STANDARD)
+        .def_readwrite("format_type", &GameConfig::formatType,
+                       R"pbdoc(The format type of the game.)pbdoc")
+        .def_readwrite("start_player", &GameConfig::startPlayer,
+                       R"pbdoc(The player who goes first.)pbdoc")
+        .def_readwrite("player1_class", &GameConfig::player1Class,
+                       R"pbdoc(The class of player 1.)pbdoc")
+        .def_readwrite("player2_class", &GameConfig::player2Class,
+                       R"pbdoc(The class of player 2.)pbdoc")
+        .def_readwrite("do_fill_decks", &GameConfig::doFillDecks,
+                       R"pbdoc(Fills decks with default cards.)pbdoc")
+        .def_readwrite("do_shuffle", &GameConfig::doShuffle,
+                       R"pbdoc(Shuffles decks when the game starts.)pbdoc")
+        .def_readwrite("skip_mulligan", &GameConfig::skipMulligan,
+                       R"pbdoc(Skips the mulligan step.)pbdoc")
+        .def_readwrite("auto_run", &GameConfig::autoRun,
+                       R"pbdoc(Runs steps of the game automatically.)pbdoc")
+        .def(
+            "set_player1_deck",
+            [](GameConfig& config, const DeckInfo& deck) {
+                config.player1Class = deck.GetClass();
+                SetDeck(config.player1Deck, deck);
+            },
+            R"pbdoc(Sets the deck and the class of player 1.
+
+            Parameters
+            ----------
+            deck : The deck of player 1.)pbdoc",
+            pybind11::arg("deck"))
+        .def(
+            "set_player2_deck",
+            [](GameConfig& config, const DeckInfo& deck) {
+                config.player2Class = deck.GetClass();
+                SetDeck(config.player2Deck, deck);
+            },
+            R"pbdoc(Sets the deck and the class of player 2.
+
+            Parameters
+            ----------
+            deck : The deck of player 2.)pbdoc",
+            pybind11::arg("deck"));
+}
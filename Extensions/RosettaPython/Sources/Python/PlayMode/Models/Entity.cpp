@@ -0,0 +1,104 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Models/Entity.hpp>
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/HeroPower.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Models/Spell.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+// NOTE: All entities are owned by the game, so Python never deletes them.
+template <typename T>
+using EntityHolder = std::unique_ptr<T, pybind11::nodelete>;
+}  // namespace
+
+void AddEntity(pybind11::module& m)
+{
+    pybind11::class_<Entity, EntityHolder<Entity>>(
+        m, "Entity", R"pbdoc(This is the base class of all in-game entities.)pbdoc")
+        .def(
+            "id",
+            [](const Entity& entity) {
+                return entity.GetGameTag(GameTag::ENTITY_ID);
+            },
+            R"pbdoc(Returns the ID of entity.)pbdoc")
+        .def(
+            "card", [](const Entity& entity) { return entity.card; },
+            R"pbdoc(Returns the card of entity.)pbdoc",
+            pybind11::return_value_policy::reference)
+        .def("game_tag", &Entity::GetGameTag,
+             R"pbdoc(Returns the value of game tag.
+
+             Parameters
+             ----------
+             tag : The game tag of card.)pbdoc",
+             pybind11::arg("tag"));
+
+    pybind11::class_<Playable, Entity, EntityHolder<Playable>>(
+        m, "Playable",
+        R"pbdoc(This is the base class of all entities that can be played.)pbdoc")
+        .def("cost", &Playable::GetCost,
+             R"pbdoc(Returns the value of cost.)pbdoc")
+        .def("zone_position", &Playable::GetZonePosition,
+             R"pbdoc(Returns the position of the zone.)pbdoc");
+
+    pybind11::class_<Character, Playable, EntityHolder<Character>>(
+        m, "Character",
+        R"pbdoc(This is the base class of hero and minion.)pbdoc")
+        .def("attack", &Character::GetAttack,
+             R"pbdoc(Returns the value of attack.)pbdoc")
+        .def("health", &Character::GetHealth,
+             R"pbdoc(Returns the value of health.)pbdoc")
+        .def("base_health", &Character::GetBaseHealth,
+             R"pbdoc(Returns the value of base health.)pbdoc")
+        .def("can_attack", &Character::CanAttack,
+             R"pbdoc(Returns whether the character can attack.)pbdoc")
+        .def("has_stealth", &Character::HasStealth,
+             R"pbdoc(Returns whether the character has stealth.)pbdoc")
+        .def("has_windfury", &Character::HasWindfury,
+             R"pbdoc(Returns whether the character has windfury.)pbdoc");
+
+    pybind11::class_<Minion, Character, EntityHolder<Minion>>(
+        m, "Minion", R"pbdoc(This class represents minion.)pbdoc")
+        .def("has_charge", &Minion::HasCharge,
+             R"pbdoc(Returns whether the minion has charge.)pbdoc")
+        .def("has_taunt", &Minion::HasTaunt,
+             R"pbdoc(Returns whether the minion has taunt.)pbdoc")
+        .def("has_divine_shield", &Minion::HasDivineShield,
+             R"pbdoc(Returns whether the minion has divine shield.)pbdoc")
+        .def("has_poisonous", &Minion::HasPoisonous,
+             R"pbdoc(Returns whether the minion has poisonous.)pbdoc");
+
+    pybind11::class_<Hero, Character, EntityHolder<Hero>>(
+        m, "Hero", R"pbdoc(This class represents hero.)pbdoc")
+        .def("armor", &Hero::GetArmor,
+             R"pbdoc(Returns the value of armor.)pbdoc");
+
+    pybind11::class_<HeroPower, Playable, EntityHolder<HeroPower>>(
+        m, "HeroPower", R"pbdoc(This class represents hero power.)pbdoc");
+
+    pybind11::class_<Weapon, Playable, EntityHolder<Weapon>>(
+        m, "Weapon", R"pbdoc(This class represents weapon.)pbdoc")
+        .def("attack", &Weapon::GetAttack,
+             R"pbdoc(Returns the value of attack.)pbdoc")
+        .def("durability", &Weapon::GetDurability,
+             R"pbdoc(Returns the value of durability.)pbdoc");
+
+    pybind11::class_<Spell, Playable, EntityHolder<Spell>>(
+        m, "Spell", R"pbdoc(This class represents spell.)pbdoc")
+        .def("is_secret", &Spell::IsSecret,
+             R"pbdoc(Returns whether the spell is secret.)pbdoc");
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/HeroPower.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/GraveyardZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+void AddPlayer(pybind11::module& m)
+{
+    // NOTE: Players are owned by the game, so Python never deletes them.
+    pybind11::class_<Player, std::unique_ptr<Player, pybind11::nodelete>>(
+        m, "Player",
+        R"pbdoc(This class stores information of the player such as hero,
+        zones and mana.)pbdoc")
+        .def_readonly("player_type", &Player::playerType,
+                      R"pbdoc(The type of the player.)pbdoc")
+        .def_readonly("play_state", &Player::playState,
+                      R"pbdoc(The play state of the player.)pbdoc")
+        .def_readonly("mulligan_state", &Player::mulliganState,
+                      R"pbdoc(The mulligan state of the player.)pbdoc")
+        .def(
+            "opponent", [](const Player& player) { return player.opponent; },
+            R"pbdoc(Returns the opponent player.)pbdoc",
+            pybind11::return_value_policy::reference)
+        .def("field_zone", &Player::GetFieldZone,
+             R"pbdoc(Returns the field zone.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("deck_zone", &Player::GetDeckZone,
+             R"pbdoc(Returns the deck zone.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("graveyard_zone", &Player::GetGraveyardZone,
+             R"pbdoc(Returns the graveyard zone.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("hand_zone", &Player::GetHandZone,
+             R"pbdoc(Returns the hand zone.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("secret_zone", &Player::GetSecretZone,
+             R"pbdoc(Returns the secret zone.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("hero", &Player::GetHero, R"pbdoc(Returns the hero.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def("hero_power", &Player::GetHeroPower,
+             R"pbdoc(Returns the hero power.)pbdoc",
+             pybind11::return_value_policy::reference)
+        .def(
+            "weapon",
+            [](const Player& player) -> Weapon* {
+                return player.GetHero()->HasWeapon() ? &player.GetWeapon()
+                                                     : nullptr;
+            },
+            R"pbdoc(Returns the weapon or None if the hero has no weapon.)pbdoc",
+            pybind11::return_value_policy::reference)
+        .def("total_mana", &Player::GetTotalMana,
+             R"pbdoc(Returns the amount of total mana.)pbdoc")
+        .def("used_mana", &Player::GetUsedMana,
+             R"pbdoc(Returns the amount of used mana.)pbdoc")
+        .def("temporary_mana", &Player::GetTemporaryMana,
+             R"pbdoc(Returns the amount of temporary mana.)pbdoc")
+        .def("remaining_mana", &Player::GetRemainingMana,
+             R"pbdoc(Returns the amount of remaining mana.)pbdoc")
+        .def("overload_owed", &Player::GetOverloadOwed,
+             R"pbdoc(Returns the amount of overload owed.)pbdoc")
+        .def("overload_locked", &Player::GetOverloadLocked,
+             R"pbdoc(Returns the amount of overload locked.)pbdoc")
+        .def(
+            "choice_type",
+            [](const Player& player) {
+                return player.choice != nullptr ? player.choice->choiceType
+                                                : ChoiceType::INVALID;
+            },
+            R"pbdoc(Returns the type of the pending choice.)pbdoc")
+        .def(
+            "choices",
+            [](const Player& player) {
+                return player.choice != nullptr ? player.choice->choices
+                                                : std::vector<int>{};
+            },
+            R"pbdoc(Returns a list of entity IDs of the pending choice.)pbdoc");
+}
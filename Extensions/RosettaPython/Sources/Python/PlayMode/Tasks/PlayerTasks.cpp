@@ -0,0 +1,92 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Tasks/PlayerTasks.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/ChooseTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/PlayCardTask.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace PlayerTasks;
+
+void AddPlayerTasks(pybind11::module& m)
+{
+    pybind11::class_<ITask>(
+        m, "ITask",
+        R"pbdoc(This is the base class of all tasks. A task is processed
+        by Game.process().)pbdoc");
+
+    pybind11::class_<AttackTask, ITask>(
+        m, "AttackTask", R"pbdoc(This class represents attack.)pbdoc")
+        .def(pybind11::init<Entity*, Playable*>(),
+             R"pbdoc(Constructs task with given source and target.
+
+             Parameters
+             ----------
+             source : A pointer to source character.
+             target : A pointer to target character.)pbdoc",
+             pybind11::arg("source"), pybind11::arg("target"));
+
+    pybind11::class_<PlayCardTask, ITask>(
+        m, "PlayCardTask",
+        R"pbdoc(This class represents playing a card.)pbdoc")
+        .def(pybind11::init<Entity*, Playable*, int, int>(),
+             R"pbdoc(Constructs task with given source, target, field
+             position and choose one.
+
+             Parameters
+             ----------
+             source : A pointer to card in hand.
+             target : A pointer to target or None.
+             field_pos : The position of minion to place on the field.
+             choose_one : The index of chosen card from two cards.)pbdoc",
+             pybind11::arg("source"), pybind11::arg("target") = nullptr,
+             pybind11::arg("field_pos") = -1,
+             pybind11::arg("choose_one") = 0);
+
+    pybind11::class_<HeroPowerTask, ITask>(
+        m, "HeroPowerTask",
+        R"pbdoc(This class represents using hero power.)pbdoc")
+        .def(pybind11::init<Playable*>(),
+             R"pbdoc(Constructs task with given target.
+
+             Parameters
+             ----------
+             target : A pointer to target or None.)pbdoc",
+             pybind11::arg("target") = nullptr);
+
+    pybind11::class_<EndTurnTask, ITask>(
+        m, "EndTurnTask", R"pbdoc(This class represents ending turn.)pbdoc")
+        .def(pybind11::init<>(), R"pbdoc(Default constructor.)pbdoc");
+
+    pybind11::class_<ChooseTask, ITask>(
+        m, "ChooseTask",
+        R"pbdoc(This class represents choosing cards of mulligan or
+        discover.)pbdoc")
+        .def_static("mulligan", &ChooseTask::Mulligan,
+                    R"pbdoc(Makes a task to keep cards in the mulligan.
+
+                    Parameters
+                    ----------
+                    player : The player to choose cards.
+                    choices : A list of entity IDs of cards to keep.)pbdoc",
+                    pybind11::arg("player"), pybind11::arg("choices"))
+        .def_static("pick", &ChooseTask::Pick,
+                    R"pbdoc(Makes a task to pick a card.
+
+                    Parameters
+                    ----------
+                    player : The player to choose a card.
+                    choice : The entity ID of card to pick.)pbdoc",
+                    pybind11::arg("player"), pybind11::arg("choice"));
+}
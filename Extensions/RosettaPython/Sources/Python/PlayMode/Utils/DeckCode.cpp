@@ -7,13 +7,123 @@
 #include <Python/PlayMode/Utils/DeckCode.hpp>
 #include <Rosetta/PlayMode/Utils/DeckCode.hpp>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
-using namespace RosettaStone::PlayMode;
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+using IntArray =
+    pybind11::array_t<std::int32_t, pybind11::array::c_style |
+                                        pybind11::array::forcecast>;
+
+//! Moves \p values into a NumPy array without copying them.
+//! The array owns the values through a capsule as its base.
+pybind11::array_t<std::int32_t> ToArray(std::vector<std::int32_t>&& values,
+                                        std::vector<pybind11::ssize_t> shape)
+{
+    auto* data = new std::vector<std::int32_t>(std::move(values));
+    const pybind11::capsule base(data, [](void* ptr) {
+        delete static_cast<std::vector<std::int32_t>*>(ptr);
+    });
+
+    return pybind11::array_t<std::int32_t>(shape, data->data(), base);
+}
+
+pybind11::dict DecodeBatch(ThreadPool& pool, const pybind11::iterable& codes)
+{
+    // NOTE: The objects keep the strings alive while the views are used.
+    std::vector<pybind11::object> objects;
+    std::vector<std::string_view> deckCodes;
+
+    for (const auto& code : codes)
+    {
+        objects.emplace_back(pybind11::reinterpret_borrow<pybind11::object>(
+            code));
+        deckCodes.emplace_back(objects.back().cast<std::string_view>());
+    }
+
+    DeckCodeBatch batch;
+    {
+        pybind11::gil_scoped_release release;
+        batch = DeckCode::DecodeBatch(pool, deckCodes);
+    }
+
+    const auto numRows = static_cast<pybind11::ssize_t>(batch.size);
+    const auto maxCards =
+        static_cast<pybind11::ssize_t>(DeckCodeBatch::MAX_CARDS);
+
+    pybind11::dict result;
+    result["heroes"] = ToArray(std::move(batch.heroes), { numRows });
+    result["formats"] = ToArray(std::move(batch.formats), { numRows });
+    result["errors"] = ToArray(std::move(batch.errors), { numRows });
+    result["dbf_ids"] =
+        ToArray(std::move(batch.dbfIDs), { numRows, maxCards });
+    result["counts"] = ToArray(std::move(batch.counts), { numRows, maxCards });
+
+    return result;
+}
+
+std::vector<std::string> EncodeBatch(ThreadPool& pool,
+                                     const IntArray& heroes,
+                                     const IntArray& formats,
+                                     const IntArray& dbfIDs,
+                                     const IntArray& counts)
+{
+    constexpr std::size_t MAX_CARDS = DeckCodeBatch::MAX_CARDS;
+
+    const auto numRows = static_cast<std::size_t>(heroes.size());
+    if (heroes.ndim() != 1 || formats.ndim() != 1 ||
+        static_cast<std::size_t>(formats.size()) != numRows ||
+        dbfIDs.ndim() != 2 || counts.ndim() != 2 ||
+        static_cast<std::size_t>(dbfIDs.shape(0)) != numRows ||
+        static_cast<std::size_t>(dbfIDs.shape(1)) != MAX_CARDS ||
+        static_cast<std::size_t>(counts.shape(0)) != numRows ||
+        static_cast<std::size_t>(counts.shape(1)) != MAX_CARDS)
+    {
+        throw std::invalid_argument(
+            "DeckCode.encode_batch() - Arrays must have shapes (n,), (n,), "
+            "(n, max_cards) and (n, max_cards)");
+    }
+
+    DeckCodeBatch batch(numRows);
+    std::copy_n(heroes.data(), numRows, batch.heroes.data());
+    std::copy_n(formats.data(), numRows, batch.formats.data());
+    std::copy_n(dbfIDs.data(), numRows * MAX_CARDS, batch.dbfIDs.data());
+    std::copy_n(counts.data(), numRows * MAX_CARDS, batch.counts.data());
+
+    pybind11::gil_scoped_release release;
+    return DeckCode::EncodeBatch(pool, batch);
+}
+}  // namespace
 
 void AddDeckCode(pybind11::module& m)
 {
+    pybind11::enum_<DeckCodeError>(
+        m, "DeckCodeError",
+        R"pbdoc(The result of decoding a deck code.)pbdoc")
+        .value("NONE", DeckCodeError::NONE)
+        .value("INVALID_BASE64", DeckCodeError::INVALID_BASE64)
+        .value("UNEXPECTED_EOF", DeckCodeError::UNEXPECTED_EOF)
+        .value("INVALID_DECK_CODE", DeckCodeError::INVALID_DECK_CODE)
+        .value("VERSION_MISMATCH", DeckCodeError::VERSION_MISMATCH)
+        .value("INVALID_FORMAT", DeckCodeError::INVALID_FORMAT)
+        .value("INVALID_HERO_COUNT", DeckCodeError::INVALID_HERO_COUNT)
+        .value("INVALID_HERO", DeckCodeError::INVALID_HERO)
+        .value("INVALID_CARD", DeckCodeError::INVALID_CARD)
+        .value("TOO_MANY_CARDS", DeckCodeError::TOO_MANY_CARDS);
+
     pybind11::class_<DeckCode>(m, "DeckCode")
+        .def_readonly_static("max_cards", &DeckCodeBatch::MAX_CARDS)
         .def_static(
             "decode", &DeckCode::Decode,
             R"pbdoc(Decodes a deck code and returns the deck that contains some cards.
@@ -21,5 +131,32 @@ void AddDeckCode(pybind11::module& m)
             Parameters
             ----------
             deck_code : The deck code generated by Hearthstone.)pbdoc",
-            pybind11::arg("deck_code"));
+            pybind11::arg("deck_code"))
+        .def_static(
+            "decode_batch", &DecodeBatch,
+            R"pbdoc(Decodes deck codes in parallel and returns a dict of int32
+            arrays: heroes (n), formats (n), errors (n), dbf_ids
+            (n x max_cards) and counts (n x max_cards). A bad deck code
+            doesn't raise; its row has a DeckCodeError value and zeros.
+
+            Parameters
+            ----------
+            pool : The thread pool to decode deck codes.
+            deck_codes : A list or array of deck codes (str or bytes).)pbdoc",
+            pybind11::arg("pool"), pybind11::arg("deck_codes"))
+        .def_static(
+            "encode_batch", &EncodeBatch,
+            R"pbdoc(Encodes decks in parallel and returns a list of deck codes.
+            Pairs that have dbfID 0 or count 0 are skipped.
+
+            Parameters
+            ----------
+            pool : The thread pool to encode decks.
+            heroes : The dbfIDs of heroes (n).
+            formats : The format types (n).
+            dbf_ids : The dbfIDs of cards (n x max_cards).
+            counts : The counts of cards (n x max_cards).)pbdoc",
+            pybind11::arg("pool"), pybind11::arg("heroes"),
+            pybind11::arg("formats"), pybind11::arg("dbf_ids"),
+            pybind11::arg("counts"));
 }
@@ -0,0 +1,76 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Zones/Zones.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Models/Spell.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/GraveyardZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Binds the common methods of zone.
+//! \param m The module to add zone class.
+//! \param name The name of zone class.
+//! \param doc The docstring of zone class.
+template <typename ZoneT>
+void AddZone(pybind11::module& m, const char* name, const char* doc)
+{
+    // NOTE: Zones are owned by the player, so Python never deletes them.
+    pybind11::class_<ZoneT, std::unique_ptr<ZoneT, pybind11::nodelete>>(
+        m, name, doc)
+        .def("count", &ZoneT::GetCount,
+             R"pbdoc(Returns the number of entities in this zone.)pbdoc")
+        .def("is_full", &ZoneT::IsFull,
+             R"pbdoc(Returns whether this zone is full.)pbdoc")
+        .def("is_empty", &ZoneT::IsEmpty,
+             R"pbdoc(Returns whether this zone is empty.)pbdoc")
+        .def(
+            "get_all", [](const ZoneT& zone) { return zone.GetAll(); },
+            R"pbdoc(Returns a list of entities in this zone.)pbdoc",
+            pybind11::return_value_policy::reference)
+        .def("__len__", &ZoneT::GetCount)
+        .def(
+            "__getitem__",
+            [](const ZoneT& zone, int idx) {
+                const auto entities = zone.GetAll();
+                if (idx < 0 || idx >= static_cast<int>(entities.size()))
+                {
+                    throw pybind11::index_error();
+                }
+
+                return entities[idx];
+            },
+            pybind11::return_value_policy::reference);
+}
+}  // namespace
+
+void AddZones(pybind11::module& m)
+{
+    AddZone<DeckZone>(m, "DeckZone",
+                      R"pbdoc(This class is where the deck is kept.)pbdoc");
+    AddZone<FieldZone>(
+        m, "FieldZone",
+        R"pbdoc(This class is where minions are placed in play.)pbdoc");
+    AddZone<GraveyardZone>(
+        m, "GraveyardZone",
+        R"pbdoc(This class is where dead minions and played cards go.)pbdoc");
+    AddZone<HandZone>(
+        m, "HandZone",
+        R"pbdoc(This class is where cards are held in hand.)pbdoc");
+    AddZone<SecretZone>(
+        m, "SecretZone",
+        R"pbdoc(This class is where secrets and quests are placed.)pbdoc");
+}
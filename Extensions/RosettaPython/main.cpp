@@ -4,10 +4,18 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Python/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Python/Battlegrounds/Environments/VecEnv.hpp>
+
+#include <Python/Common/ThreadPool.hpp>
+
 #include <Python/PlayMode/Accounts/AccountInfo.hpp>
 #include <Python/PlayMode/Accounts/DeckInfo.hpp>
 
+#include <Python/PlayMode/Agents/RandomAgent.hpp>
+
 #include <Python/PlayMode/Cards/Card.hpp>
+#include <Python/PlayMode/Cards/CardFeatures.hpp>
 #include <Python/PlayMode/Cards/Cards.hpp>
 
 #include <Python/PlayMode/Enums/ActionEnums.hpp>
@@ -18,13 +26,30 @@
 #include <Python/PlayMode/Enums/TaskEnums.hpp>
 #include <Python/PlayMode/Enums/TriggerEnums.hpp>
 
+#include <Python/PlayMode/Environments/ActionSpace.hpp>
+#include <Python/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Python/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Python/PlayMode/Environments/TrajectoryReader.hpp>
+#include <Python/PlayMode/Environments/TrajectoryWriter.hpp>
+#include <Python/PlayMode/Environments/VecEnv.hpp>
+
+#include <Python/PlayMode/Games/Game.hpp>
+#include <Python/PlayMode/Games/GameConfig.hpp>
+
 #include <Python/PlayMode/Loaders/AccountLoader.hpp>
 #include <Python/PlayMode/Loaders/InternalCardLoader.hpp>
 #include <Python/PlayMode/Loaders/TargetingPredicates.hpp>
 
+#include <Python/PlayMode/Models/Entity.hpp>
+#include <Python/PlayMode/Models/Player.hpp>
+
+#include <Python/PlayMode/Tasks/PlayerTasks.hpp>
+
 #include <Python/PlayMode/Utils/Constants.hpp>
 #include <Python/PlayMode/Utils/DeckCode.hpp>
 
+#include <Python/PlayMode/Zones/Zones.hpp>
+
 #include <pybind11/pybind11.h>
 
 PYBIND11_MODULE(pyRosetta, m)
@@ -32,12 +57,16 @@ PYBIND11_MODULE(pyRosetta, m)
     m.doc() =
         R"pbdoc(Hearthstone simulator with some reinforcement learning)pbdoc";
 
+    // Common
+    AddThreadPool(m);
+
     // Accounts
     AddAccountInfo(m);
     AddDeckInfo(m);
 
     // Cards
     AddCard(m);
+    AddCardFeatures(m);
     AddCards(m);
 
     // Enums
@@ -57,4 +86,40 @@ PYBIND11_MODULE(pyRosetta, m)
     // Utils
     AddConstants(m);
     AddDeckCode(m);
+
+    // NOTE: Bindings below use enums and cards in default arguments and
+    // return types, so they should be added after them.
+
+    // Models
+    AddEntity(m);
+    AddPlayer(m);
+
+    // Zones
+    AddZones(m);
+
+    // Tasks
+    AddPlayerTasks(m);
+
+    // Games
+    AddGameConfig(m);
+    AddGame(m);
+
+    // Agents
+    AddRandomAgent(m);
+
+    // Environments
+    AddActionSpace(m);
+    AddDeltaEncoder(m);
+    AddObservationEncoder(m);
+    AddTrajectoryReader(m);
+    AddTrajectoryWriter(m);
+    AddVecEnv(m);
+
+    // Battlegrounds
+    pybind11::module battlegrounds = m.def_submodule(
+        "battlegrounds", R"pbdoc(Hearthstone Battlegrounds simulator)pbdoc");
+
+    // Environments
+    AddBattlegroundsActionSpace(battlegrounds);
+    AddBattlegroundsVecEnv(battlegrounds);
 }
\ No newline at end of file
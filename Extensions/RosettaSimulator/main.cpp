@@ -0,0 +1,436 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Environments/LobbyRunner.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Utils/GameUtils.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Simulators/BatchRunner.hpp>
+#include <Rosetta/PlayMode/Simulators/DeckOptimizer.hpp>
+#include <Rosetta/PlayMode/Simulators/MulliganEvaluator.hpp>
+#include <Rosetta/PlayMode/Utils/DeckCode.hpp>
+
+#include <lyra/cli_parser.hpp>
+#include <lyra/help.hpp>
+#include <lyra/opt.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+inline std::vector<DeckInfo> LoadDecks(const std::string& path)
+{
+    std::ifstream fileInput(path);
+    if (!fileInput.is_open())
+    {
+        std::cerr << "Failed to open file " << path << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<DeckInfo> decks;
+    std::string line;
+
+    while (std::getline(fileInput, line))
+    {
+        // Skips empty lines and comments
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        decks.emplace_back(DeckCode::Decode(line));
+    }
+
+    return decks;
+}
+
+inline std::vector<BatchRunner::Matchup> LoadMatchups(const std::string& path)
+{
+    std::ifstream fileInput(path);
+    if (!fileInput.is_open())
+    {
+        std::cerr << "Failed to open file " << path << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<BatchRunner::Matchup> matchups;
+    std::string line;
+
+    while (std::getline(fileInput, line))
+    {
+        // Skips empty lines and comments
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string deckCode1, deckCode2;
+        if (!(stream >> deckCode1 >> deckCode2))
+        {
+            std::cerr << "Invalid matchup: " << line << '\n';
+            exit(EXIT_FAILURE);
+        }
+
+        matchups.emplace_back(DeckCode::Decode(deckCode1),
+                              DeckCode::Decode(deckCode2));
+    }
+
+    return matchups;
+}
+
+inline std::vector<std::string> SplitCardIDs(const std::string& str)
+{
+    std::vector<std::string> cardIDs;
+    std::istringstream stream(str);
+    std::string cardID;
+
+    while (std::getline(stream, cardID, ','))
+    {
+        if (!cardID.empty())
+        {
+            cardIDs.emplace_back(cardID);
+        }
+    }
+
+    return cardIDs;
+}
+
+inline void PrintDeck(const DeckInfo& deck)
+{
+    for (std::size_t i = 0; i < deck.GetUniqueNumOfCards(); ++i)
+    {
+        const auto [cardID, numCards] = deck.GetCard(i);
+        const Card* card = Cards::FindCardByID(cardID);
+
+        std::cout << "  " << numCards << "x " << card->name << " (" << cardID
+                  << ")\n";
+    }
+}
+
+inline void RunOptimizer(ThreadPool& pool, DeckOptimizerConfig config,
+                         const std::string& seedDeckCode)
+{
+    const DeckInfo seedDeck = DeckCode::Decode(seedDeckCode);
+
+    DeckOptimizer optimizer(pool, std::move(config));
+    const auto decks = optimizer.Run(seedDeck);
+
+    for (std::size_t i = 0; i < decks.size(); ++i)
+    {
+        std::cout << "#" << i + 1 << " - Win rate: " << decks[i].second * 100
+                  << "%\n";
+        PrintDeck(decks[i].first);
+    }
+
+    std::cout << "Evaluated decks: " << optimizer.GetNumEvaluatedDecks()
+              << ", Cache hits: " << optimizer.GetNumCacheHits() << '\n';
+}
+
+inline void RunMulligan(ThreadPool& pool, FormatType formatType,
+                        const std::string& deckCode,
+                        const std::string& opponentDeckCode,
+                        const std::string& hand, bool isFirstPlayer,
+                        std::size_t numGames, std::uint64_t seed)
+{
+    const MulliganEvaluator evaluator(pool, DeckCode::Decode(deckCode),
+                                      DeckCode::Decode(opponentDeckCode),
+                                      formatType);
+    const auto results =
+        evaluator.Run(SplitCardIDs(hand), isFirstPlayer, numGames, seed);
+
+    std::cout << "Rank | Win rate | Keep | Replace\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+
+        std::cout << i + 1 << " | " << std::fixed << std::setprecision(2)
+                  << result.result.GetWinRate() * 100 << "% |";
+        for (const auto& cardID : result.keptCardIDs)
+        {
+            std::cout << ' ' << Cards::FindCardByID(cardID)->name << ';';
+        }
+        std::cout << " |";
+        for (const auto& cardID : result.replacedCardIDs)
+        {
+            std::cout << ' ' << Cards::FindCardByID(cardID)->name << ';';
+        }
+        std::cout << '\n';
+    }
+}
+
+inline bool RunBatch(FormatType formatType, const std::string& matchupPath,
+                     BatchConfig config, bool isResumed)
+{
+    BatchRunner runner(LoadMatchups(matchupPath), formatType,
+                       std::move(config));
+    if (isResumed && !runner.Resume())
+    {
+        return false;
+    }
+
+    const bool isSucceeded = runner.Run();
+
+    std::cout << "Matchup | Games | Wins | Losses | Ties | Win rate\n";
+    for (std::size_t i = 0; i < runner.GetMatchups().size(); ++i)
+    {
+        const auto& [deck1, deck2] = runner.GetMatchups()[i];
+        const MatchResult result = runner.GetResult(i);
+
+        std::cout << i + 1 << ". " << EnumToStr<CardClass>(deck1.GetClass())
+                  << " vs " << EnumToStr<CardClass>(deck2.GetClass()) << " | "
+                  << result.numGames << " | " << result.numWins << " | "
+                  << result.numLosses << " | " << result.numTies << " | "
+                  << std::fixed << std::setprecision(2)
+                  << result.GetWinRate() * 100 << "%\n";
+    }
+
+    return isSucceeded;
+}
+
+inline void RunBattlegroundsBench(ThreadPool& pool, std::size_t numLobbies,
+                                  std::uint64_t seed)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto getSeconds = [](Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Plays lobbies with random agents
+    Battlegrounds::LobbyRunner runner(
+        pool, [](std::size_t) -> std::unique_ptr<Battlegrounds::Agent> {
+            return std::make_unique<Battlegrounds::RandomAgent>();
+        });
+
+    std::size_t numRounds = 0;
+    auto start = Clock::now();
+    runner.Run(numLobbies, seed,
+               [&](const Battlegrounds::LobbyResult& result) {
+                   numRounds += static_cast<std::size_t>(result.numRounds);
+               });
+    double seconds = getSeconds(start);
+
+    std::cout << "Lobbies: " << numLobbies << " | " << std::fixed
+              << std::setprecision(1)
+              << static_cast<double>(numLobbies) / seconds << " lobbies/s | "
+              << static_cast<double>(numRounds) /
+                     static_cast<double>(numLobbies)
+              << " rounds/lobby\n";
+
+    // Clones a game in the recruit phase of round 6
+    SeedRandom(seed, 0);
+    Battlegrounds::Game game;
+    game.Start();
+
+    Battlegrounds::GameState& gameState = game.GetGameState();
+    for (auto& player : gameState.players)
+    {
+        player.SelectHero(0);
+    }
+
+    Battlegrounds::PlaySimpleRounds(game, 5);
+
+    constexpr std::size_t NUM_CLONES = 100000;
+    const auto copy = std::make_unique<Battlegrounds::Game>();
+
+    start = Clock::now();
+    for (std::size_t i = 0; i < NUM_CLONES; ++i)
+    {
+        copy->RefCopyFrom(game);
+    }
+    seconds = getSeconds(start);
+
+    std::cout << "Clones: " << NUM_CLONES << " | " << std::fixed
+              << std::setprecision(1)
+              << static_cast<double>(NUM_CLONES) / seconds << " clones/s | "
+              << std::setprecision(2)
+              << seconds * 1e6 / static_cast<double>(NUM_CLONES)
+              << " us/clone\n";
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse command
+    bool showHelp = false;
+    std::string mode = "optimize";
+    std::string deckCode;
+    std::string gauntletPath;
+    std::string opponentDeckCode;
+    std::string hand;
+    std::string matchupPath;
+    std::size_t numProcesses = 1;
+    std::string checkpointPath;
+    std::size_t checkpointInterval = 60;
+    std::size_t maxGamesPerRun = 0;
+    bool isResumed = false;
+    bool isSecondPlayer = false;
+    std::string formatName = "STANDARD";
+    std::size_t numThreads = 0;
+    std::size_t numGames = 20;
+    std::size_t numGenerations = 10;
+    std::size_t populationSize = 16;
+    std::uint64_t seed = 0;
+
+    // Parsing
+    auto parser =
+        lyra::cli_parser() | lyra::help(showHelp) |
+        lyra::opt(mode, "mode")["-m"]["--mode"](
+            "Specify simulation mode (optimize, mulligan, batch or bg-bench)") |
+        lyra::opt(deckCode, "deckCode")["-d"]["--deck"](
+            "Specify the deck code to start with") |
+        lyra::opt(gauntletPath, "path")["-g"]["--gauntlet"](
+            "Specify the file that contains deck codes of opponents") |
+        lyra::opt(opponentDeckCode, "deckCode")["-o"]["--opponent"](
+            "Specify the deck code of the opponent") |
+        lyra::opt(hand, "cardIDs")["--hand"](
+            "Specify comma-separated card IDs of the opening hand") |
+        lyra::opt(isSecondPlayer)["--second"]("Go second in mulligan mode") |
+        lyra::opt(matchupPath, "path")["--matchups"](
+            "Specify the file that contains a pair of deck codes per line") |
+        lyra::opt(numProcesses, "processes")["-p"]["--processes"](
+            "Specify the number of worker processes in batch mode") |
+        lyra::opt(checkpointPath, "path")["--checkpoint"](
+            "Specify the file to write checkpoints in batch mode") |
+        lyra::opt(checkpointInterval, "seconds")["--checkpoint-interval"](
+            "Specify the interval between checkpoints") |
+        lyra::opt(maxGamesPerRun, "games")["--max-games"](
+            "Stop batch mode after playing the given number of games") |
+        lyra::opt(isResumed)["--resume"](
+            "Continue the run from the checkpoint file") |
+        lyra::opt(formatName, "format")["-f"]["--format"](
+            "Specify format type (STANDARD or WILD)") |
+        lyra::opt(numThreads, "threads")["-t"]["--threads"](
+            "Specify the number of threads (0: hardware concurrency)") |
+        lyra::opt(numGames, "games")["-n"]["--games"](
+            "Specify the number of games per opponent, choice or matchup") |
+        lyra::opt(numGenerations, "generations")["--generations"](
+            "Specify the number of generations") |
+        lyra::opt(populationSize, "population")["--population"](
+            "Specify the number of decks per generation") |
+        lyra::opt(seed, "seed")["-s"]["--seed"]("Specify random seed");
+
+    auto result = parser.parse({ argc, argv });
+
+    if (!result)
+    {
+        std::cerr << "Error in command line: " << result.errorMessage() << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    if (showHelp)
+    {
+        std::cout << parser << '\n';
+        exit(EXIT_SUCCESS);
+    }
+
+    // NOTE: Card data must be loaded before worker threads are started.
+    Cards::GetInstance();
+
+    FormatType formatType = FormatType::UNKNOWN;
+    if (formatName == "STANDARD")
+    {
+        formatType = FormatType::STANDARD;
+    }
+    else if (formatName == "WILD")
+    {
+        formatType = FormatType::WILD;
+    }
+    else
+    {
+        std::cerr << "Invalid format type: " << formatName << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    if (mode == "optimize")
+    {
+        if (deckCode.empty() || gauntletPath.empty())
+        {
+            std::cerr << "You should input deck code and gauntlet file\n";
+            exit(EXIT_FAILURE);
+        }
+
+        DeckOptimizerConfig config;
+        config.formatType = formatType;
+        config.gauntlet = LoadDecks(gauntletPath);
+        config.populationSize = populationSize;
+        config.numEliteDecks = std::min(config.numEliteDecks, populationSize);
+        config.numGenerations = numGenerations;
+        config.numGamesPerOpponent = numGames;
+        config.seed = seed;
+
+        ThreadPool pool(numThreads);
+        RunOptimizer(pool, std::move(config), deckCode);
+    }
+    else if (mode == "mulligan")
+    {
+        if (deckCode.empty() || opponentDeckCode.empty() || hand.empty())
+        {
+            std::cerr << "You should input deck code, opponent deck code and "
+                         "opening hand\n";
+            exit(EXIT_FAILURE);
+        }
+
+        ThreadPool pool(numThreads);
+        RunMulligan(pool, formatType, deckCode, opponentDeckCode, hand,
+                    !isSecondPlayer, numGames, seed);
+    }
+    else if (mode == "batch")
+    {
+        if (matchupPath.empty())
+        {
+            std::cerr << "You should input matchup file\n";
+            exit(EXIT_FAILURE);
+        }
+
+        if (isResumed && checkpointPath.empty())
+        {
+            std::cerr << "You should input checkpoint file to resume\n";
+            exit(EXIT_FAILURE);
+        }
+
+        BatchConfig config;
+        config.numGames = numGames;
+        config.numProcesses = numProcesses;
+        config.numThreads = numThreads;
+        config.seed = seed;
+        config.checkpointPath = checkpointPath;
+        config.checkpointInterval = checkpointInterval;
+        config.maxGamesPerRun = maxGamesPerRun;
+
+        // NOTE: Worker processes are forked before any thread is started.
+        if (!RunBatch(formatType, matchupPath, std::move(config), isResumed))
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+    else if (mode == "bg-bench")
+    {
+        // NOTE: Card data must be loaded before worker threads are started.
+        Battlegrounds::Cards::GetInstance();
+
+        ThreadPool pool(numThreads);
+        RunBattlegroundsBench(pool, numGames, seed);
+    }
+    else
+    {
+        std::cerr << "Invalid mode: " << mode << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
@@ -97,7 +97,7 @@ class Card
 
     std::vector<TargetingPredicate> targetingPredicate;
 
-    TargetingType targetingType;
+    TargetingType targetingType = TargetingType::NONE;
     Power power;
 
     bool isCurHero = false;
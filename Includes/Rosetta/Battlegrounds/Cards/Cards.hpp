@@ -44,18 +44,21 @@ class Cards
 
     //! Returns a card that matches \p id.
     //! \param id The ID of the card.
-    //! \return A card that matches \p id.
-    static Card FindCardByID(const std::string_view& id);
+    //! \return A card that matches \p id, or an empty card if there is no
+    //! such card. It refers to the card stored in Cards.
+    static const Card& FindCardByID(const std::string_view& id);
 
     //! Returns a card that matches \p dbfID.
     //! \param dbfID The dbfID of the card.
-    //! \return A card that matches \p dbfID.
-    static Card FindCardByDbfID(int dbfID);
+    //! \return A card that matches \p dbfID, or an empty card if there is no
+    //! such card. It refers to the card stored in Cards.
+    static const Card& FindCardByDbfID(int dbfID);
 
     //! Returns a card that matches \p name.
     //! \param name The name of the card.
-    //! \return A card that matches \p name.
-    static Card FindCardByName(const std::string_view& name);
+    //! \return A card that matches \p name, or an empty card if there is no
+    //! such card. It refers to the card stored in Cards.
+    static const Card& FindCardByName(const std::string_view& name);
 
     //! Returns a list of current heroes.
     //! \return A list of current heroes.
@@ -90,6 +93,7 @@ class Cards
     Cards();
 
     static std::array<Card, NUM_ALL_CARDS> m_cards;
+    static const Card m_emptyCard;
     static std::array<Card, NUM_BATTLEGROUNDS_HEROES> m_curHeroes;
     static std::array<Card, NUM_TIER1_MINIONS> m_tier1Minions;
     static std::array<Card, NUM_TIER2_MINIONS> m_tier2Minions;
@@ -31,14 +31,26 @@ class Power
     //! \return A list of battlecry tasks.
     std::vector<TaskType>& GetBattlecryTask();
 
+    //! Returns a list of battlecry tasks.
+    //! \return A list of battlecry tasks.
+    const std::vector<TaskType>& GetBattlecryTask() const;
+
     //! Returns a list of start of combat tasks.
     //! \return A list of start of combat tasks.
     std::vector<TaskType>& GetStartCombatTask();
 
+    //! Returns a list of start of combat tasks.
+    //! \return A list of start of combat tasks.
+    const std::vector<TaskType>& GetStartCombatTask() const;
+
     //! Returns a list of deathrattle tasks.
     //! \return A list of deathrattle tasks.
     std::vector<TaskType>& GetDeathrattleTask();
 
+    //! Returns a list of deathrattle tasks.
+    //! \return A list of deathrattle tasks.
+    const std::vector<TaskType>& GetDeathrattleTask() const;
+
     //! Returns enchant.
     //! \return A reference to enchant.
     std::optional<Enchant>& GetEnchant();
@@ -47,6 +59,10 @@ class Power
     //! \return A reference to trigger.
     std::optional<Trigger>& GetTrigger();
 
+    //! Returns trigger.
+    //! \return A reference to trigger.
+    const std::optional<Trigger>& GetTrigger() const;
+
     //! Adds battlecry task.
     //! \param task A battlecry task to add.
     void AddBattlecryTask(TaskType&& task);
@@ -0,0 +1,169 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_ACTION_SPACE_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_ACTION_SPACE_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RosettaStone::Battlegrounds
+{
+class Player;
+
+//! \brief An enumerator for identifying the type of action.
+enum class ActionType : std::uint8_t
+{
+    SELECT_HERO,
+    PURCHASE,
+    PLAY_CARD,
+    SELL,
+    REARRANGE,
+    REFRESH,
+    UPGRADE,
+    FREEZE,
+    END_RECRUIT
+};
+
+//!
+//! \brief ActionSpace class.
+//!
+//! This class defines a fixed discrete action space of a player in
+//! Battlegrounds. Actions are laid out in the following order:
+//!
+//! - Select hero: the index of hero choices
+//! - Purchase: the position of minion in Tavern
+//! - Play card: hand position x field position x target
+//! - Sell: the position of minion on the field
+//! - Rearrange: current position x new position
+//! - Refresh, upgrade and freeze Tavern
+//! - End recruit
+//!
+//! A target is no target or the minion at position i of the field of the
+//! player, which takes index i + 1. Select hero actions are legal in select
+//! hero phase and the other actions are legal in recruit phase. End recruit
+//! is always legal in recruit phase.
+//!
+class ActionSpace
+{
+ public:
+    //! The number of targets: no target and own minions.
+    static constexpr std::size_t NUM_TARGETS = MAX_FIELD_SIZE + 1;
+
+    //! The offset of select hero actions.
+    static constexpr std::size_t SELECT_HERO_OFFSET = 0;
+
+    //! The offset of purchase actions.
+    static constexpr std::size_t PURCHASE_OFFSET =
+        SELECT_HERO_OFFSET + NUM_HEROES_ON_SELECTION_LIST;
+
+    //! The offset of play card actions.
+    static constexpr std::size_t PLAY_CARD_OFFSET =
+        PURCHASE_OFFSET + MAX_FIELD_SIZE;
+
+    //! The offset of sell actions.
+    static constexpr std::size_t SELL_OFFSET =
+        PLAY_CARD_OFFSET + MAX_HAND_SIZE * MAX_FIELD_SIZE * NUM_TARGETS;
+
+    //! The offset of rearrange actions.
+    static constexpr std::size_t REARRANGE_OFFSET =
+        SELL_OFFSET + MAX_FIELD_SIZE;
+
+    //! The refresh action.
+    static constexpr std::size_t REFRESH =
+        REARRANGE_OFFSET + MAX_FIELD_SIZE * MAX_FIELD_SIZE;
+
+    //! The upgrade action.
+    static constexpr std::size_t UPGRADE = REFRESH + 1;
+
+    //! The freeze action.
+    static constexpr std::size_t FREEZE = UPGRADE + 1;
+
+    //! The end recruit action.
+    static constexpr std::size_t END_RECRUIT = FREEZE + 1;
+
+    //! The number of actions.
+    static constexpr std::size_t SIZE = END_RECRUIT + 1;
+
+    //! Returns the select hero action.
+    //! \param idx The index of hero choices.
+    //! \return The select hero action.
+    static constexpr std::size_t SelectHeroAction(std::size_t idx)
+    {
+        return SELECT_HERO_OFFSET + idx;
+    }
+
+    //! Returns the purchase action.
+    //! \param tavernPos The position of minion in Tavern.
+    //! \return The purchase action.
+    static constexpr std::size_t PurchaseAction(std::size_t tavernPos)
+    {
+        return PURCHASE_OFFSET + tavernPos;
+    }
+
+    //! Returns the play card action.
+    //! \param handPos The position of card in hand.
+    //! \param fieldPos The position of minion to place on the field.
+    //! \param target The index of target.
+    //! \return The play card action.
+    static constexpr std::size_t PlayCardAction(std::size_t handPos,
+                                                std::size_t fieldPos,
+                                                std::size_t target)
+    {
+        return PLAY_CARD_OFFSET +
+               (handPos * MAX_FIELD_SIZE + fieldPos) * NUM_TARGETS + target;
+    }
+
+    //! Returns the sell action.
+    //! \param fieldPos The position of minion on the field.
+    //! \return The sell action.
+    static constexpr std::size_t SellAction(std::size_t fieldPos)
+    {
+        return SELL_OFFSET + fieldPos;
+    }
+
+    //! Returns the rearrange action.
+    //! \param curPos The current position of minion.
+    //! \param newPos The new position of minion.
+    //! \return The rearrange action.
+    static constexpr std::size_t RearrangeAction(std::size_t curPos,
+                                                 std::size_t newPos)
+    {
+        return REARRANGE_OFFSET + curPos * MAX_FIELD_SIZE + newPos;
+    }
+
+    //! Returns the type of \p action.
+    //! \param action The action.
+    //! \return The type of \p action.
+    static ActionType GetActionType(std::size_t action);
+
+    //! Writes the mask of legal actions of \p player into \p mask.
+    //! \param phase The phase of the game.
+    //! \param player The player to act.
+    //! \param mask The buffer that has at least SIZE values.
+    //! \return The number of legal actions.
+    static std::size_t GetActionMask(Phase phase, Player& player,
+                                     std::uint8_t* mask);
+
+    //! Checks \p action is legal for \p player. Actions of recruit phase are
+    //! checked with Player::GetLegalActions().
+    //! \param phase The phase of the game.
+    //! \param player The player to act.
+    //! \param action The action.
+    //! \return true if \p action is legal, false otherwise.
+    static bool IsLegal(Phase phase, Player& player, std::size_t action);
+
+    //! Processes \p action of \p player.
+    //! \param player The player to act.
+    //! \param action The action.
+    static void Apply(Player& player, std::size_t action);
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_ACTION_SPACE_HPP
@@ -0,0 +1,134 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_LEGAL_ACTIONS_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_LEGAL_ACTIONS_HPP
+
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief RecruitAction struct.
+//!
+//! This struct is a compact record of an action in recruit phase. The meaning
+//! of positions depends on the type of action:
+//!
+//! - Purchase: pos is the position of minion in Tavern.
+//! - Play card: pos is the position of card in hand, fieldPos is the position
+//!   of minion to place on the field and target is the index of target.
+//! - Sell: pos is the position of minion on the field.
+//! - Rearrange: pos is the current position and fieldPos is the new position.
+//!
+//! A target is 0 for no target or i + 1 for the minion at position i of the
+//! field of the player, as in ActionSpace.
+//!
+struct RecruitAction
+{
+    //! Returns the index of this action in ActionSpace.
+    //! \return The index of this action in ActionSpace.
+    constexpr std::size_t GetAction() const
+    {
+        switch (type)
+        {
+            case ActionType::SELECT_HERO:
+                return ActionSpace::SelectHeroAction(pos);
+            case ActionType::PURCHASE:
+                return ActionSpace::PurchaseAction(pos);
+            case ActionType::PLAY_CARD:
+                return ActionSpace::PlayCardAction(pos, fieldPos, target);
+            case ActionType::SELL:
+                return ActionSpace::SellAction(pos);
+            case ActionType::REARRANGE:
+                return ActionSpace::RearrangeAction(pos, fieldPos);
+            case ActionType::REFRESH:
+                return ActionSpace::REFRESH;
+            case ActionType::UPGRADE:
+                return ActionSpace::UPGRADE;
+            case ActionType::FREEZE:
+                return ActionSpace::FREEZE;
+            case ActionType::END_RECRUIT:
+                break;
+        }
+
+        return ActionSpace::END_RECRUIT;
+    }
+
+    ActionType type;
+    std::uint8_t pos;
+    std::uint8_t fieldPos;
+    std::uint8_t target;
+};
+
+//!
+//! \brief LegalActions class.
+//!
+//! This class is a reusable buffer of the legal actions of a player in
+//! recruit phase, written by Player::GetLegalActions(). Records are stored in
+//! a fixed array and a bit mask over ActionSpace is kept along with them, so
+//! filling the buffer again doesn't allocate memory.
+//!
+class LegalActions
+{
+ public:
+    //! The maximum number of legal actions in recruit phase.
+    static constexpr std::size_t MAX_SIZE =
+        ActionSpace::SIZE - ActionSpace::PURCHASE_OFFSET;
+
+    //! Removes all actions.
+    void Clear();
+
+    //! Adds \p action to the buffer.
+    //! \param action The legal action to add.
+    void Add(const RecruitAction& action)
+    {
+        // NOTE: It is defined in the header so that the index of action is
+        // folded at the call sites in Player::GetLegalActions().
+        m_actions[m_count++] = action;
+        m_mask[action.GetAction()] = true;
+    }
+
+    //! Returns the number of actions.
+    //! \return The number of actions.
+    std::size_t GetCount() const;
+
+    //! Returns the action at \p idx.
+    //! \param idx The index of action.
+    //! \return The action at \p idx.
+    const RecruitAction& operator[](std::size_t idx) const;
+
+    //! Returns the pointer to the first action.
+    //! \return The pointer to the first action.
+    const RecruitAction* begin() const;
+
+    //! Returns the pointer past the last action.
+    //! \return The pointer past the last action.
+    const RecruitAction* end() const;
+
+    //! Checks \p action of ActionSpace is in the buffer.
+    //! \param action The index of action in ActionSpace.
+    //! \return true if \p action is in the buffer, false otherwise.
+    bool IsLegal(std::size_t action) const;
+
+    //! Returns the mask of actions over ActionSpace.
+    //! \return The mask of actions over ActionSpace.
+    const std::bitset<ActionSpace::SIZE>& GetMask() const;
+
+ private:
+    // NOTE: Records are left uninitialized since only the first m_count
+    // records are read.
+    std::array<RecruitAction, MAX_SIZE> m_actions;
+    std::bitset<ActionSpace::SIZE> m_mask;
+    std::size_t m_count = 0;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_LEGAL_ACTIONS_HPP
@@ -0,0 +1,177 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_LOBBY_RUNNER_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_LOBBY_RUNNER_HPP
+
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Games/GameState.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief Agent class.
+//!
+//! This class is the interface of a player that selects actions of
+//! ActionSpace in LobbyRunner. An agent only selects one of the legal
+//! actions; the runner applies it.
+//!
+class Agent
+{
+ public:
+    //! Default virtual destructor.
+    virtual ~Agent() = default;
+
+    //! Selects an action of the player at \p playerIdx.
+    //! \param gameState The game state of the lobby.
+    //! \param playerIdx The index of player to act.
+    //! \param actionMask The mask of legal actions that has ActionSpace::SIZE
+    //! values.
+    //! \param numLegalActions The number of legal actions.
+    //! \return The action that is legal in \p actionMask.
+    virtual std::size_t SelectAction(GameState& gameState,
+                                     std::size_t playerIdx,
+                                     const std::uint8_t* actionMask,
+                                     std::size_t numLegalActions) = 0;
+};
+
+//!
+//! \brief RandomAgent class.
+//!
+//! This class selects one of the legal actions uniformly at random.
+//!
+class RandomAgent : public Agent
+{
+ public:
+    std::size_t SelectAction(GameState& gameState, std::size_t playerIdx,
+                             const std::uint8_t* actionMask,
+                             std::size_t numLegalActions) override;
+};
+
+//!
+//! \brief LobbyResult struct.
+//!
+//! This struct stores the result of a finished lobby.
+//!
+struct LobbyResult
+{
+    //! \brief BoardMinion struct.
+    //!
+    //! This struct stores a minion on the final board of a player.
+    struct BoardMinion
+    {
+        int dbfID = 0;
+        int attack = 0;
+        int health = 0;
+    };
+
+    //! \brief PlayerResult struct.
+    //!
+    //! This struct stores the result of a player.
+    struct PlayerResult
+    {
+        std::size_t rank = 0;
+        int heroDbfID = 0;
+        int health = 0;
+        int tier = 0;
+        int numMinions = 0;
+        std::array<BoardMinion, MAX_FIELD_SIZE> board{};
+    };
+
+    std::size_t lobbyIdx = 0;
+    int numRounds = 0;
+    std::array<PlayerResult, NUM_BATTLEGROUNDS_PLAYERS> players{};
+};
+
+//!
+//! \brief LobbyRunner class.
+//!
+//! This class plays a number of complete 8-player lobbies in parallel with a
+//! thread pool. Each thread owns a slot with an agent for each seat, made by
+//! the agent factory, and takes the next lobby to play from a shared counter
+//! whenever it finishes one, so long lobbies don't hold back a thread that
+//! could take more. Each lobby has its own game, game state and minion pool
+//! and seeds the random number generator of the thread with its own stream.
+//! So results don't depend on the number of threads as long as agents only
+//! depend on their arguments and Random.
+//!
+//! In each phase players act in seat order. A player acts until it selects
+//! a hero or ends recruit, or until it processes MAX_AGENT_TASKS_PER_TURN
+//! actions in a recruit phase. These last actions are applied when all
+//! players are ready, like VecEnv. A lobby that reaches MAX_NUM_ROUNDS ranks
+//! its remaining players by health.
+//!
+//! Results are passed to the callback as soon as their lobbies finish, in
+//! the order of finishing, so they are not kept in memory. The callback is
+//! called by one thread at a time.
+//!
+class LobbyRunner
+{
+ public:
+    //! The number of players in a lobby.
+    static constexpr std::size_t NUM_PLAYERS = NUM_BATTLEGROUNDS_PLAYERS;
+
+    //! The maximum number of rounds in a lobby.
+    static constexpr int MAX_NUM_ROUNDS = 50;
+
+    //! The function that makes the agent of the seat at its argument.
+    using AgentFactory = std::function<std::unique_ptr<Agent>(std::size_t)>;
+
+    //! The function that receives the result of a finished lobby.
+    using ResultCallback = std::function<void(const LobbyResult&)>;
+
+    //! Constructs lobby runner with given \p pool and \p agentFactory.
+    //! \param pool The thread pool to play lobbies.
+    //! \param agentFactory The factory of agents, called for each seat of
+    //! each thread.
+    LobbyRunner(ThreadPool& pool, const AgentFactory& agentFactory);
+
+    //! Plays \p numLobbies lobbies and passes their results to \p callback.
+    //! \param numLobbies The number of lobbies to play.
+    //! \param seed The base seed. Lobby i uses stream i of it.
+    //! \param callback The function that receives the results.
+    void Run(std::size_t numLobbies, std::uint64_t seed,
+             const ResultCallback& callback);
+
+ private:
+    //! Slot struct.
+    //! This struct holds the agents and the buffer that a thread plays
+    //! lobbies with.
+    struct Slot
+    {
+        std::array<std::unique_ptr<Agent>, NUM_PLAYERS> agents;
+        std::array<std::uint8_t, ActionSpace::SIZE> actionMask{};
+    };
+
+    //! Plays the lobby at \p lobbyIdx to the end.
+    //! \param slot The slot of the calling thread.
+    //! \param lobbyIdx The index of lobby.
+    //! \param seed The base seed.
+    //! \param result The result of the lobby to write.
+    static void PlayLobby(Slot& slot, std::size_t lobbyIdx,
+                          std::uint64_t seed, LobbyResult& result);
+
+    //! Processes the actions of a player until it is ready.
+    //! \param slot The slot of the calling thread.
+    //! \param gameState The game state of the lobby.
+    //! \param playerIdx The index of player to act.
+    //! \return The action that makes the player ready.
+    static std::size_t PlayTurn(Slot& slot, GameState& gameState,
+                                std::size_t playerIdx);
+
+    ThreadPool& m_pool;
+    std::vector<Slot> m_slots;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_LOBBY_RUNNER_HPP
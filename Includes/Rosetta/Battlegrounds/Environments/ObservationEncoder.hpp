@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_OBSERVATION_ENCODER_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_OBSERVATION_ENCODER_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+
+#include <cstddef>
+
+namespace RosettaStone::Battlegrounds
+{
+class Minion;
+struct GameState;
+
+//!
+//! \brief ObservationEncoder class.
+//!
+//! This class encodes a lobby from the perspective of a player into a tensor
+//! with a fixed layout. The tensor has the following sections in order:
+//!
+//! - Global: round, is select hero phase, is recruit phase, can act,
+//!   the number of remaining players
+//! - Player: health, remaining coin, total coin, tier, coin to upgrade,
+//!   is frozen, hero card index, hero choices
+//! - Tavern: MAX_FIELD_SIZE slots of minion values
+//! - Hand: MAX_HAND_SIZE slots of minion values
+//! - Field: MAX_FIELD_SIZE slots of minion values
+//! - Lobby: NUM_BATTLEGROUNDS_PLAYERS slots of player values
+//!
+//! The card index is the dbfID of the card and empty slots are all zeros.
+//! A spell in hand has only exists and card index. The lobby starts with the
+//! player and is followed by the other players in seat order, and it shows
+//! only what every player sees: health, tier and the size of the field. The
+//! encoder writes into a buffer of the caller, so it doesn't allocate.
+//!
+class ObservationEncoder
+{
+ public:
+    //! The number of global values.
+    static constexpr std::size_t GLOBAL_SIZE = 5;
+
+    //! The number of values of the player.
+    static constexpr std::size_t PLAYER_SIZE =
+        7 + NUM_HEROES_ON_SELECTION_LIST;
+
+    //! The number of values of a minion: exists, card index, tier, attack,
+    //! health, taunt, divine shield.
+    static constexpr std::size_t MINION_SIZE = 7;
+
+    //! The number of values of a player in the lobby: is alive, health, tier,
+    //! field count, is next opponent.
+    static constexpr std::size_t LOBBY_PLAYER_SIZE = 5;
+
+    //! The offset of the player section.
+    static constexpr std::size_t PLAYER_OFFSET = GLOBAL_SIZE;
+
+    //! The offset of the Tavern section.
+    static constexpr std::size_t TAVERN_OFFSET = PLAYER_OFFSET + PLAYER_SIZE;
+
+    //! The offset of the hand section.
+    static constexpr std::size_t HAND_OFFSET =
+        TAVERN_OFFSET + MAX_FIELD_SIZE * MINION_SIZE;
+
+    //! The offset of the field section.
+    static constexpr std::size_t FIELD_OFFSET =
+        HAND_OFFSET + MAX_HAND_SIZE * MINION_SIZE;
+
+    //! The offset of the lobby section.
+    static constexpr std::size_t LOBBY_OFFSET =
+        FIELD_OFFSET + MAX_FIELD_SIZE * MINION_SIZE;
+
+    //! The number of values of an observation.
+    static constexpr std::size_t SIZE =
+        LOBBY_OFFSET + NUM_BATTLEGROUNDS_PLAYERS * LOBBY_PLAYER_SIZE;
+
+    //! Encodes \p state from the perspective of the player at \p playerIdx.
+    //! \param state The game state to encode.
+    //! \param playerIdx The index of the player.
+    //! \param round The number of the current round.
+    //! \param canAct The flag indicating the player can act.
+    //! \param observation The buffer that has at least SIZE values.
+    static void Encode(const GameState& state, std::size_t playerIdx,
+                       int round, bool canAct, float* observation);
+
+ private:
+    //! Encodes \p minion into a slot.
+    //! \param minion The minion to encode.
+    //! \param slot The buffer that has at least MINION_SIZE values.
+    static void EncodeMinion(const Minion& minion, float* slot);
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_OBSERVATION_ENCODER_HPP
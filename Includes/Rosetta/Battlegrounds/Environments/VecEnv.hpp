@@ -0,0 +1,165 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_VEC_ENV_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_VEC_ENV_HPP
+
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Environments/ObservationEncoder.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief VecEnv class.
+//!
+//! This class owns a number of 8-player lobbies and steps all of them in
+//! parallel with a thread pool. Every player of a lobby is an agent, so a
+//! step takes one action of ActionSpace for each player of each lobby.
+//! Finished lobbies are reset automatically, so the observation of a done
+//! lobby is the first observation of the next lobby.
+//!
+//! Players act simultaneously. Actions are processed in seat order and an
+//! action that became illegal by an earlier action of the same step is
+//! ignored. Selecting a hero and ending recruit make a player ready, and the
+//! phase advances when all players that are still playing are ready, so
+//! combat runs inside the step that the last player ends recruit. A player
+//! that can't act because it is ready, defeated or has processed
+//! MAX_AGENT_TASKS_PER_TURN actions in a recruit phase has only END_RECRUIT
+//! in its action mask, which ends recruit if it can still play and does
+//! nothing otherwise.
+//!
+//! A player gets a reward in the step that its rank is decided: 1 for the
+//! first place and -1 for the last place, linear in between. A lobby that
+//! reaches MAX_NUM_ROUNDS ranks its remaining players by health. Each lobby
+//! reseeds the random number generator of the thread with its own stream
+//! before it runs, so results don't depend on the number of threads.
+//!
+class VecEnv
+{
+ public:
+    //! The number of players in a lobby.
+    static constexpr std::size_t NUM_PLAYERS = NUM_BATTLEGROUNDS_PLAYERS;
+
+    //! The number of values in the observation of a player.
+    static constexpr std::size_t OBSERVATION_SIZE = ObservationEncoder::SIZE;
+
+    //! The number of actions in the action space.
+    static constexpr std::size_t ACTION_SIZE = ActionSpace::SIZE;
+
+    //! The maximum number of rounds in a lobby.
+    static constexpr int MAX_NUM_ROUNDS = 50;
+
+    //! Constructs vectorized environment with given \p pool, \p numLobbies
+    //! and \p seed.
+    //! \param pool The thread pool to step lobbies.
+    //! \param numLobbies The number of lobbies.
+    //! \param seed The base seed.
+    VecEnv(ThreadPool& pool, std::size_t numLobbies, std::uint64_t seed = 0);
+
+    //! Resets all lobbies and writes the first observations.
+    void Reset();
+
+    //! Processes the actions of all players of each lobby and writes the
+    //! results. Action i * NUM_PLAYERS + j is the action of player j of
+    //! lobby i.
+    //! \param actions A list of actions of all players of all lobbies.
+    void Step(const std::vector<int>& actions);
+
+    //! Returns the number of lobbies.
+    //! \return The number of lobbies.
+    std::size_t GetNumLobbies() const;
+
+    //! Returns the number of the current round of the lobby at \p idx.
+    //! \param idx The index of lobby.
+    //! \return The number of the current round of the lobby at \p idx.
+    int GetRound(std::size_t idx) const;
+
+    //! Returns the game of the lobby at \p idx.
+    //! \param idx The index of lobby.
+    //! \return The game of the lobby at \p idx.
+    Game& GetGame(std::size_t idx);
+
+    //! Returns the buffer of observations
+    //! (numLobbies x NUM_PLAYERS x OBSERVATION_SIZE).
+    //! \return The buffer of observations.
+    float* GetObservations();
+
+    //! Returns the buffer of rewards (numLobbies x NUM_PLAYERS).
+    //! \return The buffer of rewards.
+    float* GetRewards();
+
+    //! Returns the buffer of dones (numLobbies).
+    //! \return The buffer of dones.
+    std::uint8_t* GetDones();
+
+    //! Returns the buffer of action masks
+    //! (numLobbies x NUM_PLAYERS x ACTION_SIZE).
+    //! \return The buffer of action masks.
+    std::uint8_t* GetActionMasks();
+
+ private:
+    //! Lobby struct.
+    //! This struct holds a game and the progress of its players in the
+    //! current phase.
+    struct Lobby
+    {
+        std::unique_ptr<Game> game;
+        std::uint64_t numSeeds = 0;
+        int round = 0;
+        std::array<bool, NUM_PLAYERS> isReady{};
+        std::array<bool, NUM_PLAYERS> isRanked{};
+        std::array<int, NUM_PLAYERS> numActions{};
+        std::array<std::size_t, NUM_PLAYERS> readyActions{};
+    };
+
+    //! Seeds the random number generator with the next stream of \p idx.
+    //! \param idx The index of lobby.
+    void Seed(std::size_t idx);
+
+    //! Creates a new game at \p idx and starts it.
+    //! \param idx The index of lobby.
+    void ResetLobby(std::size_t idx);
+
+    //! Processes the actions of the players of the lobby at \p idx.
+    //! \param idx The index of lobby.
+    //! \param actions The actions of the players of the lobby.
+    void StepLobby(std::size_t idx, const int* actions);
+
+    //! Writes the rewards of players whose ranks are decided and checks the
+    //! lobby at \p idx is done.
+    //! \param idx The index of lobby.
+    //! \return true if the lobby is done, false otherwise.
+    bool ProcessRanks(std::size_t idx);
+
+    //! Checks the player at \p playerIdx of \p lobby can act.
+    //! \param lobby The lobby.
+    //! \param playerIdx The index of player.
+    //! \return true if the player can act, false otherwise.
+    static bool CanAct(const Lobby& lobby, std::size_t playerIdx);
+
+    //! Writes the observations and the action masks of the lobby at \p idx.
+    //! \param idx The index of lobby.
+    void UpdateLobby(std::size_t idx);
+
+    ThreadPool& m_pool;
+    std::uint64_t m_seed = 0;
+    std::vector<Lobby> m_lobbies;
+
+    std::vector<float> m_observations;
+    std::vector<float> m_rewards;
+    std::vector<std::uint8_t> m_dones;
+    std::vector<std::uint8_t> m_actionMasks;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_VEC_ENV_HPP
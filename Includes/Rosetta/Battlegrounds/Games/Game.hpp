@@ -8,8 +8,8 @@
 #define ROSETTASTONE_BATTLEGROUNDS_GAME_HPP
 
 #include <Rosetta/Battlegrounds/Games/GameState.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
 
-#include <atomic>
 #include <tuple>
 #include <vector>
 
@@ -22,13 +22,30 @@ namespace RosettaStone::Battlegrounds
 //! a game mode where eight players face off in 1v1 rounds, with the goal to be
 //! the last player standing. Each round consists of two phases.
 //!
+//! Players refer to the game they play in and minions refer to their players,
+//! so a copy of the game state is made with RefCopyFrom(), which points the
+//! players and minions of the copy to the copy. It makes an independent lobby
+//! to branch on, for example to search actions in the recruit phase.
+//!
 class Game
 {
  public:
+    //! Copies the contents from reference \p rhs and points the players and
+    //! minions to this game. It must not be called during the combat phase.
+    //! The thread pool of this game is kept.
+    //! \param rhs The source to copy the content.
+    void RefCopyFrom(const Game& rhs);
+
     //! Gets the game state.
     //! \return The game state.
     GameState& GetGameState();
 
+    //! Sets the thread pool to simulate battles of the combat phase in
+    //! parallel. It must not be the pool that runs this game as a job.
+    //! \param pool The thread pool, or nullptr to simulate battles on the
+    //! calling thread.
+    void SetThreadPool(ThreadPool* pool);
+
     //! Starts the game.
     void Start();
 
@@ -66,6 +83,28 @@ class Game
     //! \param playerData The player data that stores index and rank.
     void PairPlayers(std::vector<std::tuple<int, int>>& playerData);
 
+    //! Counts a player that selected a hero, and processes the recruit phase
+    //! when all players selected their heroes.
+    void CompleteSelectHero();
+
+    //! Counts a player that completed recruit, and processes the combat phase
+    //! when all remaining players completed recruit.
+    void CompleteRecruit();
+
+    //! Returns the next card index and increases it.
+    //! \return The next card index.
+    int GetNextCardIndex();
+
+    //! Returns the opponent player to fight next.
+    //! \param player The player to find opponent.
+    //! \return The opponent player to fight next.
+    Player& GetOpponentPlayer(const Player& player);
+
+    //! Processes the defeat of \p player: decides the rank, returns the
+    //! minions of the player to the pool and makes it the ghost.
+    //! \param player The player that is defeated.
+    void ProcessDefeat(Player& player);
+
     //! Finds the index of the opponent player to fight next.
     //! \param playerIdx The index of the player to find opponent.
     //! \return The index of the opponent player to fight next.
@@ -76,8 +115,10 @@ class Game
 
     Race m_excludeRace = Race::INVALID;
     std::vector<std::tuple<std::size_t, std::size_t>> m_playerFightPair;
-    std::atomic<int> m_playerCount = 0;
-    std::atomic<int> m_cardIndex = 0;
+    int m_playerCount = 0;
+    int m_cardIndex = 0;
+
+    ThreadPool* m_threadPool = nullptr;
 };
 }  // namespace RosettaStone::Battlegrounds
 
@@ -7,6 +7,7 @@
 #ifndef ROSETTASTONE_BATTLEGROUNDS_BATTLE_HPP
 #define ROSETTASTONE_BATTLEGROUNDS_BATTLE_HPP
 
+#include <Rosetta/Battlegrounds/Models/CombatBoard.hpp>
 #include <Rosetta/Battlegrounds/Models/Player.hpp>
 #include <Rosetta/Common/Enums/GameEnums.hpp>
 
@@ -19,6 +20,14 @@ namespace RosettaStone::Battlegrounds
 //! against their board. There is no player input on this part of the game,
 //! simply letting numbers, strategy, and a bit of luck play out.
 //!
+//! Minions summoned in the battle take card indices from the battle, after
+//! the indices of minions on both fields, so battles of different pairs don't
+//! share a counter.
+//!
+//! The battle keeps a CombatBoard of each battle field to find attackers,
+//! taunts, destroyed minions and triggers with bit masks. Attacks and deaths
+//! update the boards, and tasks make them load again from the battle fields.
+//!
 class Battle
 {
  public:
@@ -31,9 +40,17 @@ class Battle
     //! i.e. decide who goes first, run hero powers
     void Initialize();
 
-    //! Simulates a battle.
+    //! Simulates a battle and applies the damage to the hero of the loser.
     void Run();
 
+    //! Simulates a battle without applying the damage. It changes only the
+    //! battle fields of two players, so battles of different pairs can be
+    //! simulated in parallel.
+    void Simulate();
+
+    //! Applies the damage to the hero of the loser, which can defeat it.
+    void ProcessDamage();
+
     //! Attacks one of the opponent minions.
     //! \return The flag that indicates the attacker does attack.
     bool Attack();
@@ -82,17 +99,53 @@ class Battle
     //! \return The result of battle.
     BattleResult GetResult() const;
 
+    //! Returns the opponent of \p player in the battle.
+    //! \param player The player of the battle.
+    //! \return The opponent of \p player.
+    Player& GetOpponentPlayer(const Player& player) const;
+
+    //! Returns the next card index for a minion summoned in the battle and
+    //! increases it.
+    //! \return The next card index.
+    int GetNextCardIndex();
+
  private:
+    //! Loads the combat boards from the battle fields if they are not loaded
+    //! or a task is running.
+    void LoadBoards();
+
+    //! Marks the start of tasks that can change the battle fields.
+    void BeginTasks();
+
+    //! Marks the end of tasks that can change the battle fields.
+    void EndTasks();
+
+    //! Activates the triggers of turn start of the minions of \p field.
+    //! \param field The battle field.
+    //! \param board The combat board of \p field.
+    void ActivateTurnStartTriggers(FieldZone& field, const CombatBoard& board);
+
+    //! Activates the triggers of the minions that are alive on the death of
+    //! \p deadMinion.
+    //! \param deadMinion The minion that is destroyed.
+    void ActivateDeathTriggers(Minion& deadMinion);
+
     Player& m_player1;
     Player& m_player2;
     FieldZone& m_p1Field;
     FieldZone& m_p2Field;
+    CombatBoard m_p1Board;
+    CombatBoard m_p2Board;
+    bool m_isBoardLoaded = false;
+    int m_numRunningTasks = 0;
 
     int m_p1NextAttackerIdx = 0;
     int m_p2NextAttackerIdx = 0;
+    int m_cardIndex = 0;
 
     Turn m_turn = Turn::DONE;
     BattleResult m_result = BattleResult::DRAW;
+    int m_damage = 0;
 };
 }  // namespace RosettaStone::Battlegrounds
 
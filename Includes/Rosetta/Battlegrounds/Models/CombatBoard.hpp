@@ -0,0 +1,151 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_COMBAT_BOARD_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_COMBAT_BOARD_HPP
+
+#include <Rosetta/Battlegrounds/Zones/FieldZone.hpp>
+#include <Rosetta/Common/Enums/TriggerEnums.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief CombatBoard class.
+//!
+//! This class stores the minions of a field zone in battle as fixed arrays of
+//! attack, health, keywords and trigger types, so that attackers, taunts,
+//! destroyed minions and triggers are found with bit masks of positions
+//! instead of walking the field zone. The masks are kept up to date by Update()
+//! and Remove(). The field zone still owns the minions, so the board must be
+//! updated with the changes of it, or loaded again after tasks run.
+//!
+class CombatBoard
+{
+ public:
+    //! A bit mask of positions. Bit i is the minion at position i.
+    using Mask = std::uint8_t;
+
+    static_assert(MAX_FIELD_SIZE <= 8, "A mask must hold all positions.");
+
+    //! The keyword bit of taunt.
+    static constexpr std::uint8_t TAUNT = 1 << 0;
+
+    //! The keyword bit of divine shield.
+    static constexpr std::uint8_t DIVINE_SHIELD = 1 << 1;
+
+    //! The keyword bit of deathrattle.
+    static constexpr std::uint8_t DEATHRATTLE = 1 << 2;
+
+    //! Loads all minions of \p field.
+    //! \param field The field zone to load.
+    void Load(const FieldZone& field);
+
+    //! Loads \p minion at \p pos again after it changed.
+    //! \param pos The position of minion.
+    //! \param minion The minion at \p pos.
+    void Update(int pos, const Minion& minion);
+
+    //! Removes the minion at \p pos and shifts the minions on its right.
+    //! \param pos The position of minion.
+    void Remove(int pos);
+
+    //! Returns the number of minions.
+    //! \return The number of minions.
+    int GetCount() const;
+
+    //! Returns the attack of the minion at \p pos.
+    //! \param pos The position of minion.
+    //! \return The attack of the minion at \p pos.
+    int GetAttack(int pos) const;
+
+    //! Returns the health of the minion at \p pos.
+    //! \param pos The position of minion.
+    //! \return The health of the minion at \p pos.
+    int GetHealth(int pos) const;
+
+    //! Returns the keyword bits of the minion at \p pos.
+    //! \param pos The position of minion.
+    //! \return The keyword bits of the minion at \p pos.
+    std::uint8_t GetKeywords(int pos) const;
+
+    //! Returns the trigger type of the minion at \p pos.
+    //! \param pos The position of minion.
+    //! \return The trigger type of the minion at \p pos.
+    TriggerType GetTriggerType(int pos) const;
+
+    //! Returns the mask of minions that are not destroyed.
+    //! \return The mask of minions that are not destroyed.
+    Mask GetAliveMask() const;
+
+    //! Returns the mask of minions that are destroyed.
+    //! \return The mask of minions that are destroyed.
+    Mask GetDestroyedMask() const;
+
+    //! Returns the mask of minions that are not destroyed and can attack.
+    //! \return The mask of minions that are not destroyed and can attack.
+    Mask GetAttackerMask() const;
+
+    //! Returns the mask of minions that are not destroyed and have taunt.
+    //! \return The mask of minions that are not destroyed and have taunt.
+    Mask GetTauntMask() const;
+
+    //! Returns the mask of minions that have a trigger of \p type.
+    //! \param type The type of trigger.
+    //! \return The mask of minions that have a trigger of \p type.
+    Mask GetTriggerMask(TriggerType type) const;
+
+    //! Returns the number of bits set in \p mask.
+    //! \param mask The mask.
+    //! \return The number of bits set in \p mask.
+    static int CountBits(Mask mask);
+
+    //! Returns the position of the \p n-th bit set in \p mask.
+    //! \param mask The mask.
+    //! \param n The index of bit set, from 0.
+    //! \return The position of the \p n-th bit set, -1 if there is not.
+    static int FindBit(Mask mask, int n);
+
+    //! Returns the position of the first bit set in \p mask from \p pos,
+    //! wrapping around to position 0.
+    //! \param mask The mask.
+    //! \param pos The position to start.
+    //! \return The position of the bit set, -1 if \p mask is empty.
+    static int FindNextBit(Mask mask, int pos);
+
+ private:
+    //! The number of trigger types, MULTI_TRIGGER is the last one.
+    static constexpr std::size_t NUM_TRIGGER_TYPES =
+        static_cast<std::size_t>(TriggerType::MULTI_TRIGGER) + 1;
+
+    //! Sets or clears the bit of \p pos in \p mask.
+    //! \param mask The mask to change.
+    //! \param pos The position of minion.
+    //! \param value true to set the bit, false to clear it.
+    static void SetBit(Mask& mask, int pos, bool value);
+
+    //! Removes the bit of \p pos from \p mask and shifts the bits above it.
+    //! \param mask The mask to change.
+    //! \param pos The position of minion.
+    static void RemoveBit(Mask& mask, int pos);
+
+    std::array<int, MAX_FIELD_SIZE> m_attack{};
+    std::array<int, MAX_FIELD_SIZE> m_health{};
+    std::array<std::uint8_t, MAX_FIELD_SIZE> m_keywords{};
+    std::array<TriggerType, MAX_FIELD_SIZE> m_triggerTypes{};
+
+    std::array<Mask, NUM_TRIGGER_TYPES> m_triggerMasks{};
+    Mask m_aliveMask = 0;
+    Mask m_attackerMask = 0;
+    Mask m_tauntMask = 0;
+    int m_count = 0;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_COMBAT_BOARD_HPP
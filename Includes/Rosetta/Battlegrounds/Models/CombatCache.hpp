@@ -0,0 +1,180 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
+
+#include <Rosetta/Battlegrounds/Models/CombatEstimator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief CombatCacheStats struct.
+//!
+//! This struct stores the number of lookups of a combat cache.
+//!
+struct CombatCacheStats
+{
+    //! Returns the ratio of lookups that found the results.
+    //! \return The ratio of lookups that found the results.
+    double GetHitRate() const;
+
+    std::size_t numHits = 0;
+    std::size_t numMisses = 0;
+    std::size_t numEvictions = 0;
+};
+
+//!
+//! \brief CombatCache class.
+//!
+//! This class stores the results of CombatEstimator for pairs of boards and
+//! keeps the most recently used ones up to its capacity. A board is keyed by
+//! its canonical form, which covers the tier and, in order of position, the
+//! card, attack, health and keywords of each minion. Enchantments are applied
+//! to the stats and keywords of minions, so they are covered too. Two boards
+//! that differ only in the indices or players of minions share a key.
+//!
+//! Results are looked up by the hashes of the keys, and the keys are stored
+//! with the results and compared on a hit, so a collision of hashes is a
+//! miss instead of the results of another pair.
+//!
+//! Results with fewer runs than requested are estimated again and replaced.
+//! The cache is not thread-safe; the estimator uses the thread pool instead.
+//!
+class CombatCache
+{
+ public:
+    //! \brief BoardKey struct.
+    //!
+    //! This struct is the canonical form of a board with its hash.
+    struct BoardKey
+    {
+        //! \brief Slot struct.
+        //!
+        //! This struct is the canonical form of a minion.
+        struct Slot
+        {
+            int dbfID = 0;
+            int attack = 0;
+            int health = 0;
+            std::uint8_t keywords = 0;
+        };
+
+        //! Operator overloading: operator==.
+        //! \param rhs The key to compare.
+        //! \return true if the boards are equal, false otherwise.
+        bool operator==(const BoardKey& rhs) const;
+
+        std::array<Slot, MAX_FIELD_SIZE> slots{};
+        int tier = 0;
+        int count = 0;
+        std::size_t hash = 0;
+    };
+
+    //! Constructs combat cache with given \p estimator and \p capacity.
+    //! \param estimator The estimator to simulate battles on a miss.
+    //! \param capacity The maximum number of results to store.
+    CombatCache(CombatEstimator& estimator, std::size_t capacity);
+
+    //! Returns the results of the battle between \p board1 and \p board2
+    //! from the cache, or estimates and stores them on a miss.
+    //! \param board1 The board of player 1.
+    //! \param tier1 The Tavern tier of player 1.
+    //! \param board2 The board of player 2.
+    //! \param tier2 The Tavern tier of player 2.
+    //! \param numRuns The minimum number of battles of the results.
+    //! \param seed The seed of random numbers to estimate on a miss.
+    //! \return The results of battles, valid until the next call that adds
+    //! results.
+    const CombatStats& Estimate(const FieldZone& board1, int tier1,
+                                const FieldZone& board2, int tier2,
+                                std::size_t numRuns, std::uint64_t seed = 0);
+
+    //! Finds the results of the pair of boards and marks them as recently
+    //! used. It doesn't count the lookup in the stats.
+    //! \param key1 The key of the board of player 1.
+    //! \param key2 The key of the board of player 2.
+    //! \return The pointer to the results, nullptr if they are not stored.
+    const CombatStats* Find(const BoardKey& key1, const BoardKey& key2);
+
+    //! Stores the results of the pair of boards, evicting the least recently
+    //! used results if the cache is full. It replaces the results of another
+    //! pair whose hashes collide with the pair.
+    //! \param key1 The key of the board of player 1.
+    //! \param key2 The key of the board of player 2.
+    //! \param stats The results of battles.
+    //! \return The reference to the stored results.
+    const CombatStats& Add(const BoardKey& key1, const BoardKey& key2,
+                           const CombatStats& stats);
+
+    //! Removes all results and resets the stats.
+    void Clear();
+
+    //! Returns the number of stored results.
+    //! \return The number of stored results.
+    std::size_t GetSize() const;
+
+    //! Returns the maximum number of results to store.
+    //! \return The maximum number of results to store.
+    std::size_t GetCapacity() const;
+
+    //! Returns the stats of lookups.
+    //! \return The stats of lookups.
+    const CombatCacheStats& GetStats() const;
+
+    //! Returns the canonical key of \p board.
+    //! \param board The board to make the key.
+    //! \param tier The Tavern tier of the owner of \p board.
+    //! \return The canonical key of \p board.
+    static BoardKey MakeKey(const FieldZone& board, int tier);
+
+    //! Returns the canonical hash of \p board.
+    //! \param board The board to hash.
+    //! \param tier The Tavern tier of the owner of \p board.
+    //! \return The canonical hash of \p board.
+    static std::size_t ComputeHash(const FieldZone& board, int tier);
+
+ private:
+    using Key = std::pair<std::size_t, std::size_t>;
+
+    //! \brief Entry struct.
+    //!
+    //! This struct stores the results of a pair of boards with their keys.
+    struct Entry
+    {
+        Key key;
+        BoardKey board1;
+        BoardKey board2;
+        CombatStats stats;
+    };
+
+    //! \brief KeyHash struct.
+    //!
+    //! This struct combines the hashes of a pair of boards.
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    CombatEstimator& m_estimator;
+    std::size_t m_capacity;
+
+    //! Results in order of use, the most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+
+    CombatCacheStats m_stats;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
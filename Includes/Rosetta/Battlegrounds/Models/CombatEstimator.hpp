@@ -0,0 +1,114 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_COMBAT_ESTIMATOR_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_COMBAT_ESTIMATOR_HPP
+
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief CombatStats struct.
+//!
+//! This struct stores the results of battles seen from player 1.
+//! damageDealt[d] is the number of wins that dealt d damage to player 2 and
+//! damageTaken[d] is the number of losses that took d damage from player 2.
+//!
+struct CombatStats
+{
+    //! Returns the probability that player 1 wins.
+    //! \return The probability that player 1 wins.
+    double GetWinRate() const;
+
+    //! Returns the probability of a tie.
+    //! \return The probability of a tie.
+    double GetTieRate() const;
+
+    //! Returns the probability that player 1 loses.
+    //! \return The probability that player 1 loses.
+    double GetLossRate() const;
+
+    //! Returns the expected damage dealt minus the expected damage taken.
+    //! \return The expected damage dealt minus the expected damage taken.
+    double GetExpectedDamage() const;
+
+    //! Adds the results of \p rhs.
+    //! \param rhs The results to add.
+    //! \return The reference of this.
+    CombatStats& operator+=(const CombatStats& rhs);
+
+    std::size_t numRuns = 0;
+    std::size_t numWins = 0;
+    std::size_t numTies = 0;
+    std::size_t numLosses = 0;
+
+    std::array<std::size_t, MAX_BATTLE_DAMAGE + 1> damageDealt{};
+    std::array<std::size_t, MAX_BATTLE_DAMAGE + 1> damageTaken{};
+};
+
+//!
+//! \brief CombatEstimator class.
+//!
+//! This class estimates the outcome of a battle between two boards by
+//! simulating it many times with the thread pool. Runs are split into
+//! chunks of NUM_RUNS_PER_CHUNK and each chunk uses its own stream of random
+//! numbers, so the result depends on the seed only. Each thread reuses its
+//! own pair of players, so repeated estimations don't allocate players and
+//! fields.
+//!
+class CombatEstimator
+{
+ public:
+    //! The number of runs that share a stream of random numbers.
+    static constexpr std::size_t NUM_RUNS_PER_CHUNK = 64;
+
+    //! Constructs combat estimator with given \p pool.
+    //! \param pool The thread pool to simulate battles.
+    explicit CombatEstimator(ThreadPool& pool);
+
+    //! Simulates the battle between \p board1 and \p board2 \p numRuns
+    //! times and returns the results seen from the owner of \p board1.
+    //! \param board1 The board of player 1.
+    //! \param tier1 The Tavern tier of player 1.
+    //! \param board2 The board of player 2.
+    //! \param tier2 The Tavern tier of player 2.
+    //! \param numRuns The number of battles to simulate.
+    //! \param seed The seed of random numbers.
+    //! \return The results of battles.
+    CombatStats Estimate(const FieldZone& board1, int tier1,
+                         const FieldZone& board2, int tier2,
+                         std::size_t numRuns, std::uint64_t seed = 0);
+
+ private:
+    //! Slot struct.
+    //! This struct holds the players that a thread simulates battles with.
+    struct Slot
+    {
+        Player player1;
+        Player player2;
+        CombatStats stats;
+    };
+
+    //! Copies \p board into the field of \p player of \p slot.
+    //! \param slot The slot.
+    //! \param player The player of the slot.
+    //! \param board The board to copy.
+    //! \param tier The Tavern tier of the player.
+    static void SetBoard(Slot& slot, Player& player, const FieldZone& board,
+                         int tier);
+
+    ThreadPool& m_pool;
+    std::vector<Slot> m_slots;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_COMBAT_ESTIMATOR_HPP
@@ -22,6 +22,10 @@ namespace RosettaStone::Battlegrounds
 //! displayed on a yellow sword, in the bottom left corner) and Health (a number
 //! displayed on a red blood drop, in the bottom right corner).
 //!
+//! A minion refers to its card instead of owning a copy of it, so it is cheap
+//! to copy. The card must outlive the minion, so it should be one of the cards
+//! stored in Cards.
+//!
 class Minion
 {
  public:
@@ -31,7 +35,11 @@ class Minion
     //! Constructs Minion instance with given \p card and \p poolIdx.
     //! \param card A card that contains the minion data.
     //! \param poolIdx The index of minion pool.
-    explicit Minion(Card card, int poolIdx = -1);
+    explicit Minion(const Card& card, int poolIdx = -1);
+
+    //! Deleted constructor to prevent a minion from referring to a temporary
+    //! card.
+    explicit Minion(Card&& card, int poolIdx = -1) = delete;
 
     //! Returns the value of index.
     //! \return The value of index.
@@ -45,6 +53,22 @@ class Minion
     //! \return The value of pool index.
     int GetPoolIndex() const;
 
+    //! Sets the value of pool index.
+    //! \param poolIdx The value of pool index.
+    void SetPoolIndex(int poolIdx);
+
+    //! Returns the player that owns the minion.
+    //! \return The player that owns the minion.
+    Player& GetPlayer() const;
+
+    //! Sets the player that owns the minion.
+    //! \param player The player that owns the minion.
+    void SetPlayer(Player& player);
+
+    //! Returns the card of minion.
+    //! \return The card of minion.
+    const Card& GetCard() const;
+
     //! Returns the value of name.
     //! \return The value of name.
     std::string_view GetName() const;
@@ -155,6 +179,11 @@ class Minion
     //! \return true if the targeting type is valid, false otherwise.
     bool CheckTargetingType(Minion& target);
 
+    //! Returns the type of trigger of the card.
+    //! \return The type of trigger of the card, TriggerType::NONE if the card
+    //! has no trigger.
+    TriggerType GetTriggerType() const;
+
     //! Activates the trigger.
     //! \param type The type of trigger.
     //! \param source The source of trigger.
@@ -171,17 +200,14 @@ class Minion
     //! \param target The target.
     void ActivateTask(PowerType type, Player& player, Minion& target);
 
-    Trigger activatedTrigger;
-
-    std::function<Player&()> getPlayerCallback;
-
  private:
     //! Gets a list of tasks according to the power type.
     //! \param type The type of power.
     //! \return A list of tasks according to the power type.
-    std::vector<TaskType> GetTasks(PowerType type);
+    std::vector<TaskType> GetTasks(PowerType type) const;
 
-    Card m_card;
+    const Card* m_card = nullptr;
+    Player* m_player = nullptr;
     int m_index = -1;
     int m_poolIdx = -1;
 
@@ -192,6 +218,8 @@ class Minion
     int m_attack = 0;
     int m_health = 0;
 
+    TriggerType m_triggerType = TriggerType::NONE;
+
     bool m_hasDeathrattle = false;
     bool m_hasTaunt = false;
     bool m_hasDivineShield = false;
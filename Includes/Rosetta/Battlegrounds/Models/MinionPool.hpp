@@ -16,12 +16,16 @@
 
 namespace RosettaStone::Battlegrounds
 {
-using MinionPoolData = std::tuple<Minion, int, bool>;
-
 //!
 //! \brief MinionPool class.
 //!
 //! This class stores a list of minion in pool for Hearthstone: Battlegrounds.
+//! Minions are stored in order of tier, and a Fenwick tree over the flags of
+//! minions in the pool counts the available minions up to a tier. It draws
+//! a minion for the tavern and returns a minion in O(log n) without building
+//! a list of candidates. The pool stores pointers to minions made once per
+//! card and copies one when it is drawn, so copying the pool copies plain
+//! arrays.
 //!
 class MinionPool
 {
@@ -39,6 +43,11 @@ class MinionPool
     //! \param tavern The tavern to add minions.
     void AddMinionsToTavern(Player& player, Tavern& tavern);
 
+    //! Returns the count of minions in the pool up to \p maxTier.
+    //! \param maxTier The maximum number of tier.
+    //! \return The count of minions in the pool up to \p maxTier.
+    int GetNumAvailableMinions(int maxTier) const;
+
     //! Returns a minion to the pool.
     //! \param idx The pool index of a minion.
     void ReturnMinion(int idx);
@@ -52,7 +61,26 @@ class MinionPool
     std::vector<Minion> GetMinions(int minTier, int maxTier, bool isInPoolOnly);
 
  private:
-    std::array<MinionPoolData, NUM_TOTAL_TAVERN_MINIONS> m_minions;
+    //! Adds \p delta to the count of the minion at \p idx in the tree.
+    //! \param idx The pool index of a minion.
+    //! \param delta The value to add.
+    void UpdateTree(int idx, int delta);
+
+    //! Returns the count of minions in the pool whose pool index is less than
+    //! \p end.
+    //! \param end The end of pool index.
+    //! \return The count of minions in the pool before \p end.
+    int GetPrefixCount(int end) const;
+
+    //! Returns the pool index of the \p n-th minion in the pool.
+    //! \param n The index of minion in the pool, from 0.
+    //! \return The pool index of the \p n-th minion in the pool.
+    int FindMinion(int n) const;
+
+    std::array<const Minion*, NUM_TOTAL_TAVERN_MINIONS> m_prototypes{};
+    std::array<bool, NUM_TOTAL_TAVERN_MINIONS> m_isInPool{};
+    std::array<int, NUM_TOTAL_TAVERN_MINIONS + 1> m_tree{};
+    std::array<int, TIER_UPPER_LIMIT + 1> m_tierEnds{};
     std::size_t m_count = 0;
 };
 }  // namespace RosettaStone::Battlegrounds
@@ -14,18 +14,23 @@
 #include <Rosetta/Battlegrounds/Zones/HandZone.hpp>
 
 #include <array>
-#include <functional>
 #include <limits>
 
 namespace RosettaStone::Battlegrounds
 {
 class Battle;
+class Game;
+class LegalActions;
 
 //!
 //! \brief Player class.
 //!
 //! This class stores various information that used in Battlegrounds.
 //!
+//! A player refers to the game it plays in and the battle it fights in, and
+//! calls them directly for the operations that change the lobby, such as
+//! drawing minions from the pool or advancing the phase.
+//!
 class Player
 {
  public:
@@ -72,9 +77,26 @@ class Player
     //! Completes recruit phase.
     void CompleteRecruit() const;
 
+    //! Writes the legal actions of recruit phase into \p actions.
+    //! It considers coins, tier, hand, field and Tavern of the player, so it
+    //! must be called in recruit phase only.
+    //! \param actions The buffer to write, cleared before writing.
+    //! \return The number of legal actions.
+    std::size_t GetLegalActions(LegalActions& actions);
+
     //! Processes the tasks related to defeat.
     void ProcessDefeat();
 
+    //! Returns the opponent player of the battle, or the player to fight next
+    //! in recruit phase.
+    //! \return The opponent player.
+    Player& GetOpponentPlayer();
+
+    //! Returns the next card index of the battle, or the game in recruit
+    //! phase.
+    //! \return The next card index.
+    int GetNextCardIndex();
+
     PlayState playState = PlayState::INVALID;
     std::size_t idx = 0;
     std::size_t rank = 1;
@@ -93,17 +115,8 @@ class Player
 
     TaskStack taskStack;
 
-    std::function<void(Player&)> selectHeroCallback;
-    std::function<void(Player&)> prepareTavernMinionsCallback;
-    std::function<void(Player&, std::size_t)> purchaseMinionCallback;
-    std::function<int()> getNextCardIndexCallback;
-    std::function<void(int)> returnMinionCallback;
-    std::function<void(Player&)> clearTavernMinionsCallback;
-    std::function<void(Player&)> upgradeTavernCallback;
-    std::function<void()> completeRecruitCallback;
-    std::function<Player&(Player&)> getOpponentPlayerCallback;
-    std::function<Battle&()> getBattleCallback;
-    std::function<void(Player&)> processDefeatCallback;
+    Game* game = nullptr;
+    Battle* battle = nullptr;
 
     std::array<int, 4> heroChoices{ 0, 0, 0, 0 };
 
@@ -31,6 +31,10 @@ class Spell
     //! \param card A card that contains the spell data.
     explicit Spell(Card card);
 
+    //! Returns the card of spell.
+    //! \return The card of spell.
+    const Card& GetCard() const;
+
     //! Returns the value of zone type.
     //! \return The value of zone type.
     ZoneType GetZoneType() const;
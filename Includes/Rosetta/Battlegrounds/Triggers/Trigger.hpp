@@ -55,12 +55,13 @@ class Trigger
     //! sequence starts.
     //! \param owner The owner of trigger.
     //! \param source The source of trigger.
-    void Validate(Minion& owner, Minion& source);
+    //! \return true if the trigger is valid, false otherwise.
+    bool Validate(Minion& owner, Minion& source) const;
 
     //! Runs trigger logic internally.
     //! \param owner The owner of trigger.
     //! \param source The source of trigger.
-    void Run(Minion& owner, Minion& source);
+    void Run(Minion& owner, Minion& source) const;
 
  private:
     TriggerType m_triggerType = TriggerType::NONE;
@@ -68,8 +69,6 @@ class Trigger
 
     std::vector<TaskType> m_tasks;
     std::optional<SelfCondition> m_condition;
-
-    bool m_isValidated = false;
 };
 }  // namespace RosettaStone::Battlegrounds
 
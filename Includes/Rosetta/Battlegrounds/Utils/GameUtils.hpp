@@ -11,10 +11,20 @@
 
 namespace RosettaStone::Battlegrounds
 {
+class Game;
+
 //! Returns the number of minions that can purchase in Tavern.
 //! \param tier The current tier of the player.
 //! \return The number of minions that can purchase in Tavern.
 std::size_t GetNumMinionsCanPurchase(int tier);
+
+//! Plays \p numRounds rounds of \p game with simple actions. Each player in
+//! the game purchases the first minion in Tavern, plays the first card in
+//! hand and completes the recruit phase. It stops early if the game leaves
+//! the recruit phase.
+//! \param game The game to play.
+//! \param numRounds The number of rounds to play.
+void PlaySimpleRounds(Game& game, int numRounds);
 }  // namespace RosettaStone::Battlegrounds
 
 #endif  // ROSETTASTONE_BATTLEGROUNDS_GAME_UTILS_HPP
@@ -104,6 +104,12 @@ constexpr int MAX_HAND_SIZE = 10;
 //! The maximum number of secrets in secret zone.
 constexpr int MAX_SECERT_SIZE = 5;
 
+//! The maximum number of turns in a game. After it, the game ends in a draw.
+constexpr int MAX_GAME_TURN = 89;
+
+//! The maximum number of tasks that an agent processes in a turn.
+constexpr int MAX_AGENT_TASKS_PER_TURN = 100;
+
 //! The number of players in Battlegrounds.
 constexpr int NUM_BATTLEGROUNDS_PLAYERS = 8;
 
@@ -406,6 +412,9 @@ constexpr int TIER_UPPER_LIMIT = 6;
 //! The maximum number of coin.
 constexpr int COIN_UPPER_LIMIT = 10;
 
+//! The maximum damage of a battle: the tiers of minions and the hero.
+constexpr int MAX_BATTLE_DAMAGE = (MAX_FIELD_SIZE + 1) * TIER_UPPER_LIMIT;
+
 //! The number of menus in main phase.
 //! \note We will refactor it soon.
 constexpr int GAME_MAIN_MENU_SIZE = 3;
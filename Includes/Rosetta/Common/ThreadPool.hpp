@@ -0,0 +1,86 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_THREAD_POOL_HPP
+#define ROSETTASTONE_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief ThreadPool class.
+//!
+//! This class owns a fixed number of worker threads and runs a list of
+//! independent jobs on them. The calling thread also takes part in running
+//! jobs, so a pool with one thread runs all jobs on the calling thread.
+//!
+class ThreadPool
+{
+ public:
+    //! Constructs thread pool with given \p numThreads.
+    //! \param numThreads The number of threads including the calling thread.
+    //! If it is 0, the number of hardware threads is used.
+    explicit ThreadPool(std::size_t numThreads = 0);
+
+    //! Destructor. Stops and joins all worker threads.
+    ~ThreadPool();
+
+    //! Deleted copy constructor.
+    ThreadPool(const ThreadPool&) = delete;
+
+    //! Deleted move constructor.
+    ThreadPool(ThreadPool&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Deleted move assignment operator.
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+    //! Returns the number of threads including the calling thread.
+    //! \return The number of threads including the calling thread.
+    std::size_t GetNumThreads() const;
+
+    //! Runs \p func for each index in [0, \p count) and waits for all of them.
+    //! If any job throws, the remaining jobs are skipped and the first
+    //! exception is rethrown. It must not be called from inside a job.
+    //! \param count The number of jobs.
+    //! \param func The job to run with its index.
+    void ParallelFor(std::size_t count,
+                     const std::function<void(std::size_t)>& func);
+
+ private:
+    //! Waits for jobs and runs them until the pool is stopped.
+    void WorkerLoop();
+
+    //! Runs jobs of the current batch until all of them are taken.
+    void RunJobs();
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_callMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_startCond;
+    std::condition_variable m_finishCond;
+
+    const std::function<void(std::size_t)>* m_func = nullptr;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_nextIdx = 0;
+    std::size_t m_numBusyThreads = 0;
+    std::size_t m_generation = 0;
+    std::exception_ptr m_exception;
+    bool m_isStopped = false;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_THREAD_POOL_HPP
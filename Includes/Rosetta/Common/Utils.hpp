@@ -10,11 +10,13 @@
 #include <effolkronium/random.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <random>
 #include <string>
 #include <vector>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 //! Checks all conditions are true.
 //! \param t A value to check that it is true.
@@ -173,9 +175,32 @@ inline bool EndsWith(const std::string& value, const std::string& ending)
     return std::equal(ending.rbegin(), ending.rend(), value.rbegin());
 }
 
+//! Seeds the random number generator of the calling thread with the stream
+//! \p idx derived from \p seed. A job that seeds with its own index gets the
+//! same random numbers regardless of the thread that runs it.
+//! \param seed The base seed.
+//! \param idx The index of stream.
+inline void SeedRandom(std::uint64_t seed, std::uint64_t idx)
+{
+    // NOTE: It mixes bits with SplitMix64 so that close seeds are spread.
+    std::uint64_t z = seed + (idx + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+
+    std::seed_seq seq{ static_cast<std::uint32_t>(z),
+                       static_cast<std::uint32_t>(z >> 32) };
+    Random::seed(seq);
+}
+
 //! Decodes Base64 based string.
 //! \param src Base64 based string.
 //! \return A unsigned char type container consists of decoded string.
 std::vector<unsigned char> DecodeBase64(std::string_view src);
 
+//! Encodes bytes into Base64 based string with padding.
+//! \param src The bytes to encode.
+//! \return Base64 based string.
+std::string EncodeBase64(const std::vector<unsigned char>& src);
+
 #endif  // ROSETTASTONE_UTILS_HPP
@@ -80,7 +80,7 @@ class DeckInfo
 
     //! Returns a list of card IDs.
     //! \return A list of card IDs.
-    std::vector<std::string> GetCardIDs();
+    std::vector<std::string> GetCardIDs() const;
 
  private:
     std::string m_name;
@@ -0,0 +1,58 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_RANDOM_AGENT_HPP
+#define ROSETTASTONE_PLAYMODE_RANDOM_AGENT_HPP
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Tasks/ITask.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief RandomAgent class.
+//!
+//! This class selects a task uniformly at random among the tasks that pass
+//! the legality checks of the engine. It is used as a playout policy to
+//! simulate many games quickly.
+//!
+class RandomAgent
+{
+ public:
+    //! Returns a list of tasks that the player can process in current state.
+    //! \param player The player to process tasks.
+    //! \return A list of tasks that the player can process.
+    static std::vector<std::unique_ptr<ITask>> GetValidTasks(Player* player);
+
+    //! Returns a task randomly selected among valid tasks.
+    //! \param player The player to process a task.
+    //! \return A task randomly selected among valid tasks.
+    static std::unique_ptr<ITask> GetRandomTask(Player* player);
+
+    //! Processes mulligan of both players if the game waits for it.
+    //! Players that have no mulligan choice are skipped, and the rest keep
+    //! all cards in their hand.
+    //! \param game The game context.
+    static void ProcessMulligan(Game& game);
+
+    //! Plays the turn of current player until the turn ends or the game is
+    //! over. Ends the turn if the player processes too many tasks, since
+    //! some tasks fail silently and don't change the state of the game.
+    //! \param game The game context.
+    static void PlayTurn(Game& game);
+
+    //! Plays the game until it is over. Both players are controlled by the
+    //! agent. The game must be created with autoRun enabled.
+    //! \param game The game context.
+    //! \return The play state of player 1 at the end of the game.
+    static PlayState PlayGame(Game& game);
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_RANDOM_AGENT_HPP
@@ -0,0 +1,139 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_CARD_FEATURES_HPP
+#define ROSETTASTONE_PLAYMODE_CARD_FEATURES_HPP
+
+#include <Rosetta/Common/Enums/CardEnums.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Card;
+
+//!
+//! \brief CardFeatures class.
+//!
+//! This class exports all cards as a contiguous row-major matrix of int32
+//! features. Row i is the card at index i and the columns are dbfID, cost,
+//! attack, health, card type, card class, race, rarity, card set and the
+//! keyword bitset. Health is the durability for weapons and bit k of the
+//! keyword bitset is set if the card has KEYWORDS[k].
+//!
+//! Cards are sorted by dbfID, so the index of a card doesn't depend on the
+//! order in which cards are loaded.
+//!
+//! A file written by Save() starts with a header of 16 bytes (the magic
+//! "RSCFEAT1", the number of cards and the number of features as uint32) and
+//! is followed by the matrix, so it can be memory-mapped with the offset of
+//! the header.
+//!
+class CardFeatures
+{
+ public:
+    //! The column of dbfID.
+    static constexpr std::size_t DBF_ID = 0;
+
+    //! The column of cost.
+    static constexpr std::size_t COST = 1;
+
+    //! The column of attack.
+    static constexpr std::size_t ATTACK = 2;
+
+    //! The column of health or durability.
+    static constexpr std::size_t HEALTH = 3;
+
+    //! The column of card type.
+    static constexpr std::size_t CARD_TYPE = 4;
+
+    //! The column of card class.
+    static constexpr std::size_t CARD_CLASS = 5;
+
+    //! The column of race.
+    static constexpr std::size_t RACE = 6;
+
+    //! The column of rarity.
+    static constexpr std::size_t RARITY = 7;
+
+    //! The column of card set.
+    static constexpr std::size_t CARD_SET = 8;
+
+    //! The column of keyword bitset.
+    static constexpr std::size_t KEYWORD_BITS = 9;
+
+    //! The number of features of a card.
+    static constexpr std::size_t NUM_FEATURES = 10;
+
+    //! The size of the header of a file in bytes.
+    static constexpr std::size_t HEADER_SIZE = 16;
+
+    //! The keywords of the keyword bitset.
+    static constexpr std::array<GameTag, 31> KEYWORDS = {
+        GameTag::TAUNT,      GameTag::DIVINE_SHIELD, GameTag::CHARGE,
+        GameTag::RUSH,       GameTag::WINDFURY,      GameTag::STEALTH,
+        GameTag::POISONOUS,  GameTag::LIFESTEAL,     GameTag::DEATHRATTLE,
+        GameTag::BATTLECRY,  GameTag::SECRET,        GameTag::QUEST,
+        GameTag::SIDEQUEST,  GameTag::FREEZE,        GameTag::SPELLPOWER,
+        GameTag::REBORN,     GameTag::COMBO,         GameTag::OVERLOAD,
+        GameTag::DISCOVER,   GameTag::CHOOSE_ONE,    GameTag::ECHO,
+        GameTag::MODULAR,    GameTag::TWINSPELL,     GameTag::OUTCAST,
+        GameTag::SPELLBURST, GameTag::INSPIRE,       GameTag::IMMUNE,
+        GameTag::CANT_ATTACK, GameTag::SILENCE,      GameTag::ADAPT,
+        GameTag::CORRUPT
+    };
+
+    //! Constructs card features with given \p cards.
+    //! \param cards A list of cards to export.
+    explicit CardFeatures(const std::vector<Card*>& cards);
+
+    //! Returns the features of all cards in Cards::GetAllCards().
+    //! They are built once and shared by all callers.
+    //! \return The features of all cards.
+    static const CardFeatures& GetInstance();
+
+    //! Returns the number of cards.
+    //! \return The number of cards.
+    std::size_t GetNumCards() const;
+
+    //! Returns the matrix of features (GetNumCards() x NUM_FEATURES).
+    //! \return The matrix of features.
+    const std::int32_t* GetData() const;
+
+    //! Returns the card at \p index.
+    //! \param index The index of card.
+    //! \return The card at \p index.
+    Card* GetCard(std::size_t index) const;
+
+    //! Returns the index of the card that has \p dbfID. It reads a table
+    //! indexed by dbfID, so it is cheap enough for hot paths.
+    //! \param dbfID The dbfID of card.
+    //! \return The index of the card that has \p dbfID.
+    std::size_t GetIndexByDbfID(int dbfID) const;
+
+    //! Returns the index of the card that has \p id.
+    //! \param id The ID of card.
+    //! \return The index of the card that has \p id.
+    std::size_t GetIndexByID(const std::string& id) const;
+
+    //! Writes the header and the matrix of features to \p path.
+    //! \param path The path of file to write.
+    void Save(const std::string& path) const;
+
+ private:
+    std::vector<Card*> m_cards;
+    std::vector<std::int32_t> m_data;
+    std::vector<std::size_t> m_dbfIDToIndex;
+    std::unordered_map<std::string, std::size_t> m_idToIndex;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_CARD_FEATURES_HPP
@@ -10,6 +10,7 @@
 #include <Rosetta/Common/Constants.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
 
+#include <unordered_map>
 #include <vector>
 
 namespace RosettaStone::PlayMode
@@ -183,6 +184,7 @@ class Cards
     static std::vector<Card*> m_allStandardCards;
     static std::vector<Card*> m_allWildCards;
     static std::vector<Card*> m_lackeys;
+    static std::unordered_map<int, Card*> m_dbfIDToCard;
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -66,6 +66,7 @@ class BoolAttr : public Attr<T>
 
         const int target = Attr<T>::GetAuraValue(auraEffects);
         Attr<T>::SetAuraValue(auraEffects, target + 1);
+        entity->IncreaseNumChanges();
     }
 
     //! Removes the aura that affects the attribute.
@@ -77,6 +78,7 @@ class BoolAttr : public Attr<T>
     {
         const int target = Attr<T>::GetAuraValue(entity->auraEffects);
         Attr<T>::SetAuraValue(entity->auraEffects, target - 1);
+        entity->IncreaseNumChanges();
     }
 
  protected:
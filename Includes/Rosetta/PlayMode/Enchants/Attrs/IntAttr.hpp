@@ -103,6 +103,8 @@ class IntAttr : public Attr<T>
                 SetAuraValue(auraEffects, value);
                 break;
         }
+
+        entity->IncreaseNumChanges();
     }
 
     //! Removes the aura that affects the attribute.
@@ -128,6 +130,8 @@ class IntAttr : public Attr<T>
                 throw std::invalid_argument(
                     "IntAttr::RemoveAura() - Invalid effect operator!");
         }
+
+        entity->IncreaseNumChanges();
     }
 
  protected:
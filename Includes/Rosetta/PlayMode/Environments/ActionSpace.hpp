@@ -0,0 +1,167 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_ACTION_SPACE_HPP
+#define ROSETTASTONE_PLAYMODE_ACTION_SPACE_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/PlayMode/Tasks/ITask.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace RosettaStone::PlayMode
+{
+class Character;
+class Player;
+
+//! \brief An enumerator for identifying the type of action.
+enum class ActionType
+{
+    PLAY_CARD,
+    ATTACK,
+    HERO_POWER,
+    CHOOSE,
+    END_TURN
+};
+
+//!
+//! \brief ActionSpace class.
+//!
+//! This class defines a fixed discrete action space of a player. Actions are
+//! laid out in the following order:
+//!
+//! - Play card: hand position x target x field position x choose one
+//! - Attack: attacker x defender
+//! - Hero power: target
+//! - Choose: the index of choice
+//! - End turn
+//!
+//! A target is one of no target, the hero of the player, the minions of the
+//! player, the hero of the opponent and the minions of the opponent. An
+//! attacker is the hero or a minion of the player and a defender is the hero
+//! or a minion of the opponent. The hero takes index 0 and the minion at
+//! position i takes index i + 1 in both cases.
+//!
+//! The action mask is made with the same legality checks as the game, and
+//! Decode() returns the task that the game processes for an action.
+//!
+class ActionSpace
+{
+ public:
+    //! The number of targets: no target, own hero and minions, opponent hero
+    //! and minions.
+    static constexpr std::size_t NUM_TARGETS = 2 * (MAX_FIELD_SIZE + 1) + 1;
+
+    //! The number of choose one options: none, first and second.
+    static constexpr std::size_t NUM_CHOOSE_ONES = 3;
+
+    //! The number of characters that attack or defend.
+    static constexpr std::size_t NUM_CHARACTERS = MAX_FIELD_SIZE + 1;
+
+    //! The maximum number of choices.
+    static constexpr std::size_t NUM_CHOICES = 5;
+
+    //! The offset of play card actions.
+    static constexpr std::size_t PLAY_CARD_OFFSET = 0;
+
+    //! The offset of attack actions.
+    static constexpr std::size_t ATTACK_OFFSET =
+        PLAY_CARD_OFFSET +
+        MAX_HAND_SIZE * NUM_TARGETS * MAX_FIELD_SIZE * NUM_CHOOSE_ONES;
+
+    //! The offset of hero power actions.
+    static constexpr std::size_t HERO_POWER_OFFSET =
+        ATTACK_OFFSET + NUM_CHARACTERS * NUM_CHARACTERS;
+
+    //! The offset of choose actions.
+    static constexpr std::size_t CHOOSE_OFFSET =
+        HERO_POWER_OFFSET + NUM_TARGETS;
+
+    //! The end turn action.
+    static constexpr std::size_t END_TURN = CHOOSE_OFFSET + NUM_CHOICES;
+
+    //! The number of actions.
+    static constexpr std::size_t SIZE = END_TURN + 1;
+
+    //! Returns the play card action.
+    //! \param handPos The position of card in hand.
+    //! \param target The index of target.
+    //! \param fieldPos The position of minion to place on the field.
+    //! \param chooseOne The index of chosen card from two cards.
+    //! \return The play card action.
+    static constexpr std::size_t PlayCardAction(std::size_t handPos,
+                                                std::size_t target,
+                                                std::size_t fieldPos,
+                                                std::size_t chooseOne)
+    {
+        return PLAY_CARD_OFFSET +
+               ((handPos * NUM_TARGETS + target) * MAX_FIELD_SIZE + fieldPos) *
+                   NUM_CHOOSE_ONES +
+               chooseOne;
+    }
+
+    //! Returns the attack action.
+    //! \param attacker The index of attacker.
+    //! \param defender The index of defender.
+    //! \return The attack action.
+    static constexpr std::size_t AttackAction(std::size_t attacker,
+                                              std::size_t defender)
+    {
+        return ATTACK_OFFSET + attacker * NUM_CHARACTERS + defender;
+    }
+
+    //! Returns the hero power action.
+    //! \param target The index of target.
+    //! \return The hero power action.
+    static constexpr std::size_t HeroPowerAction(std::size_t target)
+    {
+        return HERO_POWER_OFFSET + target;
+    }
+
+    //! Returns the choose action.
+    //! \param choice The index of choice.
+    //! \return The choose action.
+    static constexpr std::size_t ChooseAction(std::size_t choice)
+    {
+        return CHOOSE_OFFSET + choice;
+    }
+
+    //! Returns the type of \p action.
+    //! \param action The action.
+    //! \return The type of \p action.
+    static ActionType GetActionType(std::size_t action);
+
+    //! Writes the mask of legal actions of \p player into \p mask.
+    //! \param player The player to act.
+    //! \param mask The buffer that has at least SIZE values.
+    //! \return The number of legal actions.
+    static std::size_t GetActionMask(Player& player, std::uint8_t* mask);
+
+    //! Returns the task of \p action.
+    //! \param player The player to act.
+    //! \param action The action.
+    //! \return The task of \p action.
+    static std::unique_ptr<ITask> Decode(Player& player, std::size_t action);
+
+ private:
+    //! Returns the character of \p target.
+    //! \param player The player to act.
+    //! \param target The index of target.
+    //! \return The character of \p target or nullptr if it is empty.
+    static Character* GetTarget(const Player& player, std::size_t target);
+
+    //! Returns the index of \p character as a target.
+    //! \param player The player to act.
+    //! \param character The character.
+    //! \return The index of \p character as a target.
+    static std::size_t GetTargetIndex(const Player& player,
+                                      const Character* character);
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_ACTION_SPACE_HPP
@@ -0,0 +1,123 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_DELTA_ENCODER_HPP
+#define ROSETTASTONE_PLAYMODE_DELTA_ENCODER_HPP
+
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Entity;
+
+//!
+//! \brief DeltaEncoder class.
+//!
+//! This class encodes a game with the same layout as ObservationEncoder, but
+//! it keeps the buffer of the previous call and re-encodes only the slots
+//! that changed since then. Entities and players count writes of their game
+//! tags and aura effects, and zone changes move entities between slots, so a
+//! slot is changed if the ID of its entity or the number of changes of the
+//! entity differs from the cached one. Slots are keyed by entity ID rather
+//! than by address, since a new entity can be allocated at the address of a
+//! removed one. Values that depend on other entities are handled
+//! conservatively: all slots are changed when the current player changes,
+//! and cards with a cost manager are always re-encoded.
+//!
+//! An encoder caches the state of one game, so call Reset() when the game or
+//! the buffer is replaced.
+//!
+class DeltaEncoder
+{
+ public:
+    //! A range of changed values: the first index and one past the last.
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    //! Constructs delta encoder with given \p playerType and \p isFiltered.
+    //! \param playerType The type of the player to observe the game.
+    //! \param isFiltered The flag that indicates whether to hide unknown
+    //! entities of the opponent.
+    explicit DeltaEncoder(PlayerType playerType, bool isFiltered = true);
+
+    //! Forgets the previous encoding, so the next call writes all values.
+    void Reset();
+
+    //! Re-encodes the changed slots of \p game into \p buffer.
+    //! \param game The game to encode.
+    //! \param buffer The buffer that has at least ObservationEncoder::SIZE
+    //! values and holds the result of the previous call.
+    template <typename T>
+    void Encode(const Game& game, T* buffer);
+
+    //! Returns the ranges of values that the last call to Encode() wrote.
+    //! \return The ranges of changed values in ascending order.
+    const std::vector<Range>& GetChangedRanges() const;
+
+ private:
+    //! Slot struct.
+    //! This struct holds the ID of an entity of a slot, or -1 for an empty
+    //! slot, and its number of changes.
+    struct Slot
+    {
+        int entityID = -1;
+        std::size_t numChanges = 0;
+    };
+
+    //! PlayerCache struct.
+    //! This struct holds the slots of the block of a player.
+    struct PlayerCache
+    {
+        std::size_t numChanges = 0;
+        std::array<int, 4> counts{};
+        Slot hero;
+        Slot heroPower;
+        Slot weapon;
+        std::array<Slot, MAX_FIELD_SIZE> field;
+        std::array<Slot, MAX_HAND_SIZE> hand;
+        std::array<Slot, MAX_SECERT_SIZE> secrets;
+    };
+
+    //! Re-encodes the changed slots of the block of \p player.
+    //! \param player The player to encode.
+    //! \param observer The player to observe the game or nullptr to encode
+    //! all entities.
+    //! \param cache The cache of the block.
+    //! \param offset The offset of the block in \p buffer.
+    //! \param buffer The buffer of the observation.
+    template <typename T>
+    void EncodePlayer(const Player& player, const Player* observer,
+                      PlayerCache& cache, std::size_t offset, T* buffer);
+
+    //! Stores \p entity into \p slot.
+    //! \param slot The slot to update.
+    //! \param entity The entity of the slot or nullptr for an empty slot.
+    //! \return The flag that indicates whether the slot changed.
+    static bool UpdateSlot(Slot& slot, const Entity* entity);
+
+    //! Adds the range of \p size values from \p offset to changed ranges.
+    //! \param offset The first index of the range.
+    //! \param size The number of values of the range.
+    void AddRange(std::size_t offset, std::size_t size);
+
+    PlayerType m_playerType = PlayerType::PLAYER1;
+    bool m_isFiltered = true;
+
+    bool m_isDirty = true;
+    bool m_isCurrentChanged = false;
+    const Game* m_game = nullptr;
+    std::array<int, ObservationEncoder::GLOBAL_SIZE> m_global{};
+    std::array<PlayerCache, 2> m_caches;
+
+    std::vector<Range> m_changedRanges;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_DELTA_ENCODER_HPP
@@ -0,0 +1,38 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_INFORMATION_FILTER_HPP
+#define ROSETTASTONE_PLAYMODE_INFORMATION_FILTER_HPP
+
+namespace RosettaStone::PlayMode
+{
+class Playable;
+class Player;
+
+//!
+//! \brief InformationFilter class.
+//!
+//! This class decides which entities a player can see. A player knows its
+//! own entities and the entities in public zones such as the field, the
+//! graveyard and the hero. An entity of the opponent in the hand, the deck or
+//! the secret zone is known only if it is revealed, it is a quest in the
+//! secret zone or it was created by an entity of the player.
+//!
+//! The filter only reads tags of the entity, so it can be applied to the live
+//! game without cloning it.
+//!
+class InformationFilter
+{
+ public:
+    //! Returns the flag that indicates whether \p observer knows \p playable.
+    //! \param observer The player to observe the game.
+    //! \param playable The entity to check.
+    //! \return The flag that indicates whether \p observer knows \p playable.
+    static bool IsVisible(const Player& observer, const Playable& playable);
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_INFORMATION_FILTER_HPP
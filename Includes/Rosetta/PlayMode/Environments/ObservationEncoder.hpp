@@ -0,0 +1,151 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
+#define ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+
+#include <cstddef>
+
+namespace RosettaStone::PlayMode
+{
+class Game;
+class Minion;
+class Playable;
+class Player;
+class Spell;
+
+//!
+//! \brief ObservationEncoder class.
+//!
+//! This class encodes a game from the perspective of a player into a tensor
+//! with a fixed layout. The tensor starts with global values and is followed
+//! by the block of the player and the block of the opponent. Each block has
+//! the following sections in order:
+//!
+//! - Hero: health, base health, armor, attack, can attack
+//! - Weapon: exists, attack, durability
+//! - Hero power: cost, is exhausted
+//! - Mana: total, used, temporary, remaining, overload owed, overload locked
+//! - Counts: hand, deck, field, secret
+//! - Field: MAX_FIELD_SIZE slots of minion values
+//! - Hand: MAX_HAND_SIZE slots of exists, card index and cost
+//! - Secret: MAX_SECERT_SIZE slots of exists, card index and card class
+//!
+//! The card index is the row of the card in CardFeatures plus one, so it can
+//! look up the features of the card directly and 0 means no card. Empty
+//! slots are all zeros.
+//! The encoder writes into a buffer of the caller, so it doesn't allocate.
+//!
+//! By default, the encoder hides the entities of the opponent that the
+//! player doesn't know by InformationFilter. A hidden card in hand keeps only
+//! its slot and a hidden secret keeps its slot and card class, so the counts
+//! stay public. The order of a deck is never encoded.
+//!
+class ObservationEncoder
+{
+ public:
+    //! The number of global values: turn, is current player.
+    static constexpr std::size_t GLOBAL_SIZE = 2;
+
+    //! The number of values of hero, weapon, hero power, mana and counts.
+    static constexpr std::size_t HERO_SIZE = 20;
+
+    //! The number of values of a minion: exists, card index, attack, health,
+    //! base health, can attack, taunt, divine shield, poisonous, stealth,
+    //! windfury, frozen.
+    static constexpr std::size_t MINION_SIZE = 12;
+
+    //! The number of values of a card in hand.
+    static constexpr std::size_t HAND_CARD_SIZE = 3;
+
+    //! The number of values of a secret.
+    static constexpr std::size_t SECRET_SIZE = 3;
+
+    //! The offset of the field section in the block of a player.
+    static constexpr std::size_t FIELD_OFFSET = HERO_SIZE;
+
+    //! The offset of the hand section in the block of a player.
+    static constexpr std::size_t HAND_OFFSET =
+        FIELD_OFFSET + MAX_FIELD_SIZE * MINION_SIZE;
+
+    //! The offset of the secret section in the block of a player.
+    static constexpr std::size_t SECRET_OFFSET =
+        HAND_OFFSET + MAX_HAND_SIZE * HAND_CARD_SIZE;
+
+    //! The number of values of the block of a player.
+    static constexpr std::size_t PLAYER_SIZE =
+        SECRET_OFFSET + MAX_SECERT_SIZE * SECRET_SIZE;
+
+    //! The number of values of the tensor.
+    static constexpr std::size_t SIZE = GLOBAL_SIZE + 2 * PLAYER_SIZE;
+
+    //! Encodes \p game from the perspective of \p playerType into \p buffer.
+    //! \param game The game to encode.
+    //! \param playerType The type of the player to observe the game.
+    //! \param buffer The buffer that has at least SIZE values.
+    //! \param isFiltered The flag that indicates whether to hide unknown
+    //! entities of the opponent.
+    template <typename T>
+    static void Encode(const Game& game, PlayerType playerType, T* buffer,
+                       bool isFiltered = true);
+
+ private:
+    friend class DeltaEncoder;
+
+    //! Encodes the global values of \p game into \p buffer.
+    //! \param game The game to encode.
+    //! \param player The player to observe the game.
+    //! \param buffer The buffer that has at least GLOBAL_SIZE values.
+    template <typename T>
+    static void EncodeGlobal(const Game& game, const Player& player,
+                             T* buffer);
+
+    //! Encodes the block of \p player into \p buffer.
+    //! \param player The player to encode.
+    //! \param observer The player to observe the game or nullptr to encode
+    //! all entities.
+    //! \param buffer The buffer that has at least PLAYER_SIZE values.
+    template <typename T>
+    static void EncodePlayer(const Player& player, const Player* observer,
+                             T* buffer);
+
+    //! Encodes the hero, weapon, hero power, mana and counts of \p player
+    //! into \p buffer.
+    //! \param player The player to encode.
+    //! \param buffer The buffer that has at least HERO_SIZE values.
+    template <typename T>
+    static void EncodeHero(const Player& player, T* buffer);
+
+    //! Encodes \p minion into \p buffer.
+    //! \param minion The minion to encode or nullptr for an empty slot.
+    //! \param buffer The buffer that has at least MINION_SIZE values.
+    template <typename T>
+    static void EncodeMinion(const Minion* minion, T* buffer);
+
+    //! Encodes \p playable in hand into \p buffer.
+    //! \param playable The card to encode or nullptr for an empty slot.
+    //! \param observer The player to observe the game or nullptr to encode
+    //! all entities.
+    //! \param buffer The buffer that has at least HAND_CARD_SIZE values.
+    template <typename T>
+    static void EncodeHandCard(const Playable* playable,
+                               const Player* observer, T* buffer);
+
+    //! Encodes \p spell in secret zone into \p buffer.
+    //! \param spell The secret to encode or nullptr for an empty slot.
+    //! \param observer The player to observe the game or nullptr to encode
+    //! all entities.
+    //! \param buffer The buffer that has at least SECRET_SIZE values.
+    template <typename T>
+    static void EncodeSecret(const Spell* spell, const Player* observer,
+                             T* buffer);
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
@@ -0,0 +1,117 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_FORMAT_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_FORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace RosettaStone::PlayMode
+{
+//! \brief An enumerator for identifying the column of a trajectory chunk.
+enum class TrajectoryColumn
+{
+    OBSERVATIONS,
+    ACTIONS,
+    MASKS,
+    REWARDS,
+    DONES,
+    STATS
+};
+
+//!
+//! \brief TrajectoryShape struct.
+//!
+//! This struct holds the number of values of each step of a trajectory.
+//!
+struct TrajectoryShape
+{
+    std::size_t observationSize = 0;
+    std::size_t actionSize = 0;
+    std::size_t numStats = 0;
+};
+
+//!
+//! \brief TrajectoryFormat class.
+//!
+//! This class defines the layout of a trajectory file. A file consists of a
+//! header, chunks of steps, an index of chunks and a footer:
+//!
+//! - Header: magic, observation size, action size, the number of policy
+//!   stats and the number of steps per chunk as uint32.
+//! - Chunk: magic and the number of steps as uint64, and then the columns of
+//!   observations (float), actions (int32), action masks (uint8), rewards
+//!   (float), dones (uint8) and policy stats (float).
+//! - Index: the offset and the number of steps of each chunk as uint64.
+//! - Footer: the offset of index, the number of chunks and the number of
+//!   steps as uint64 and magic.
+//!
+//! The header, chunks and columns start at multiples of ALIGNMENT, so
+//! columns of a memory-mapped file can be used in place.
+//!
+class TrajectoryFormat
+{
+ public:
+    //! The number of columns of a chunk.
+    static constexpr std::size_t NUM_COLUMNS = 6;
+
+    //! The alignment of the header, chunks and columns in bytes.
+    static constexpr std::size_t ALIGNMENT = 64;
+
+    //! The size of the header in bytes.
+    static constexpr std::size_t HEADER_SIZE = ALIGNMENT;
+
+    //! The size of the header of a chunk in bytes.
+    static constexpr std::size_t CHUNK_HEADER_SIZE = ALIGNMENT;
+
+    //! The size of the footer in bytes.
+    static constexpr std::size_t FOOTER_SIZE = 32;
+
+    //! The magic of the header.
+    static constexpr char FILE_MAGIC[8] = { 'R', 'S', 'T', 'R',
+                                            'A', 'J', '0', '1' };
+
+    //! The magic of a chunk.
+    static constexpr char CHUNK_MAGIC[8] = { 'R', 'S', 'C', 'H',
+                                             'U', 'N', 'K', '1' };
+
+    //! The magic of the footer.
+    static constexpr char FOOTER_MAGIC[8] = { 'R', 'S', 'I', 'N',
+                                              'D', 'E', 'X', '1' };
+
+    //! Returns the offsets of columns from the beginning of a chunk.
+    //! The last offset is the size of the chunk.
+    //! \param shape The shape of a step.
+    //! \param numSteps The number of steps in the chunk.
+    //! \return The offsets of columns and the size of the chunk.
+    static std::array<std::size_t, NUM_COLUMNS + 1> GetColumnOffsets(
+        const TrajectoryShape& shape, std::size_t numSteps);
+
+    //! Returns the size of a value of \p column in bytes.
+    //! \param column The column.
+    //! \return The size of a value of \p column in bytes.
+    static std::size_t GetValueSize(TrajectoryColumn column);
+
+    //! Returns the number of values of \p column per step.
+    //! \param shape The shape of a step.
+    //! \param column The column.
+    //! \return The number of values of \p column per step.
+    static std::size_t GetNumValues(const TrajectoryShape& shape,
+                                    TrajectoryColumn column);
+
+    //! Rounds up \p size to a multiple of ALIGNMENT.
+    //! \param size The size in bytes.
+    //! \return The aligned size in bytes.
+    static constexpr std::size_t Align(std::size_t size)
+    {
+        return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_FORMAT_HPP
@@ -0,0 +1,122 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
+
+#include <Rosetta/PlayMode/Environments/TrajectoryFormat.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief TrajectoryChunk struct.
+//!
+//! This struct holds pointers to the columns of a chunk in a trajectory file.
+//! Each column holds the values of all steps in row-major order.
+//!
+struct TrajectoryChunk
+{
+    std::size_t numSteps = 0;
+    const float* observations = nullptr;
+    const std::int32_t* actions = nullptr;
+    const std::uint8_t* masks = nullptr;
+    const float* rewards = nullptr;
+    const std::uint8_t* dones = nullptr;
+    const float* stats = nullptr;
+};
+
+//!
+//! \brief TrajectoryReader class.
+//!
+//! This class memory-maps a trajectory file written by TrajectoryWriter and
+//! returns the columns of its chunks without copying them. The chunks are
+//! found with the index of the file. If the file wasn't closed, the chunks
+//! are found by scanning the file instead, and a chunk that isn't written
+//! completely is ignored.
+//!
+class TrajectoryReader
+{
+ public:
+    //! Constructs trajectory reader with given \p path.
+    //! \param path The path of file to read.
+    explicit TrajectoryReader(const std::string& path);
+
+    //! Destructor. Unmaps the file.
+    ~TrajectoryReader();
+
+    //! Deleted copy constructor.
+    TrajectoryReader(const TrajectoryReader&) = delete;
+
+    //! Deleted move constructor.
+    TrajectoryReader(TrajectoryReader&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TrajectoryReader& operator=(const TrajectoryReader&) = delete;
+
+    //! Deleted move assignment operator.
+    TrajectoryReader& operator=(TrajectoryReader&&) noexcept = delete;
+
+    //! Returns the shape of a step.
+    //! \return The shape of a step.
+    const TrajectoryShape& GetShape() const;
+
+    //! Returns the number of steps per chunk of the writer.
+    //! \return The number of steps per chunk of the writer.
+    std::size_t GetChunkSize() const;
+
+    //! Returns the number of chunks.
+    //! \return The number of chunks.
+    std::size_t GetNumChunks() const;
+
+    //! Returns the number of steps of all chunks.
+    //! \return The number of steps of all chunks.
+    std::size_t GetNumSteps() const;
+
+    //! Returns the chunk at \p idx.
+    //! \param idx The index of chunk.
+    //! \return The chunk at \p idx.
+    TrajectoryChunk GetChunk(std::size_t idx) const;
+
+ private:
+    //! Reads the index from the footer of the file.
+    //! \return true if the file has a valid footer, false otherwise.
+    bool ReadIndex();
+
+    //! Finds chunks by scanning the file.
+    void ScanChunks();
+
+    //! Unmaps the file.
+    void Unmap();
+
+    //! Checks that a chunk is inside the file and has the magic.
+    //! \param offset The offset of chunk.
+    //! \param numSteps The number of steps of chunk.
+    //! \return true if the chunk is valid, false otherwise.
+    bool IsValidChunk(std::uint64_t offset, std::uint64_t numSteps) const;
+
+    //! Reads a value at \p offset of the file.
+    //! \param offset The offset of value.
+    //! \return The value at \p offset.
+    template <typename T>
+    T Read(std::size_t offset) const;
+
+    const unsigned char* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::vector<unsigned char> m_buffer;
+
+    TrajectoryShape m_shape;
+    std::size_t m_chunkSize = 0;
+    std::size_t m_numSteps = 0;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> m_index;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
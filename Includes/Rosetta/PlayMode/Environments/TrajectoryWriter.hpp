@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
+
+#include <Rosetta/PlayMode/Environments/TrajectoryFormat.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief TrajectoryWriter class.
+//!
+//! This class appends steps of (observation, action, action mask, reward,
+//! done, policy stats) to a trajectory file of TrajectoryFormat. Steps are
+//! copied into the columns of the current chunk, and a full chunk is handed
+//! to a background thread that writes it to the file. So a caller only pays
+//! for copying steps as long as the disk keeps up. If it doesn't, Append()
+//! waits until the number of chunks that are not written yet drops below
+//! the limit, which bounds the memory of the queue. Append() can be called
+//! from multiple threads.
+//!
+//! The index and the footer are written by Close(). A file that isn't closed
+//! is still readable by TrajectoryReader up to its last complete chunk.
+//!
+class TrajectoryWriter
+{
+ public:
+    //! Constructs trajectory writer with given \p path, \p shape,
+    //! \p chunkSize and \p maxPendingChunks. It creates a new file or
+    //! truncates an existing file.
+    //! \param path The path of file to write.
+    //! \param shape The shape of a step.
+    //! \param chunkSize The number of steps per chunk.
+    //! \param maxPendingChunks The maximum number of full chunks that are
+    //! handed to the background thread but not written yet.
+    TrajectoryWriter(const std::string& path, const TrajectoryShape& shape,
+                     std::size_t chunkSize = 4096,
+                     std::size_t maxPendingChunks = 4);
+
+    //! Destructor. Closes the file if it isn't closed.
+    ~TrajectoryWriter();
+
+    //! Deleted copy constructor.
+    TrajectoryWriter(const TrajectoryWriter&) = delete;
+
+    //! Deleted move constructor.
+    TrajectoryWriter(TrajectoryWriter&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    TrajectoryWriter& operator=(TrajectoryWriter&&) noexcept = delete;
+
+    //! Appends \p numSteps steps. Each buffer holds the values of all steps
+    //! in row-major order.
+    //! \param numSteps The number of steps.
+    //! \param observations The observations (numSteps x observationSize).
+    //! \param actions The actions (numSteps).
+    //! \param masks The action masks (numSteps x actionSize).
+    //! \param rewards The rewards (numSteps).
+    //! \param dones The dones (numSteps).
+    //! \param stats The policy stats (numSteps x numStats). If it is
+    //! nullptr, the stats are 0.
+    void Append(std::size_t numSteps, const float* observations,
+                const std::int32_t* actions, const std::uint8_t* masks,
+                const float* rewards, const std::uint8_t* dones,
+                const float* stats = nullptr);
+
+    //! Writes the steps appended so far and waits until they are written.
+    void Flush();
+
+    //! Flushes steps, writes the index and closes the file.
+    //! It does nothing if the file is already closed.
+    void Close();
+
+    //! Returns the shape of a step.
+    //! \return The shape of a step.
+    const TrajectoryShape& GetShape() const;
+
+    //! Returns the number of steps appended so far.
+    //! \return The number of steps appended so far.
+    std::size_t GetNumSteps() const;
+
+ private:
+    //! Hands the current chunk to the background thread. It waits while
+    //! there are m_maxPendingChunks chunks that are not written yet.
+    //! m_chunkMutex must be locked.
+    void PushChunk();
+
+    //! Writes chunks in the queue until the writer is stopped.
+    void WriterLoop();
+
+    //! Throws the error of the background thread if it failed.
+    //! m_mutex must be locked.
+    void CheckError() const;
+
+    std::ofstream m_file;
+    TrajectoryShape m_shape;
+    std::size_t m_chunkSize = 0;
+    std::size_t m_maxPendingChunks = 0;
+    std::array<std::size_t, TrajectoryFormat::NUM_COLUMNS + 1> m_offsets{};
+
+    mutable std::mutex m_chunkMutex;
+    std::vector<unsigned char> m_chunk;
+    std::size_t m_numChunkSteps = 0;
+    std::size_t m_numSteps = 0;
+    bool m_isClosed = false;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_queueCond;
+    std::condition_variable m_writtenCond;
+    std::deque<std::pair<std::vector<unsigned char>, std::size_t>> m_queue;
+    std::vector<std::vector<unsigned char>> m_freeChunks;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> m_index;
+    std::uint64_t m_fileOffset = 0;
+    std::size_t m_numPushedChunks = 0;
+    std::size_t m_numWrittenChunks = 0;
+    std::string m_error;
+    bool m_isStopped = false;
+
+    std::thread m_thread;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
@@ -0,0 +1,151 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_VEC_ENV_HPP
+#define ROSETTASTONE_PLAYMODE_VEC_ENV_HPP
+
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief VecEnv class.
+//!
+//! This class owns a number of games and steps all of them in parallel with
+//! a thread pool. The agent plays player 1 of each game and a random agent
+//! plays player 2. Finished games are reset automatically, so the
+//! observation of a done game is the first observation of the next game.
+//!
+//! Observations are encoded by DeltaEncoder and actions are defined by
+//! ActionSpace from the perspective of player 1, and the observations hide
+//! the cards of player 2 that player 1 doesn't know. Each game has its own
+//! encoder, so a step re-encodes only the slots that changed. Observations,
+//! rewards, dones and action masks are written into buffers owned by this
+//! class that keep their addresses, so callers can wrap them without copying.
+//! Each game reseeds the random number generator of the thread with its own
+//! stream before it runs, so results don't depend on the number of threads.
+//!
+class VecEnv
+{
+ public:
+    //! The number of values in the observation of a game.
+    static constexpr std::size_t OBSERVATION_SIZE = ObservationEncoder::SIZE;
+
+    //! The number of actions in the action space.
+    static constexpr std::size_t ACTION_SIZE = ActionSpace::SIZE;
+
+    //! Constructs vectorized environment with given \p pool, \p config,
+    //! \p numEnvs and \p seed.
+    //! \param pool The thread pool to step games.
+    //! \param config The game config to create games.
+    //! \param numEnvs The number of games.
+    //! \param seed The base seed.
+    VecEnv(ThreadPool& pool, const GameConfig& config, std::size_t numEnvs,
+           std::uint64_t seed = 0);
+
+    //! Resets all games and writes the first observations.
+    void Reset();
+
+    //! Processes the action of each game and writes the results.
+    //! Action i is an action of ActionSpace for player 1 of game i.
+    //! \param actions A list of actions of all games.
+    void Step(const std::vector<int>& actions);
+
+    //! Processes the action of each game and appends the steps to \p writer.
+    //! A step has the observation and the action mask that the action was
+    //! chosen with, the action, and the reward and the done after it.
+    //! \param actions A list of actions of all games.
+    //! \param writer The writer of trajectories.
+    //! \param stats The policy stats of actions (numEnvs x numStats) or
+    //! nullptr.
+    void Step(const std::vector<int>& actions, TrajectoryWriter& writer,
+              const float* stats = nullptr);
+
+    //! Returns the number of games.
+    //! \return The number of games.
+    std::size_t GetNumEnvs() const;
+
+    //! Returns the game at \p idx.
+    //! \param idx The index of game.
+    //! \return The game at \p idx.
+    const Game& GetGame(std::size_t idx) const;
+
+    //! Returns the buffer of observations (numEnvs x OBSERVATION_SIZE).
+    //! \return The buffer of observations.
+    float* GetObservations();
+
+    //! Returns the buffer of rewards (numEnvs).
+    //! \return The buffer of rewards.
+    float* GetRewards();
+
+    //! Returns the buffer of dones (numEnvs).
+    //! \return The buffer of dones.
+    std::uint8_t* GetDones();
+
+    //! Returns the buffer of action masks (numEnvs x ACTION_SIZE).
+    //! \return The buffer of action masks.
+    std::uint8_t* GetActionMasks();
+
+ private:
+    //! Env struct.
+    //! This struct holds a game, its encoder and the progress of the current
+    //! turn.
+    struct Env
+    {
+        std::unique_ptr<Game> game;
+        DeltaEncoder encoder{ PlayerType::PLAYER1 };
+        std::uint64_t numSeeds = 0;
+        int turn = 0;
+        int numTasks = 0;
+    };
+
+    //! Seeds the random number generator with the next stream of \p idx.
+    //! \param idx The index of game.
+    void Seed(std::size_t idx);
+
+    //! Creates a new game at \p idx and runs it until player 1 can act.
+    //! \param idx The index of game.
+    void ResetEnv(std::size_t idx);
+
+    //! Processes \p action of the game at \p idx.
+    //! \param idx The index of game.
+    //! \param action The action to process.
+    void StepEnv(std::size_t idx, std::size_t action);
+
+    //! Plays player 2 with random tasks until player 1 can act.
+    //! \param game The game to play.
+    static void PlayOpponent(Game& game);
+
+    //! Writes the observation and the action mask of the game at \p idx.
+    //! \param idx The index of game.
+    void UpdateEnv(std::size_t idx);
+
+    ThreadPool& m_pool;
+    GamePrototype m_prototype;
+    std::uint64_t m_seed = 0;
+    std::vector<Env> m_envs;
+
+    std::vector<float> m_observations;
+    std::vector<float> m_rewards;
+    std::vector<std::uint8_t> m_dones;
+    std::vector<std::uint8_t> m_actionMasks;
+
+    std::vector<float> m_prevObservations;
+    std::vector<std::uint8_t> m_prevActionMasks;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_VEC_ENV_HPP
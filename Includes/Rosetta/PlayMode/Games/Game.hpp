@@ -19,6 +19,7 @@
 
 namespace RosettaStone::PlayMode
 {
+class GamePrototype;
 class Minion;
 
 //!
@@ -37,6 +38,11 @@ class Game
     //! \param gameConfig The game config holds all configuration values.
     explicit Game(const GameConfig& gameConfig);
 
+    //! Constructs game with given \p prototype. It copies the heroes and decks
+    //! of the game of \p prototype instead of building them from cards.
+    //! \param prototype The game prototype holds the game to copy.
+    explicit Game(const GamePrototype& prototype);
+
     //! Default destructor.
     ~Game() = default;
 
@@ -229,6 +235,9 @@ class Game
     //! \return The result of the game (player1 and player2).
     std::tuple<PlayState, PlayState> CheckGameOver();
 
+    //! Determines the first player and sets the first turn.
+    void DetermineFirstPlayer();
+
     GameConfig m_gameConfig;
 
     std::array<Player, 2> m_players;
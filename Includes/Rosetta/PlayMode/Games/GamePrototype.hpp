@@ -0,0 +1,68 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_GAME_PROTOTYPE_HPP
+#define ROSETTASTONE_PLAYMODE_GAME_PROTOTYPE_HPP
+
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+
+#include <memory>
+
+namespace RosettaStone::PlayMode
+{
+class Game;
+
+//!
+//! \brief GamePrototype class.
+//!
+//! This class builds a game from a GameConfig only once, including the heroes,
+//! hero powers and decks with fill cards, so that many games can be created
+//! from the same deck pair by copying its entities instead of building them
+//! from cards again. The game of prototype is never started. The order of
+//! cards in deck is shuffled by each game in Game::BeginShuffle() using its
+//! random number generator, and the first player is determined by each game.
+//!
+class GamePrototype
+{
+ public:
+    //! Constructs game prototype with given \p gameConfig.
+    //! \param gameConfig The game config holds all configuration values.
+    explicit GamePrototype(const GameConfig& gameConfig);
+
+    //! Destructor.
+    ~GamePrototype();
+
+    //! Deleted copy constructor.
+    GamePrototype(const GamePrototype&) = delete;
+
+    //! Default move constructor.
+    GamePrototype(GamePrototype&&) noexcept;
+
+    //! Deleted copy assignment operator.
+    GamePrototype& operator=(const GamePrototype&) = delete;
+
+    //! Default move assignment operator.
+    GamePrototype& operator=(GamePrototype&&) noexcept;
+
+    //! Creates a new game that is ready to start.
+    //! \return A new game instance created from the prototype.
+    std::unique_ptr<Game> CreateGame() const;
+
+    //! Returns the game config that is used to create games.
+    //! \return The game config that is used to create games.
+    const GameConfig& GetGameConfig() const;
+
+    //! Returns the game whose entities are copied into new games.
+    //! \return The game whose entities are copied into new games.
+    const Game& GetGame() const;
+
+ private:
+    GameConfig m_gameConfig;
+    std::unique_ptr<Game> m_game;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_GAME_PROTOTYPE_HPP
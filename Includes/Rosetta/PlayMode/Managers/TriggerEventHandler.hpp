@@ -7,6 +7,7 @@
 #ifndef ROSETTASTONE_PLAYMODE_TRIGGER_EVENT_HANDLER_HPP
 #define ROSETTASTONE_PLAYMODE_TRIGGER_EVENT_HANDLER_HPP
 
+#include <atomic>
 #include <functional>
 
 namespace RosettaStone::PlayMode
@@ -59,7 +60,7 @@ class TriggerEventHandler
     bool operator!=(std::nullptr_t) const;
 
     int id;
-    static int counter;
+    static std::atomic<int> counter;
     bool toBeRemoved = false;
 
  private:
@@ -29,6 +29,11 @@ class Character : public Playable
     //! \param id The ID.
     Character(Player* player, Card* card, std::map<GameTag, int> tags, int id);
 
+    //! Constructs character with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The character of another game to copy.
+    Character(Player* player, const Character& prototype);
+
     //! Default destructor.
     ~Character() = default;
 
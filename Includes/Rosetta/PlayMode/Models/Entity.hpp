@@ -12,6 +12,7 @@
 #include <Rosetta/PlayMode/Managers/CostManager.hpp>
 #include <Rosetta/PlayMode/Zones/IZone.hpp>
 
+#include <cstddef>
 #include <map>
 #include <optional>
 
@@ -43,6 +44,13 @@ class Entity
     Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags,
            int _id = -1);
 
+    //! Constructs entity with given \p _game and \p prototype.
+    //! It copies the card and game tags of \p prototype, an entity of another
+    //! game that is not played yet, including its entity ID.
+    //! \param _game The game.
+    //! \param prototype The entity to copy.
+    Entity(Game* _game, const Entity& prototype);
+
     //! Destructor.
     virtual ~Entity();
 
@@ -94,6 +102,13 @@ class Entity
     //! Any enchants and trigger is removed.
     virtual void Reset();
 
+    //! Returns the number of changes of game tags and aura effects.
+    //! \return The number of changes of game tags and aura effects.
+    std::size_t GetNumChanges() const;
+
+    //! Increases the number of changes of game tags and aura effects.
+    void IncreaseNumChanges();
+
     //! Builds a new entity that can be added to a game.
     //! \param player An owner of the entity.
     //! \param card The card from which the entity must be derived.
@@ -106,6 +121,13 @@ class Entity
         std::optional<std::map<GameTag, int>> cardTags = std::nullopt,
         IZone* zone = nullptr, int id = -1);
 
+    //! Builds a copy of \p prototype that can be added to a game.
+    //! \param player An owner of the entity.
+    //! \param prototype The entity of another game that is not played yet.
+    //! \return A pointer to entity that is allocated dynamically.
+    static Playable* GetFromPrototype(Player* player,
+                                      const Playable* prototype);
+
     Game* game = nullptr;
     Player* player = nullptr;
     Card* card = nullptr;
@@ -116,6 +138,7 @@ class Entity
 
  protected:
     std::map<GameTag, int> m_gameTags;
+    std::size_t m_numChanges = 0;
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -29,6 +29,11 @@ class Hero : public Character
     //! \param id The ID.
     Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
 
+    //! Constructs hero with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The hero of another game to copy.
+    Hero(Player* player, const Hero& prototype);
+
     //! Default destructor.
     ~Hero();
 
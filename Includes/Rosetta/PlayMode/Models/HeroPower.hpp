@@ -27,6 +27,11 @@ class HeroPower : public Playable
     HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
               int id = -1);
 
+    //! Constructs hero power with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The hero power of another game to copy.
+    HeroPower(Player* player, const HeroPower& prototype);
+
     //! Default destructor.
     ~HeroPower() = default;
 
@@ -27,6 +27,11 @@ class Minion : public Character
     Minion(Player* player, Card* card, std::map<GameTag, int> tags,
            int id = -1);
 
+    //! Constructs minion with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The minion of another game to copy.
+    Minion(Player* player, const Minion& prototype);
+
     //! Default destructor.
     ~Minion() = default;
 
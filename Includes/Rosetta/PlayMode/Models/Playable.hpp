@@ -32,6 +32,11 @@ class Playable : public Entity
     Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
              int _id);
 
+    //! Constructs entity with given \p _player and \p prototype.
+    //! \param _player The player.
+    //! \param prototype The entity of another game to copy.
+    Playable(Player* _player, const Playable& prototype);
+
     //! Destructor.
     virtual ~Playable();
 
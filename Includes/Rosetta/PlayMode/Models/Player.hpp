@@ -298,6 +298,10 @@ class Player : public Entity
     //! \param powerCard A card that represents hero power.
     void AddHeroAndPower(Card* heroCard, Card* powerCard);
 
+    //! Adds the copies of \p hero and its hero power.
+    //! \param hero The hero of another game that is not played yet.
+    void AddHeroAndPower(const Hero& hero);
+
     std::string nickname;
     PlayerType playerType = PlayerType::PLAYER1;
     std::size_t playerID = 0;
@@ -26,6 +26,11 @@ class Spell : public Playable
     //! \param id The card ID.
     Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
 
+    //! Constructs spell with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The spell of another game to copy.
+    Spell(Player* player, const Spell& prototype);
+
     //! Default destructor.
     ~Spell() = default;
 
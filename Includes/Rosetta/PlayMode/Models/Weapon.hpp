@@ -29,6 +29,11 @@ class Weapon : public Playable
     Weapon(Player* player, Card* card, std::map<GameTag, int> tags,
            int id = -1);
 
+    //! Constructs weapon with given \p player and \p prototype.
+    //! \param player The owner of the card.
+    //! \param prototype The weapon of another game to copy.
+    Weapon(Player* player, const Weapon& prototype);
+
     //! Destructor.
     ~Weapon();
 
@@ -0,0 +1,208 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_BATCH_RUNNER_HPP
+#define ROSETTASTONE_PLAYMODE_BATCH_RUNNER_HPP
+
+#include <Rosetta/PlayMode/Accounts/DeckInfo.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//! \brief An enumerator for identifying the state of a job.
+enum class JobState : std::uint8_t
+{
+    PENDING,
+    WON,
+    LOST,
+    TIED,
+    RESUMED
+};
+
+//!
+//! \brief SharedCounters class.
+//!
+//! This class holds the result counters of all matchups for each worker and
+//! the state of each job. They are placed in a shared memory region that is
+//! mapped before forking workers, so the launcher can read them while
+//! workers are running. Each worker only writes its own slot and its own
+//! jobs with atomic operations, and slots are aligned to cache lines, so no
+//! lock is needed.
+//!
+class SharedCounters
+{
+ public:
+    //! Constructs shared counters with given \p numWorkers, \p numMatchups
+    //! and \p numJobs.
+    //! \param numWorkers The number of workers.
+    //! \param numMatchups The number of matchups.
+    //! \param numJobs The number of jobs.
+    SharedCounters(std::size_t numWorkers, std::size_t numMatchups,
+                   std::size_t numJobs);
+
+    //! Destructor.
+    ~SharedCounters();
+
+    //! Deleted copy constructor.
+    SharedCounters(const SharedCounters&) = delete;
+
+    //! Deleted move constructor.
+    SharedCounters(SharedCounters&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    SharedCounters& operator=(const SharedCounters&) = delete;
+
+    //! Deleted move assignment operator.
+    SharedCounters& operator=(SharedCounters&&) noexcept = delete;
+
+    //! Adds the result of a job to the slot of \p worker.
+    //! \param worker The index of worker.
+    //! \param matchup The index of matchup.
+    //! \param job The index of job.
+    //! \param playState The play state of player 1 at the end of the game.
+    void Add(std::size_t worker, std::size_t matchup, std::size_t job,
+             PlayState playState);
+
+    //! Returns the number of games that \p worker has finished.
+    //! \param worker The index of worker.
+    //! \return The number of games that \p worker has finished.
+    std::uint64_t GetNumDoneGames(std::size_t worker) const;
+
+    //! Returns the result of \p matchup summed over all workers.
+    //! \param matchup The index of matchup.
+    //! \return The result of \p matchup.
+    MatchResult GetResult(std::size_t matchup) const;
+
+    //! Returns the state of \p job.
+    //! \param job The index of job.
+    //! \return The state of \p job.
+    JobState GetJobState(std::size_t job) const;
+
+    //! Sets the state of \p job.
+    //! \param job The index of job.
+    //! \param state The state of job.
+    void SetJobState(std::size_t job, JobState state);
+
+ private:
+    //! Returns the counter of \p worker at \p offset.
+    //! \param worker The index of worker.
+    //! \param offset The offset of counter in the slot.
+    //! \return The counter of \p worker at \p offset.
+    std::atomic<std::uint64_t>& GetCounter(std::size_t worker,
+                                           std::size_t offset) const;
+
+    //! Returns the state of \p job.
+    //! \param job The index of job.
+    //! \return The state of \p job.
+    std::atomic<JobState>& GetJob(std::size_t job) const;
+
+    std::size_t m_numWorkers = 0;
+    std::size_t m_slotSize = 0;
+    std::size_t m_size = 0;
+    void* m_memory = nullptr;
+};
+
+//!
+//! \brief BatchConfig struct.
+//!
+//! This struct holds all configuration values of BatchRunner.
+//!
+struct BatchConfig
+{
+    std::size_t numGames = 100;
+    std::size_t numProcesses = 1;
+    std::size_t numThreads = 0;
+    std::uint64_t seed = 0;
+
+    //! The number of games to play in a call of Run(), 0 for all games.
+    //! The rest of games are left for a run resumed from the checkpoint.
+    std::size_t maxGamesPerRun = 0;
+
+    std::string checkpointPath;
+    std::size_t checkpointInterval = 60;
+};
+
+//!
+//! \brief BatchRunner class.
+//!
+//! This class plays the same number of games for each matchup. The job list
+//! is sharded over worker processes and each worker plays its shard with a
+//! thread pool. Game j uses the random stream j of the seed, so results
+//! don't depend on the number of processes or threads.
+//!
+//! The launcher writes a checkpoint periodically if a path is given. Since
+//! each job has its own random stream, a checkpoint only needs the seed,
+//! the list of completed jobs and the counters of them. A resumed run plays
+//! the rest of jobs and produces the same result as an uninterrupted run.
+//!
+class BatchRunner
+{
+ public:
+    //! A pair of decks to play.
+    using Matchup = std::pair<DeckInfo, DeckInfo>;
+
+    //! Constructs batch runner with given \p matchups, \p formatType and
+    //! \p config.
+    //! \param matchups A list of matchups to play.
+    //! \param formatType The format type of games.
+    //! \param config The configuration values of batch runner.
+    BatchRunner(std::vector<Matchup> matchups, FormatType formatType,
+                BatchConfig config);
+
+    //! Loads the checkpoint to continue the run where it stopped.
+    //! \return true if the checkpoint is loaded, false otherwise.
+    bool Resume();
+
+    //! Plays pending jobs, up to BatchConfig::maxGamesPerRun of them.
+    //! \return true if all workers finished successfully, false otherwise.
+    bool Run();
+
+    //! Returns the result of \p matchup.
+    //! \param matchup The index of matchup.
+    //! \return The result of \p matchup.
+    MatchResult GetResult(std::size_t matchup) const;
+
+    //! Returns a list of matchups.
+    //! \return A list of matchups.
+    const std::vector<Matchup>& GetMatchups() const;
+
+    //! Returns the counters of jobs played in this run.
+    //! \return The counters of jobs played in this run.
+    const SharedCounters& GetCounters() const;
+
+ private:
+    //! Plays the shard of \p worker.
+    //! \param worker The index of worker.
+    //! \param pendingJobs A list of jobs to play.
+    void RunWorker(std::size_t worker,
+                   const std::vector<std::size_t>& pendingJobs) const;
+
+    //! Writes the checkpoint of completed jobs.
+    void WriteCheckpoint() const;
+
+    //! Returns the fingerprint of matchups and configuration values that
+    //! change the result of jobs.
+    //! \return The fingerprint of the run.
+    std::uint64_t GetFingerprint() const;
+
+    std::vector<Matchup> m_matchups;
+    std::vector<GamePrototype> m_prototypes;
+    FormatType m_formatType;
+    BatchConfig m_config;
+
+    std::unique_ptr<SharedCounters> m_counters;
+    std::vector<MatchResult> m_resumedResults;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_BATCH_RUNNER_HPP
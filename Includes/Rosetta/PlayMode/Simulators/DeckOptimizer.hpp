@@ -0,0 +1,123 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_DECK_OPTIMIZER_HPP
+#define ROSETTASTONE_PLAYMODE_DECK_OPTIMIZER_HPP
+
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Accounts/DeckInfo.hpp>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief DeckOptimizerConfig struct.
+//!
+//! This struct holds all configuration values of DeckOptimizer.
+//!
+struct DeckOptimizerConfig
+{
+    FormatType formatType = FormatType::STANDARD;
+    std::vector<DeckInfo> gauntlet;
+
+    std::size_t populationSize = 16;
+    std::size_t numEliteDecks = 4;
+    std::size_t numGenerations = 10;
+    std::size_t numMutations = 2;
+    std::size_t numGamesPerOpponent = 20;
+
+    std::uint64_t seed = 0;
+};
+
+//!
+//! \brief DeckOptimizer class.
+//!
+//! This class searches 30-card decks of a class with a genetic algorithm.
+//! Each deck is scored by its average win rate against the decks of the
+//! gauntlet. All games of a generation are played in parallel, and the score
+//! of a deck is cached with the sorted list of its card IDs.
+//!
+class DeckOptimizer
+{
+ public:
+    //! A deck and its score.
+    using ScoredDeck = std::pair<DeckInfo, double>;
+
+    //! Constructs deck optimizer with given \p pool and \p config.
+    //! \param pool The thread pool to play games.
+    //! \param config The configuration values of deck optimizer.
+    DeckOptimizer(ThreadPool& pool, DeckOptimizerConfig config);
+
+    //! Searches decks starting from \p seedDeck. Cards that can't be put
+    //! into the deck and excess copies are dropped, and if it has less than
+    //! 30 cards, the rest of the deck is filled with random cards.
+    //! \param seedDeck The deck to start searching.
+    //! \return A list of decks of the last generation sorted by score.
+    std::vector<ScoredDeck> Run(const DeckInfo& seedDeck);
+
+    //! Returns the score of \p deck. It plays games if it is not cached.
+    //! \param deck The deck to evaluate.
+    //! \return The average win rate of \p deck against the gauntlet.
+    double Evaluate(const DeckInfo& deck);
+
+    //! Checks \p deck is a legal 30-card deck for the class and format.
+    //! \param deck The deck to check.
+    //! \return true if \p deck is legal, false otherwise.
+    bool IsValidDeck(const DeckInfo& deck) const;
+
+    //! Returns the number of decks that are evaluated by playing games.
+    //! \return The number of decks that are evaluated by playing games.
+    std::size_t GetNumEvaluatedDecks() const;
+
+    //! Returns the number of evaluations served from the cache.
+    //! \return The number of evaluations served from the cache.
+    std::size_t GetNumCacheHits() const;
+
+ private:
+    //! Returns the key of \p deck to cache its score.
+    //! \param deck The deck to make the key.
+    //! \return The sorted list of card IDs of \p deck.
+    static std::vector<std::string> GetDeckKey(const DeckInfo& deck);
+
+    //! Evaluates a list of decks and plays games of uncached decks at once.
+    //! \param decks A list of decks to evaluate.
+    //! \return A list of scores of \p decks.
+    std::vector<double> Evaluate(const std::vector<DeckInfo>& decks);
+
+    //! Fills \p deck with random cards until it has 30 cards.
+    //! \param deck The deck to fill.
+    void FillDeck(DeckInfo& deck);
+
+    //! Returns a deck that some cards of \p deck are replaced.
+    //! \param deck The deck to mutate.
+    //! \return The mutated deck.
+    DeckInfo Mutate(const DeckInfo& deck);
+
+    //! Returns a deck made of the cards of \p deck1 and \p deck2.
+    //! \param deck1 The first parent deck.
+    //! \param deck2 The second parent deck.
+    //! \return The child deck.
+    DeckInfo Crossover(const DeckInfo& deck1, const DeckInfo& deck2);
+
+    ThreadPool& m_pool;
+    DeckOptimizerConfig m_config;
+
+    CardClass m_deckClass = CardClass::INVALID;
+    std::vector<Card*> m_candidateCards;
+
+    std::map<std::vector<std::string>, double> m_scoreCache;
+    std::size_t m_numCacheHits = 0;
+
+    std::mt19937_64 m_generator;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_DECK_OPTIMIZER_HPP
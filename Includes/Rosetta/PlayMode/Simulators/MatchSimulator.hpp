@@ -0,0 +1,83 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_MATCH_SIMULATOR_HPP
+#define ROSETTASTONE_PLAYMODE_MATCH_SIMULATOR_HPP
+
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Accounts/DeckInfo.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
+
+#include <cstdint>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief MatchResult struct.
+//!
+//! This struct holds the number of games that player 1 won, lost and tied.
+//!
+struct MatchResult
+{
+    //! Adds the result of a game.
+    //! \param playState The play state of player 1 at the end of the game.
+    void Add(PlayState playState);
+
+    //! Operator overloading: operator+=.
+    //! \param rhs The match result to add.
+    MatchResult& operator+=(const MatchResult& rhs);
+
+    //! Returns the win rate of player 1. A tie counts as half a win.
+    //! \return The win rate of player 1.
+    double GetWinRate() const;
+
+    std::size_t numGames = 0;
+    std::size_t numWins = 0;
+    std::size_t numLosses = 0;
+    std::size_t numTies = 0;
+};
+
+//!
+//! \brief MatchSimulator class.
+//!
+//! This class plays games between two decks with random agents. The result
+//! of each game depends only on the seed and the index of the game, so the
+//! result of a run doesn't depend on the number of threads.
+//!
+class MatchSimulator
+{
+ public:
+    //! Makes a game config that \p deck1 plays against \p deck2. The order
+    //! of the first player is random and decks are shuffled.
+    //! \param deck1 The deck of player 1.
+    //! \param deck2 The deck of player 2.
+    //! \param formatType The format type of the game.
+    //! \return The game config to create games.
+    static GameConfig MakeGameConfig(const DeckInfo& deck1,
+                                     const DeckInfo& deck2,
+                                     FormatType formatType);
+
+    //! Plays a game created from \p prototype with the random stream
+    //! \p idx of \p seed.
+    //! \param prototype The game prototype to create a game.
+    //! \param seed The base seed.
+    //! \param idx The index of game.
+    //! \return The play state of player 1 at the end of the game.
+    static PlayState PlayGame(const GamePrototype& prototype,
+                              std::uint64_t seed, std::uint64_t idx);
+
+    //! Plays \p numGames games created from \p config in parallel.
+    //! \param pool The thread pool to run games.
+    //! \param config The game config to create games.
+    //! \param numGames The number of games to play.
+    //! \param seed The base seed.
+    //! \return The result of games from the perspective of player 1.
+    static MatchResult Run(ThreadPool& pool, const GameConfig& config,
+                           std::size_t numGames, std::uint64_t seed);
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_MATCH_SIMULATOR_HPP
@@ -0,0 +1,80 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_MULLIGAN_EVALUATOR_HPP
+#define ROSETTASTONE_PLAYMODE_MULLIGAN_EVALUATOR_HPP
+
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief MulliganResult struct.
+//!
+//! This struct holds the cards to keep and replace in the opening hand and
+//! the result of games played with that choice.
+//!
+struct MulliganResult
+{
+    std::vector<std::string> keptCardIDs;
+    std::vector<std::string> replacedCardIDs;
+    MatchResult result;
+};
+
+//!
+//! \brief MulliganEvaluator class.
+//!
+//! This class estimates the win rate of each keep/replace subset of an
+//! opening hand. All subsets play the same games: game i of every subset
+//! uses the same random stream, so the order of the rest of the deck and the
+//! deck of the opponent are the same (common random numbers). It reduces
+//! the variance of the difference between subsets.
+//!
+class MulliganEvaluator
+{
+ public:
+    //! Constructs mulligan evaluator with given \p pool, \p deck,
+    //! \p opponent and \p formatType.
+    //! \param pool The thread pool to play games.
+    //! \param deck The deck of the player to mulligan.
+    //! \param opponent The deck of the opponent.
+    //! \param formatType The format type of the game.
+    MulliganEvaluator(ThreadPool& pool, DeckInfo deck, DeckInfo opponent,
+                      FormatType formatType = FormatType::STANDARD);
+
+    //! Plays \p numGames games for each subset of \p openingHand to keep.
+    //! \param openingHand A list of card IDs in the opening hand. It should
+    //! have 3 cards for the first player and 4 cards for the second player.
+    //! \param isFirstPlayer The flag indicates the player goes first.
+    //! \param numGames The number of games to play for each subset.
+    //! \param seed The base seed.
+    //! \return A list of results of all subsets sorted by win rate.
+    std::vector<MulliganResult> Run(const std::vector<std::string>& openingHand,
+                                    bool isFirstPlayer, std::size_t numGames,
+                                    std::uint64_t seed) const;
+
+ private:
+    //! Makes a game config that the deck of the player has \p openingHand on
+    //! top and the rest of the cards are shuffled with the current random
+    //! stream.
+    //! \param openingHand A list of card IDs in the opening hand.
+    //! \param isFirstPlayer The flag indicates the player goes first.
+    //! \return The game config to create a game.
+    GameConfig MakeGameConfig(const std::vector<std::string>& openingHand,
+                              bool isFirstPlayer) const;
+
+    ThreadPool& m_pool;
+    DeckInfo m_deck;
+    DeckInfo m_opponent;
+    FormatType m_formatType;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_MULLIGAN_EVALUATOR_HPP
@@ -7,12 +7,63 @@
 #ifndef ROSETTASTONE_PLAYMODE_DECK_CODE_HPP
 #define ROSETTASTONE_PLAYMODE_DECK_CODE_HPP
 
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
 #include <Rosetta/PlayMode/Accounts/DeckInfo.hpp>
 
+#include <cstdint>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace RosettaStone::PlayMode
 {
+//! \brief An enumerator for identifying the result of decoding a deck code.
+enum class DeckCodeError
+{
+    NONE,
+    INVALID_BASE64,
+    UNEXPECTED_EOF,
+    INVALID_DECK_CODE,
+    VERSION_MISMATCH,
+    INVALID_FORMAT,
+    INVALID_HERO_COUNT,
+    INVALID_HERO,
+    INVALID_CARD,
+    TOO_MANY_CARDS
+};
+
+//!
+//! \brief DeckCodeBatch struct.
+//!
+//! This structure stores decoded deck codes as packed row-major arrays. Row i
+//! has the dbfID of hero, the format, the error code and MAX_CARDS pairs of
+//! dbfID and count. Unused pairs and all values of failed rows are 0.
+//!
+struct DeckCodeBatch
+{
+    //! The maximum number of distinct cards in a row.
+    static constexpr std::size_t MAX_CARDS = START_DECK_SIZE;
+
+    //! Constructs deck code batch with given \p size rows filled with 0.
+    //! \param size The number of rows.
+    explicit DeckCodeBatch(std::size_t size = 0);
+
+    std::size_t size = 0;
+    std::vector<std::int32_t> heroes;
+    std::vector<std::int32_t> formats;
+    std::vector<std::int32_t> errors;
+    std::vector<std::int32_t> dbfIDs;
+    std::vector<std::int32_t> counts;
+};
+
+//!
+//! \brief DeckCode class.
+//!
+//! This class converts between deck codes generated by Hearthstone and decks.
+//! The batch functions process a large number of deck codes in parallel and
+//! never throw for a bad deck code; they report an error code per row.
+//!
 class DeckCode
 {
  public:
@@ -20,6 +71,44 @@ class DeckCode
     //! \param deckCode The deck code generated by Hearthstone.
     //! \return The decoded deck that contains card information.
     static DeckInfo Decode(std::string_view deckCode);
+
+    //! Decodes a deck code into a row of packed arrays.
+    //! \param deckCode The deck code generated by Hearthstone.
+    //! \param hero The dbfID of hero.
+    //! \param format The format type.
+    //! \param dbfIDs The buffer that has at least MAX_CARDS dbfIDs.
+    //! \param counts The buffer that has at least MAX_CARDS counts.
+    //! \return The error code. The outputs are 0 if it is not NONE.
+    static DeckCodeError DecodeRow(std::string_view deckCode,
+                                   std::int32_t& hero, std::int32_t& format,
+                                   std::int32_t* dbfIDs, std::int32_t* counts);
+
+    //! Decodes \p deckCodes in parallel.
+    //! \param pool The thread pool to decode deck codes.
+    //! \param deckCodes A list of deck codes generated by Hearthstone.
+    //! \return The packed arrays of decoded deck codes.
+    static DeckCodeBatch DecodeBatch(
+        ThreadPool& pool, const std::vector<std::string_view>& deckCodes);
+
+    //! Encodes a deck into a deck code.
+    //! Pairs that have dbfID 0 or count 0 are skipped.
+    //! \param hero The dbfID of hero.
+    //! \param format The format type.
+    //! \param dbfIDs A list of dbfIDs of cards.
+    //! \param counts A list of counts of cards.
+    //! \param numCards The number of pairs of dbfID and count.
+    //! \return The deck code.
+    static std::string Encode(int hero, FormatType format,
+                              const std::int32_t* dbfIDs,
+                              const std::int32_t* counts,
+                              std::size_t numCards);
+
+    //! Encodes rows of \p batch in parallel.
+    //! \param pool The thread pool to encode decks.
+    //! \param batch The packed arrays of decks.
+    //! \return A list of deck codes. Rows that have an error are empty.
+    static std::vector<std::string> EncodeBatch(ThreadPool& pool,
+                                                const DeckCodeBatch& batch);
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -20,12 +20,20 @@
 #include <Rosetta/Battlegrounds/Enchants/Enchant.hpp>
 #include <Rosetta/Battlegrounds/Enchants/Enchants.hpp>
 #include <Rosetta/Battlegrounds/Enchants/Power.hpp>
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Environments/LegalActions.hpp>
+#include <Rosetta/Battlegrounds/Environments/LobbyRunner.hpp>
+#include <Rosetta/Battlegrounds/Environments/ObservationEncoder.hpp>
+#include <Rosetta/Battlegrounds/Environments/VecEnv.hpp>
 #include <Rosetta/Battlegrounds/Games/Game.hpp>
 #include <Rosetta/Battlegrounds/Games/GameState.hpp>
 #include <Rosetta/Battlegrounds/Loaders/CardLoader.hpp>
 #include <Rosetta/Battlegrounds/Loaders/InternalCardLoader.hpp>
 #include <Rosetta/Battlegrounds/Managers/GameManager.hpp>
 #include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatBoard.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatEstimator.hpp>
 #include <Rosetta/Battlegrounds/Models/Hero.hpp>
 #include <Rosetta/Battlegrounds/Models/Minion.hpp>
 #include <Rosetta/Battlegrounds/Models/MinionPool.hpp>
@@ -63,9 +71,11 @@
 #include <Rosetta/Common/Macros.hpp>
 #include <Rosetta/Common/PriorityQueue.hpp>
 #include <Rosetta/Common/SpinLocks.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
 #include <Rosetta/Common/Utils.hpp>
 #include <Rosetta/PlayMode/Accounts/AccountInfo.hpp>
 #include <Rosetta/PlayMode/Accounts/DeckInfo.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
 #include <Rosetta/PlayMode/Actions/Attack.hpp>
 #include <Rosetta/PlayMode/Actions/CastSpell.hpp>
 #include <Rosetta/PlayMode/Actions/Choose.hpp>
@@ -102,6 +112,7 @@
 #include <Rosetta/PlayMode/Cards/Card.hpp>
 #include <Rosetta/PlayMode/Cards/CardDef.hpp>
 #include <Rosetta/PlayMode/Cards/CardDefs.hpp>
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Conditions/RelaCondition.hpp>
 #include <Rosetta/PlayMode/Conditions/SelfCondition.hpp>
@@ -124,8 +135,17 @@
 #include <Rosetta/PlayMode/Enchants/PlayerAuraEffects.hpp>
 #include <Rosetta/PlayMode/Enchants/Power.hpp>
 #include <Rosetta/PlayMode/Enchants/SwapCostEnchant.hpp>
+#include <Rosetta/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/InformationFilter.hpp>
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryFormat.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Environments/VecEnv.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
 #include <Rosetta/PlayMode/Loaders/AccountLoader.hpp>
 #include <Rosetta/PlayMode/Loaders/CardLoader.hpp>
 #include <Rosetta/PlayMode/Loaders/InternalCardLoader.hpp>
@@ -146,6 +166,10 @@
 #include <Rosetta/PlayMode/Models/Player.hpp>
 #include <Rosetta/PlayMode/Models/Spell.hpp>
 #include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Simulators/BatchRunner.hpp>
+#include <Rosetta/PlayMode/Simulators/DeckOptimizer.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+#include <Rosetta/PlayMode/Simulators/MulliganEvaluator.hpp>
 #include <Rosetta/PlayMode/Tasks/ComplexTask.hpp>
 #include <Rosetta/PlayMode/Tasks/EventMetaData.hpp>
 #include <Rosetta/PlayMode/Tasks/ITask.hpp>
@@ -11,6 +11,7 @@
 namespace RosettaStone::Battlegrounds
 {
 std::array<Card, NUM_ALL_CARDS> Cards::m_cards;
+const Card Cards::m_emptyCard{};
 std::array<Card, NUM_BATTLEGROUNDS_HEROES> Cards::m_curHeroes;
 std::array<Card, NUM_TIER1_MINIONS> Cards::m_tier1Minions;
 std::array<Card, NUM_TIER2_MINIONS> Cards::m_tier2Minions;
@@ -82,7 +83,7 @@ const std::array<Card, NUM_ALL_CARDS>& Cards::GetAllCards()
     return m_cards;
 }
 
-Card Cards::FindCardByID(const std::string_view& id)
+const Card& Cards::FindCardByID(const std::string_view& id)
 {
     for (auto& card : m_cards)
     {
@@ -92,10 +93,10 @@ Card Cards::FindCardByID(const std::string_view& id)
         }
     }
 
-    return Card{};
+    return m_emptyCard;
 }
 
-Card Cards::FindCardByDbfID(int dbfID)
+const Card& Cards::FindCardByDbfID(int dbfID)
 {
     for (auto& card : m_cards)
     {
@@ -105,10 +106,10 @@ Card Cards::FindCardByDbfID(int dbfID)
         }
     }
 
-    return Card{};
+    return m_emptyCard;
 }
 
-Card Cards::FindCardByName(const std::string_view& name)
+const Card& Cards::FindCardByName(const std::string_view& name)
 {
     for (auto& card : m_cards)
     {
@@ -118,7 +119,7 @@ Card Cards::FindCardByName(const std::string_view& name)
         }
     }
 
-    return Card{};
+    return m_emptyCard;
 }
 
 const std::array<Card, NUM_BATTLEGROUNDS_HEROES>& Cards::GetCurrentHeroes()
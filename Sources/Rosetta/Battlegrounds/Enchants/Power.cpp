@@ -22,16 +22,31 @@ std::vector<TaskType>& Power::GetBattlecryTask()
     return m_battlecryTask;
 }
 
+const std::vector<TaskType>& Power::GetBattlecryTask() const
+{
+    return m_battlecryTask;
+}
+
 std::vector<TaskType>& Power::GetStartCombatTask()
 {
     return m_startCombatTask;
 }
 
+const std::vector<TaskType>& Power::GetStartCombatTask() const
+{
+    return m_startCombatTask;
+}
+
 std::vector<TaskType>& Power::GetDeathrattleTask()
 {
     return m_deathrattleTask;
 }
 
+const std::vector<TaskType>& Power::GetDeathrattleTask() const
+{
+    return m_deathrattleTask;
+}
+
 std::optional<Enchant>& Power::GetEnchant()
 {
     return m_enchant;
@@ -42,6 +57,11 @@ std::optional<Trigger>& Power::GetTrigger()
     return m_trigger;
 }
 
+const std::optional<Trigger>& Power::GetTrigger() const
+{
+    return m_trigger;
+}
+
 void Power::AddBattlecryTask(TaskType&& task)
 {
     m_battlecryTask.emplace_back(task);
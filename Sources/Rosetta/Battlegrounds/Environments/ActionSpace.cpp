@@ -0,0 +1,164 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Environments/LegalActions.hpp>
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::Battlegrounds
+{
+ActionType ActionSpace::GetActionType(std::size_t action)
+{
+    if (action < PURCHASE_OFFSET)
+    {
+        return ActionType::SELECT_HERO;
+    }
+    if (action < PLAY_CARD_OFFSET)
+    {
+        return ActionType::PURCHASE;
+    }
+    if (action < SELL_OFFSET)
+    {
+        return ActionType::PLAY_CARD;
+    }
+    if (action < REARRANGE_OFFSET)
+    {
+        return ActionType::SELL;
+    }
+    if (action < REFRESH)
+    {
+        return ActionType::REARRANGE;
+    }
+
+    switch (action)
+    {
+        case REFRESH:
+            return ActionType::REFRESH;
+        case UPGRADE:
+            return ActionType::UPGRADE;
+        case FREEZE:
+            return ActionType::FREEZE;
+        case END_RECRUIT:
+            return ActionType::END_RECRUIT;
+        default:
+            throw std::invalid_argument(
+                "ActionSpace::GetActionType() - Invalid action " +
+                std::to_string(action));
+    }
+}
+
+std::size_t ActionSpace::GetActionMask(Phase phase, Player& player,
+                                       std::uint8_t* mask)
+{
+    std::fill(mask, mask + SIZE, std::uint8_t{ 0 });
+    std::size_t numActions = 0;
+
+    const auto setAction = [&](std::size_t action) {
+        mask[action] = 1;
+        ++numActions;
+    };
+
+    if (phase == Phase::SELECT_HERO)
+    {
+        for (std::size_t i = 0; i < NUM_HEROES_ON_SELECTION_LIST; ++i)
+        {
+            if (player.heroChoices[i] != 0)
+            {
+                setAction(SelectHeroAction(i));
+            }
+        }
+
+        return numActions;
+    }
+
+    if (phase != Phase::RECRUIT)
+    {
+        return numActions;
+    }
+
+    LegalActions actions;
+    player.GetLegalActions(actions);
+
+    for (const auto& action : actions)
+    {
+        setAction(action.GetAction());
+    }
+
+    return numActions;
+}
+
+bool ActionSpace::IsLegal(Phase phase, Player& player, std::size_t action)
+{
+    if (action >= SIZE)
+    {
+        return false;
+    }
+
+    const ActionType type = GetActionType(action);
+    if (type == ActionType::SELECT_HERO)
+    {
+        return phase == Phase::SELECT_HERO &&
+               player.heroChoices[action - SELECT_HERO_OFFSET] != 0;
+    }
+
+    if (phase != Phase::RECRUIT)
+    {
+        return false;
+    }
+
+    LegalActions actions;
+    player.GetLegalActions(actions);
+
+    return actions.IsLegal(action);
+}
+
+void ActionSpace::Apply(Player& player, std::size_t action)
+{
+    switch (GetActionType(action))
+    {
+        case ActionType::SELECT_HERO:
+            player.SelectHero(action - SELECT_HERO_OFFSET);
+            break;
+        case ActionType::PURCHASE:
+            player.PurchaseMinion(action - PURCHASE_OFFSET);
+            break;
+        case ActionType::PLAY_CARD:
+        {
+            const std::size_t idx = action - PLAY_CARD_OFFSET;
+            const std::size_t target = idx % NUM_TARGETS;
+            player.PlayCard(idx / (MAX_FIELD_SIZE * NUM_TARGETS),
+                            idx / NUM_TARGETS % MAX_FIELD_SIZE,
+                            static_cast<int>(target) - 1);
+            break;
+        }
+        case ActionType::SELL:
+            player.SellMinion(action - SELL_OFFSET);
+            break;
+        case ActionType::REARRANGE:
+        {
+            const std::size_t idx = action - REARRANGE_OFFSET;
+            player.RearrangeMinion(idx / MAX_FIELD_SIZE, idx % MAX_FIELD_SIZE);
+            break;
+        }
+        case ActionType::REFRESH:
+            player.RefreshTavern();
+            break;
+        case ActionType::UPGRADE:
+            player.UpgradeTavern();
+            break;
+        case ActionType::FREEZE:
+            player.FreezeTavern();
+            break;
+        case ActionType::END_RECRUIT:
+            player.CompleteRecruit();
+            break;
+    }
+}
+}  // namespace RosettaStone::Battlegrounds
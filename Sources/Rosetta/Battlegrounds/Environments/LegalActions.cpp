@@ -0,0 +1,46 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Environments/LegalActions.hpp>
+
+namespace RosettaStone::Battlegrounds
+{
+void LegalActions::Clear()
+{
+    m_mask.reset();
+    m_count = 0;
+}
+
+std::size_t LegalActions::GetCount() const
+{
+    return m_count;
+}
+
+const RecruitAction& LegalActions::operator[](std::size_t idx) const
+{
+    return m_actions[idx];
+}
+
+const RecruitAction* LegalActions::begin() const
+{
+    return m_actions.data();
+}
+
+const RecruitAction* LegalActions::end() const
+{
+    return m_actions.data() + m_count;
+}
+
+bool LegalActions::IsLegal(std::size_t action) const
+{
+    return action < ActionSpace::SIZE && m_mask.test(action);
+}
+
+const std::bitset<ActionSpace::SIZE>& LegalActions::GetMask() const
+{
+    return m_mask;
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,209 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Environments/LobbyRunner.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::Battlegrounds
+{
+std::size_t RandomAgent::SelectAction([[maybe_unused]] GameState& gameState,
+                                      [[maybe_unused]] std::size_t playerIdx,
+                                      const std::uint8_t* actionMask,
+                                      std::size_t numLegalActions)
+{
+    auto n = Random::get<std::size_t>(0, numLegalActions - 1);
+
+    for (std::size_t action = 0; action < ActionSpace::SIZE; ++action)
+    {
+        if (actionMask[action] != 0 && n-- == 0)
+        {
+            return action;
+        }
+    }
+
+    return ActionSpace::END_RECRUIT;
+}
+
+LobbyRunner::LobbyRunner(ThreadPool& pool, const AgentFactory& agentFactory)
+    : m_pool(pool), m_slots(pool.GetNumThreads())
+{
+    for (auto& slot : m_slots)
+    {
+        for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+        {
+            slot.agents[playerIdx] = agentFactory(playerIdx);
+
+            if (slot.agents[playerIdx] == nullptr)
+            {
+                throw std::invalid_argument(
+                    "LobbyRunner::LobbyRunner() - The agent factory returned "
+                    "no agent for seat " +
+                    std::to_string(playerIdx));
+            }
+        }
+    }
+}
+
+void LobbyRunner::Run(std::size_t numLobbies, std::uint64_t seed,
+                      const ResultCallback& callback)
+{
+    std::atomic<std::size_t> nextLobbyIdx = 0;
+    std::atomic<bool> isFailed = false;
+    std::mutex callbackMutex;
+
+    m_pool.ParallelFor(m_slots.size(), [&](std::size_t slotIdx) {
+        Slot& slot = m_slots[slotIdx];
+        LobbyResult result;
+
+        try
+        {
+            for (std::size_t lobbyIdx = nextLobbyIdx++;
+                 lobbyIdx < numLobbies && !isFailed;
+                 lobbyIdx = nextLobbyIdx++)
+            {
+                PlayLobby(slot, lobbyIdx, seed, result);
+
+                std::lock_guard<std::mutex> lock(callbackMutex);
+                callback(result);
+            }
+        }
+        catch (...)
+        {
+            // NOTE: Other threads stop taking lobbies, and the pool rethrows.
+            isFailed = true;
+            throw;
+        }
+    });
+}
+
+void LobbyRunner::PlayLobby(Slot& slot, std::size_t lobbyIdx,
+                            std::uint64_t seed, LobbyResult& result)
+{
+    SeedRandom(seed, lobbyIdx);
+
+    const auto game = std::make_unique<Game>();
+    game->Start();
+
+    GameState& gameState = game->GetGameState();
+    int round = 0;
+
+    while (gameState.phase != Phase::COMPLETE &&
+           gameState.numRemainPlayer > 1 && round <= MAX_NUM_ROUNDS)
+    {
+        std::array<std::size_t, NUM_PLAYERS> readyActions{};
+
+        for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+        {
+            if (gameState.players[playerIdx].playState == PlayState::PLAYING)
+            {
+                readyActions[playerIdx] = PlayTurn(slot, gameState, playerIdx);
+            }
+        }
+
+        // NOTE: The last player to be ready advances the phase.
+        for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+        {
+            Player& player = gameState.players[playerIdx];
+            if (player.playState == PlayState::PLAYING)
+            {
+                ActionSpace::Apply(player, readyActions[playerIdx]);
+            }
+        }
+
+        ++round;
+    }
+
+    // Rank the remaining players according to their health
+    std::array<Player*, NUM_PLAYERS> players{};
+    std::size_t numPlayers = 0;
+    for (auto& player : gameState.players)
+    {
+        if (player.playState == PlayState::PLAYING)
+        {
+            players[numPlayers++] = &player;
+        }
+    }
+
+    std::stable_sort(players.begin(), players.begin() + numPlayers,
+                     [](const Player* lhs, const Player* rhs) {
+                         return lhs->hero.health > rhs->hero.health;
+                     });
+    for (std::size_t i = 0; i < numPlayers; ++i)
+    {
+        players[i]->rank = i + 1;
+    }
+
+    result.lobbyIdx = lobbyIdx;
+    result.numRounds = round;
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        const Player& player = gameState.players[playerIdx];
+        LobbyResult::PlayerResult& playerResult = result.players[playerIdx];
+
+        playerResult.rank = player.rank;
+        playerResult.heroDbfID = player.hero.card.dbfID;
+        playerResult.health = player.hero.health;
+        playerResult.tier = player.currentTier;
+        playerResult.numMinions = player.recruitField.GetCount();
+
+        for (int pos = 0; pos < playerResult.numMinions; ++pos)
+        {
+            const Minion& minion = player.recruitField[pos];
+            playerResult.board[pos] = { minion.GetCard().dbfID,
+                                        minion.GetAttack(),
+                                        minion.GetHealth() };
+        }
+    }
+}
+
+std::size_t LobbyRunner::PlayTurn(Slot& slot, GameState& gameState,
+                                  std::size_t playerIdx)
+{
+    Player& player = gameState.players[playerIdx];
+    Agent& agent = *slot.agents[playerIdx];
+    std::uint8_t* mask = slot.actionMask.data();
+
+    for (int numActions = 0;; ++numActions)
+    {
+        // NOTE: Tavern actions like freeze don't cost coins, so end recruit
+        // when the player processes too many actions.
+        if (gameState.phase == Phase::RECRUIT &&
+            numActions >= MAX_AGENT_TASKS_PER_TURN)
+        {
+            return ActionSpace::END_RECRUIT;
+        }
+
+        const std::size_t numLegalActions =
+            ActionSpace::GetActionMask(gameState.phase, player, mask);
+        const std::size_t action =
+            agent.SelectAction(gameState, playerIdx, mask, numLegalActions);
+
+        if (action >= ActionSpace::SIZE || mask[action] == 0)
+        {
+            throw std::logic_error(
+                "LobbyRunner::PlayTurn() - Invalid action " +
+                std::to_string(action) + " of player " +
+                std::to_string(playerIdx));
+        }
+
+        const ActionType type = ActionSpace::GetActionType(action);
+        if (type == ActionType::SELECT_HERO || type == ActionType::END_RECRUIT)
+        {
+            return action;
+        }
+
+        ActionSpace::Apply(player, action);
+    }
+}
+}  // namespace RosettaStone::Battlegrounds
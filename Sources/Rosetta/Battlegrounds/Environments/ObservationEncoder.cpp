@@ -0,0 +1,98 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Environments/ObservationEncoder.hpp>
+#include <Rosetta/Battlegrounds/Games/GameState.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone::Battlegrounds
+{
+void ObservationEncoder::Encode(const GameState& state, std::size_t playerIdx,
+                                int round, bool canAct, float* observation)
+{
+    std::fill(observation, observation + SIZE, 0.0f);
+
+    const Player& player = state.players[playerIdx];
+    const auto toFloat = [](auto value) { return static_cast<float>(value); };
+
+    // Global
+    observation[0] = toFloat(round);
+    observation[1] = toFloat(state.phase == Phase::SELECT_HERO);
+    observation[2] = toFloat(state.phase == Phase::RECRUIT);
+    observation[3] = toFloat(canAct);
+    observation[4] = toFloat(state.numRemainPlayer);
+
+    // Player
+    float* values = observation + PLAYER_OFFSET;
+    values[0] = toFloat(player.hero.health);
+    values[1] = toFloat(player.remainCoin);
+    values[2] = toFloat(player.totalCoin);
+    values[3] = toFloat(player.currentTier);
+    values[4] = toFloat(player.coinToUpgradeTavern);
+    values[5] = toFloat(player.freezeTavern);
+    values[6] = toFloat(player.hero.card.dbfID);
+    for (std::size_t i = 0; i < NUM_HEROES_ON_SELECTION_LIST; ++i)
+    {
+        values[7 + i] = toFloat(player.heroChoices[i]);
+    }
+
+    // Tavern
+    float* slot = observation + TAVERN_OFFSET;
+    player.tavern.fieldZone.ForEach([&](const MinionData& minion) {
+        EncodeMinion(minion.value(), slot);
+        slot += MINION_SIZE;
+    });
+
+    // Hand
+    slot = observation + HAND_OFFSET;
+    player.hand.ForEach([&](const std::optional<CardData>& card) {
+        if (std::holds_alternative<Minion>(card.value()))
+        {
+            EncodeMinion(std::get<Minion>(card.value()), slot);
+        }
+        else
+        {
+            slot[0] = 1.0f;
+            slot[1] = toFloat(std::get<Spell>(card.value()).GetCard().dbfID);
+        }
+        slot += MINION_SIZE;
+    });
+
+    // Field
+    slot = observation + FIELD_OFFSET;
+    player.recruitField.ForEach([&](const MinionData& minion) {
+        EncodeMinion(minion.value(), slot);
+        slot += MINION_SIZE;
+    });
+
+    // Lobby
+    slot = observation + LOBBY_OFFSET;
+    for (std::size_t i = 0; i < NUM_BATTLEGROUNDS_PLAYERS; ++i)
+    {
+        const Player& other =
+            state.players[(playerIdx + i) % NUM_BATTLEGROUNDS_PLAYERS];
+
+        slot[0] = toFloat(other.playState == PlayState::PLAYING);
+        slot[1] = toFloat(other.hero.health);
+        slot[2] = toFloat(other.currentTier);
+        slot[3] = toFloat(other.recruitField.GetCount());
+        slot[4] = toFloat(player.playerIdxNextFight == other.idx);
+        slot += LOBBY_PLAYER_SIZE;
+    }
+}
+
+void ObservationEncoder::EncodeMinion(const Minion& minion, float* slot)
+{
+    slot[0] = 1.0f;
+    slot[1] = static_cast<float>(minion.GetCard().dbfID);
+    slot[2] = static_cast<float>(minion.GetTier());
+    slot[3] = static_cast<float>(minion.GetAttack());
+    slot[4] = static_cast<float>(minion.GetHealth());
+    slot[5] = static_cast<float>(minion.HasTaunt());
+    slot[6] = static_cast<float>(minion.HasDivineShield());
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,305 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Environments/VecEnv.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+float GetRankReward(std::size_t rank)
+{
+    // NOTE: The first place gets 1 and the last place gets -1.
+    return static_cast<float>(static_cast<int>(VecEnv::NUM_PLAYERS + 1) -
+                              2 * static_cast<int>(rank)) /
+           static_cast<float>(VecEnv::NUM_PLAYERS - 1);
+}
+}  // namespace
+
+VecEnv::VecEnv(ThreadPool& pool, std::size_t numLobbies, std::uint64_t seed)
+    : m_pool(pool),
+      m_seed(seed),
+      m_lobbies(numLobbies),
+      m_observations(numLobbies * NUM_PLAYERS * OBSERVATION_SIZE, 0.0f),
+      m_rewards(numLobbies * NUM_PLAYERS, 0.0f),
+      m_dones(numLobbies, 0),
+      m_actionMasks(numLobbies * NUM_PLAYERS * ACTION_SIZE, 0)
+{
+    if (numLobbies == 0)
+    {
+        throw std::invalid_argument(
+            "VecEnv::VecEnv() - The number of lobbies must be positive!");
+    }
+}
+
+void VecEnv::Reset()
+{
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_dones.begin(), m_dones.end(), std::uint8_t{ 0 });
+
+    m_pool.ParallelFor(m_lobbies.size(), [this](std::size_t idx) {
+        ResetLobby(idx);
+        UpdateLobby(idx);
+    });
+}
+
+void VecEnv::Step(const std::vector<int>& actions)
+{
+    if (actions.size() != m_lobbies.size() * NUM_PLAYERS)
+    {
+        throw std::invalid_argument(
+            "VecEnv::Step() - The number of actions must match the number of "
+            "players of all lobbies!");
+    }
+
+    for (std::size_t idx = 0; idx < actions.size(); ++idx)
+    {
+        if (m_lobbies[idx / NUM_PLAYERS].game == nullptr)
+        {
+            throw std::logic_error(
+                "VecEnv::Step() - Reset() must be called before Step()!");
+        }
+
+        const int action = actions[idx];
+        if (action < 0 || action >= static_cast<int>(ACTION_SIZE) ||
+            m_actionMasks[idx * ACTION_SIZE + action] == 0)
+        {
+            throw std::invalid_argument(
+                "VecEnv::Step() - Invalid action " + std::to_string(action) +
+                " of player " + std::to_string(idx % NUM_PLAYERS) +
+                " of lobby " + std::to_string(idx / NUM_PLAYERS));
+        }
+    }
+
+    m_pool.ParallelFor(m_lobbies.size(), [&](std::size_t idx) {
+        StepLobby(idx, &actions[idx * NUM_PLAYERS]);
+
+        if (ProcessRanks(idx))
+        {
+            m_dones[idx] = 1;
+            ResetLobby(idx);
+        }
+        else
+        {
+            m_dones[idx] = 0;
+        }
+
+        UpdateLobby(idx);
+    });
+}
+
+std::size_t VecEnv::GetNumLobbies() const
+{
+    return m_lobbies.size();
+}
+
+int VecEnv::GetRound(std::size_t idx) const
+{
+    return m_lobbies.at(idx).round;
+}
+
+Game& VecEnv::GetGame(std::size_t idx)
+{
+    return *m_lobbies.at(idx).game;
+}
+
+float* VecEnv::GetObservations()
+{
+    return m_observations.data();
+}
+
+float* VecEnv::GetRewards()
+{
+    return m_rewards.data();
+}
+
+std::uint8_t* VecEnv::GetDones()
+{
+    return m_dones.data();
+}
+
+std::uint8_t* VecEnv::GetActionMasks()
+{
+    return m_actionMasks.data();
+}
+
+void VecEnv::Seed(std::size_t idx)
+{
+    // NOTE: Streams of lobbies are interleaved, so they never overlap.
+    Lobby& lobby = m_lobbies[idx];
+    SeedRandom(m_seed, lobby.numSeeds++ * m_lobbies.size() + idx);
+}
+
+void VecEnv::ResetLobby(std::size_t idx)
+{
+    Lobby& lobby = m_lobbies[idx];
+    Seed(idx);
+
+    lobby.game = std::make_unique<Game>();
+    lobby.game->Start();
+
+    lobby.round = 0;
+    lobby.isReady.fill(false);
+    lobby.isRanked.fill(false);
+    lobby.numActions.fill(0);
+}
+
+void VecEnv::StepLobby(std::size_t idx, const int* actions)
+{
+    Lobby& lobby = m_lobbies[idx];
+    GameState& gameState = lobby.game->GetGameState();
+    const Phase phase = gameState.phase;
+    Seed(idx);
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        if (!CanAct(lobby, playerIdx))
+        {
+            continue;
+        }
+
+        Player& player = gameState.players[playerIdx];
+        const auto action = static_cast<std::size_t>(actions[playerIdx]);
+
+        // NOTE: An earlier action of this step can make the action illegal.
+        if (!ActionSpace::IsLegal(phase, player, action))
+        {
+            continue;
+        }
+
+        // NOTE: The last player to select a hero or end recruit advances the
+        // phase, so these actions are processed when all players are ready.
+        const ActionType type = ActionSpace::GetActionType(action);
+        if (type == ActionType::SELECT_HERO || type == ActionType::END_RECRUIT)
+        {
+            lobby.isReady[playerIdx] = true;
+            lobby.readyActions[playerIdx] = action;
+            continue;
+        }
+
+        ActionSpace::Apply(player, action);
+        ++lobby.numActions[playerIdx];
+    }
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        if (gameState.players[playerIdx].playState == PlayState::PLAYING &&
+            !lobby.isReady[playerIdx])
+        {
+            return;
+        }
+    }
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        Player& player = gameState.players[playerIdx];
+        if (player.playState == PlayState::PLAYING)
+        {
+            ActionSpace::Apply(player, lobby.readyActions[playerIdx]);
+        }
+    }
+
+    ++lobby.round;
+    lobby.isReady.fill(false);
+    lobby.numActions.fill(0);
+}
+
+bool VecEnv::ProcessRanks(std::size_t idx)
+{
+    Lobby& lobby = m_lobbies[idx];
+    GameState& gameState = lobby.game->GetGameState();
+    float* rewards = &m_rewards[idx * NUM_PLAYERS];
+
+    const bool isDone = gameState.phase == Phase::COMPLETE ||
+                        gameState.numRemainPlayer <= 1 ||
+                        lobby.round > MAX_NUM_ROUNDS;
+
+    if (isDone)
+    {
+        // Rank the remaining players according to their health
+        std::vector<Player*> players;
+        for (auto& player : gameState.players)
+        {
+            if (player.playState == PlayState::PLAYING)
+            {
+                players.emplace_back(&player);
+            }
+        }
+
+        std::stable_sort(players.begin(), players.end(),
+                         [](const Player* lhs, const Player* rhs) {
+                             return lhs->hero.health > rhs->hero.health;
+                         });
+        for (std::size_t i = 0; i < players.size(); ++i)
+        {
+            players[i]->rank = i + 1;
+        }
+    }
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        const Player& player = gameState.players[playerIdx];
+
+        if (!lobby.isRanked[playerIdx] &&
+            (isDone || player.playState != PlayState::PLAYING))
+        {
+            rewards[playerIdx] = GetRankReward(player.rank);
+            lobby.isRanked[playerIdx] = true;
+        }
+        else
+        {
+            rewards[playerIdx] = 0.0f;
+        }
+    }
+
+    return isDone;
+}
+
+bool VecEnv::CanAct(const Lobby& lobby, std::size_t playerIdx)
+{
+    const GameState& gameState = lobby.game->GetGameState();
+
+    return (gameState.phase == Phase::SELECT_HERO ||
+            gameState.phase == Phase::RECRUIT) &&
+           gameState.players[playerIdx].playState == PlayState::PLAYING &&
+           !lobby.isReady[playerIdx];
+}
+
+void VecEnv::UpdateLobby(std::size_t idx)
+{
+    Lobby& lobby = m_lobbies[idx];
+    GameState& gameState = lobby.game->GetGameState();
+
+    for (std::size_t playerIdx = 0; playerIdx < NUM_PLAYERS; ++playerIdx)
+    {
+        const std::size_t offset = idx * NUM_PLAYERS + playerIdx;
+        const bool canAct = CanAct(lobby, playerIdx);
+
+        ObservationEncoder::Encode(gameState, playerIdx, lobby.round, canAct,
+                                   &m_observations[offset * OBSERVATION_SIZE]);
+
+        std::uint8_t* mask = &m_actionMasks[offset * ACTION_SIZE];
+
+        // NOTE: Tavern actions like freeze don't cost coins, so allow only
+        // ending recruit when the player processes too many actions.
+        if (!canAct || lobby.numActions[playerIdx] >= MAX_AGENT_TASKS_PER_TURN)
+        {
+            std::fill(mask, mask + ACTION_SIZE, std::uint8_t{ 0 });
+            mask[ActionSpace::END_RECRUIT] = 1;
+        }
+        else
+        {
+            ActionSpace::GetActionMask(gameState.phase,
+                                       gameState.players[playerIdx], mask);
+        }
+    }
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -8,10 +8,13 @@
 #include <Rosetta/Battlegrounds/Games/Game.hpp>
 #include <Rosetta/Battlegrounds/Managers/GameManager.hpp>
 #include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Common/Utils.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+#include <limits>
+
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
@@ -20,133 +23,64 @@ GameState& Game::GetGameState()
     return m_gameState;
 }
 
-void Game::Start()
+void Game::RefCopyFrom(const Game& rhs)
 {
-    // Choose a race to exclude from the minion pool at random
-    const auto raceIdx =
-        Random::get<std::size_t>(0, RACES_IN_BATTLEGROUNDS.size() - 1);
-    m_excludeRace = RACES_IN_BATTLEGROUNDS.at(raceIdx);
-
-    // Initialize the minion pool
-    m_gameState.minionPool.Initialize(m_excludeRace);
-    m_playerFightPair.reserve(NUM_BATTLEGROUNDS_PLAYERS / 2);
-
-    // Create callback to increase player count and process next phase
-    auto selectHeroCallback = [this](Player& player) {
-        ++m_playerCount;
-
-        player.hero.health = player.hero.card.GetHealth();
-
-        if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
-        {
-            // Set next phase
-            m_gameState.nextPhase = Phase::RECRUIT;
-            GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
-        }
-    };
-
-    // Create callback to prepare a list of minions for purchase
-    auto prepareTavernMinionsCallback = [this](Player& player) {
-        m_gameState.minionPool.AddMinionsToTavern(player, player.tavern);
-    };
-
-    // Create callback to purchase a minion in Tavern
-    auto purchaseMinionCallback = [](Player& player, std::size_t tavernIdx) {
-        Minion minion =
-            player.tavern.fieldZone.Remove(player.tavern.fieldZone[tavernIdx]);
-        player.hand.Add(minion, -1);
-    };
-
-    // Create callback to get next card index
-    auto getNextCardIndexCallback = [this]() -> int { return m_cardIndex++; };
-
-    // Create callback to return a minion to the minion pool
-    auto returnMinionCallback = [this](int poolIdx) {
-        m_gameState.minionPool.ReturnMinion(poolIdx);
-    };
-
-    // Create callback to clear a list of minions in Tavern's field
-    auto clearTavernMinionsCallback = [this](Player& player) {
-        while (!player.tavern.fieldZone.IsEmpty())
-        {
-            Minion minion =
-                player.tavern.fieldZone.Remove(player.tavern.fieldZone[0]);
-            m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
-        }
-    };
-
-    // Create callback to upgrade player's Tavern to the next tier
-    auto upgradeTavernCallback = [](Player& player) {
-        ++player.currentTier;
-
-        // Set the value of coin to upgrade player's Tavern to the next tier
-        switch (player.currentTier)
-        {
-            case 2:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_3;
-                break;
-            case 3:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_4;
-                break;
-            case 4:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_5;
-                break;
-            case 5:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_6;
-                break;
-            default:
-                throw std::logic_error("Invalid player's current tier");
-        }
-    };
-
-    // Create callback to complete recruit and process next phase
-    auto completeRecruitCallback = [this]() {
-        ++m_playerCount;
-
-        if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
-        {
-            // Set next phase
-            m_gameState.nextPhase = Phase::COMBAT;
-            GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
-        }
-    };
-
-    // Create callback to get opponent player
-    auto getOpponentPlayerCallback = [this](Player& player) -> Player& {
-        const std::size_t idx = FindPlayerNextFight(player.idx);
-        return m_gameState.players[idx];
-    };
-
-    // Create callback to process the tasks related to defeat
-    auto processDefeatCallback = [this](Player& player) {
-        player.playState = PlayState::LOST;
+    if (this == &rhs)
+    {
+        return;
+    }
 
-        // Determine player's rank
-        player.rank = m_gameState.numRemainPlayer;
-        --m_gameState.numRemainPlayer;
+    m_gameState = rhs.m_gameState;
 
-        player.tavern.fieldZone.ForEach([&](MinionData& minion) {
-            m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
-        });
+    m_excludeRace = rhs.m_excludeRace;
+    m_playerFightPair = rhs.m_playerFightPair;
+    m_playerCount = rhs.m_playerCount;
+    m_cardIndex = rhs.m_cardIndex;
 
+    // NOTE: The copied players and minions refer to the game and the players
+    // of rhs, so point them to this game.
+    for (auto& player : m_gameState.players)
+    {
+        player.game = this;
+        player.battle = nullptr;
+        player.taskStack.minions.clear();
+
+        player.recruitField.ForEach(
+            [&](MinionData& minion) { minion.value().SetPlayer(player); });
+        player.battleField.ForEach(
+            [&](MinionData& minion) { minion.value().SetPlayer(player); });
+        player.tavern.fieldZone.ForEach(
+            [&](MinionData& minion) { minion.value().SetPlayer(player); });
         player.hand.ForEach([&](std::optional<CardData>& card) {
             if (std::holds_alternative<Minion>(card.value()))
             {
-                const auto minion = std::get<Minion>(card.value());
-                m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
+                std::get<Minion>(card.value()).SetPlayer(player);
             }
         });
+    }
+}
 
-        player.recruitField.ForEach([&](MinionData& minion) {
-            m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
-        });
+void Game::SetThreadPool(ThreadPool* pool)
+{
+    m_threadPool = pool;
+}
 
-        m_gameState.ghostPlayerIdx = player.idx;
-    };
+void Game::Start()
+{
+    // Choose a race to exclude from the minion pool at random
+    const auto raceIdx =
+        Random::get<std::size_t>(0, RACES_IN_BATTLEGROUNDS.size() - 1);
+    m_excludeRace = RACES_IN_BATTLEGROUNDS.at(raceIdx);
+
+    // Initialize the minion pool
+    // NOTE: The lists of minions are filled when cards are loaded.
+    Cards::GetInstance();
+    m_gameState.minionPool.Initialize(m_excludeRace);
+    m_playerFightPair.reserve(NUM_BATTLEGROUNDS_PLAYERS / 2);
 
     std::size_t playerIdx = 0;
 
-    // Initialize variables and callbacks
+    // Initialize variables
     for (auto& player : m_gameState.players)
     {
         player.playState = PlayState::PLAYING;
@@ -157,16 +91,7 @@ void Game::Start()
         player.currentTier = 1;
         player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_2 + 1;
 
-        player.selectHeroCallback = selectHeroCallback;
-        player.prepareTavernMinionsCallback = prepareTavernMinionsCallback;
-        player.purchaseMinionCallback = purchaseMinionCallback;
-        player.getNextCardIndexCallback = getNextCardIndexCallback;
-        player.returnMinionCallback = returnMinionCallback;
-        player.clearTavernMinionsCallback = clearTavernMinionsCallback;
-        player.upgradeTavernCallback = upgradeTavernCallback;
-        player.completeRecruitCallback = completeRecruitCallback;
-        player.getOpponentPlayerCallback = getOpponentPlayerCallback;
-        player.processDefeatCallback = processDefeatCallback;
+        player.game = this;
 
         ++playerIdx;
     }
@@ -206,7 +131,7 @@ void Game::Recruit()
         return;
     }
 
-    // Initialize player count for callback
+    // Initialize player count to complete recruit
     m_playerCount = 0;
 
     // Determine each player's opponent
@@ -220,7 +145,7 @@ void Game::Recruit()
         }
 
         // Set the flag
-        player.isInCombat = true;
+        player.isInCombat = false;
 
         // Assign the index of the player to fight next.
         player.playerIdxNextFight = FindPlayerNextFight(player.idx);
@@ -264,19 +189,56 @@ void Game::Combat()
         player.isInCombat = true;
     }
 
-    // Simulates a battle for each pair
+    const std::size_t numBattles = m_playerFightPair.size();
+    std::vector<Battle> battles;
+    battles.reserve(numBattles);
+
     for (const auto& pair : m_playerFightPair)
     {
         Player& player1 = m_gameState.players.at(std::get<0>(pair));
         Player& player2 = m_gameState.players.at(std::get<1>(pair));
 
-        Battle battle(player1, player2);
+        Battle& battle = battles.emplace_back(player1, player2);
+        player1.battle = &battle;
+        player2.battle = &battle;
+    }
+
+    // NOTE: Each battle uses its own stream of random numbers, so the result
+    // doesn't depend on the thread that simulates it.
+    const auto seed = Random::get<std::uint64_t>(
+        0, std::numeric_limits<std::uint64_t>::max());
+    const auto simulateBattle = [&](std::size_t idx) {
+        SeedRandom(seed, idx);
+        battles[idx].Simulate();
+    };
+
+    // Simulates a battle for each pair
+    if (m_threadPool != nullptr)
+    {
+        m_threadPool->ParallelFor(numBattles, simulateBattle);
+    }
+    else
+    {
+        for (std::size_t idx = 0; idx < numBattles; ++idx)
+        {
+            simulateBattle(idx);
+        }
+    }
+
+    // NOTE: The calling thread may have simulated any of battles, so continue
+    // the game with a new stream.
+    SeedRandom(seed, numBattles);
 
-        // Create callback to get battle
-        player1.getBattleCallback = [&]() -> Battle& { return battle; };
-        player2.getBattleCallback = [&]() -> Battle& { return battle; };
+    // Apply damages in the order of pairs because defeating a player changes
+    // the shared state like ranks, the ghost and the minion pool
+    for (auto& battle : battles)
+    {
+        battle.ProcessDamage();
+    }
 
-        battle.Run();
+    for (auto& player : m_gameState.players)
+    {
+        player.battle = nullptr;
     }
 
     // Set next phase
@@ -311,6 +273,11 @@ void Game::DetermineOpponent()
     }
     else
     {
+        for (auto& player : m_gameState.players)
+        {
+            player.isFoughtGhostLastTurn = false;
+        }
+
         // Pair a list of players
         PairPlayers(playerData);
     }
@@ -344,22 +311,40 @@ std::size_t Game::DeterminePlayerToFightGhost(
     std::vector<std::tuple<int, int>>& playerData)
 {
     // Bottom 3 have a chance to play the ghost
-    std::vector<int> ghostCandidates;
+    std::vector<std::size_t> ghostCandidates;
 
     for (std::size_t i = playerData.size() - 3; i < playerData.size(); ++i)
     {
+        const auto playerIdx = static_cast<std::size_t>(
+            std::get<0>(playerData.at(i)));
+
         // Can't fight a ghost 2 turns in a row
-        if (m_gameState.players.at(i).isFoughtGhostLastTurn)
+        if (m_gameState.players.at(playerIdx).isFoughtGhostLastTurn)
         {
             continue;
         }
 
-        ghostCandidates.emplace_back(i);
+        ghostCandidates.emplace_back(playerIdx);
+    }
+
+    // NOTE: If all of them fought the ghost last turn, any of them can fight.
+    if (ghostCandidates.empty())
+    {
+        for (std::size_t i = playerData.size() - 3; i < playerData.size(); ++i)
+        {
+            ghostCandidates.emplace_back(
+                static_cast<std::size_t>(std::get<0>(playerData.at(i))));
+        }
     }
 
     // Fight randomly selected player and the ghost
-    const std::size_t idx =
-        Random::get<std::size_t>(0, ghostCandidates.size() - 1);
+    const std::size_t idx = ghostCandidates.at(
+        Random::get<std::size_t>(0, ghostCandidates.size() - 1));
+
+    for (auto& player : m_gameState.players)
+    {
+        player.isFoughtGhostLastTurn = player.idx == idx;
+    }
 
     // Remove the index of randomly selected player from player data
     playerData.erase(std::remove_if(playerData.begin(), playerData.end(),
@@ -420,6 +405,68 @@ void Game::PairPlayers(std::vector<std::tuple<int, int>>& playerData)
     }
 }
 
+void Game::CompleteSelectHero()
+{
+    ++m_playerCount;
+
+    if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
+    {
+        // Set next phase
+        m_gameState.nextPhase = Phase::RECRUIT;
+        GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
+    }
+}
+
+void Game::CompleteRecruit()
+{
+    ++m_playerCount;
+
+    // NOTE: Only players that are still playing complete recruit phase.
+    if (m_playerCount >= static_cast<int>(m_gameState.numRemainPlayer))
+    {
+        // Set next phase
+        m_gameState.nextPhase = Phase::COMBAT;
+        GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
+    }
+}
+
+int Game::GetNextCardIndex()
+{
+    return m_cardIndex++;
+}
+
+Player& Game::GetOpponentPlayer(const Player& player)
+{
+    return m_gameState.players[FindPlayerNextFight(player.idx)];
+}
+
+void Game::ProcessDefeat(Player& player)
+{
+    player.playState = PlayState::LOST;
+
+    // Determine player's rank
+    player.rank = m_gameState.numRemainPlayer;
+    --m_gameState.numRemainPlayer;
+
+    player.tavern.fieldZone.ForEach([&](MinionData& minion) {
+        m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
+    });
+
+    player.hand.ForEach([&](std::optional<CardData>& card) {
+        if (std::holds_alternative<Minion>(card.value()))
+        {
+            const auto& minion = std::get<Minion>(card.value());
+            m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
+        }
+    });
+
+    player.recruitField.ForEach([&](MinionData& minion) {
+        m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
+    });
+
+    m_gameState.ghostPlayerIdx = player.idx;
+}
+
 std::size_t Game::FindPlayerNextFight(std::size_t playerIdx)
 {
     for (const auto& fightPair : m_playerFightPair)
@@ -8,7 +8,9 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+#include <algorithm>
+
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
@@ -20,6 +22,13 @@ Battle::Battle(Player& player1, Player& player2)
 {
     m_player1.battleField = m_player1.recruitField;
     m_player2.battleField = m_player2.recruitField;
+
+    for (FieldZone* field : { &m_p1Field, &m_p2Field })
+    {
+        field->ForEach([&](MinionData& minion) {
+            m_cardIndex = std::max(m_cardIndex, minion.value().GetIndex() + 1);
+        });
+    }
 }
 
 void Battle::Initialize()
@@ -47,6 +56,8 @@ void Battle::Initialize()
     m_p1NextAttackerIdx = 0;
     m_p2NextAttackerIdx = 0;
 
+    BeginTasks();
+
     if (m_turn == Turn::PLAYER1)
     {
         m_p1Field.ForEach([&](MinionData& minion) {
@@ -66,10 +77,17 @@ void Battle::Initialize()
         });
     }
 
+    EndTasks();
     ProcessDestroy(true);
 }
 
 void Battle::Run()
+{
+    Simulate();
+    ProcessDamage();
+}
+
+void Battle::Simulate()
 {
     Initialize();
 
@@ -79,43 +97,13 @@ void Battle::Run()
     {
         if (m_turn == Turn::PLAYER1)
         {
-            m_p1Field.ForEachAlive([&](MinionData& owner) {
-                m_p1Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& owner) {
-                m_p2Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
+            ActivateTurnStartTriggers(m_p1Field, m_p1Board);
+            ActivateTurnStartTriggers(m_p2Field, m_p2Board);
         }
         else
         {
-            m_p2Field.ForEachAlive([&](MinionData& owner) {
-                m_p2Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
-
-            m_p1Field.ForEachAlive([&](MinionData& owner) {
-                m_p1Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
+            ActivateTurnStartTriggers(m_p2Field, m_p2Board);
+            ActivateTurnStartTriggers(m_p1Field, m_p1Board);
         }
 
         const bool curAttackSuccess = Attack();
@@ -129,15 +117,18 @@ void Battle::Run()
     }
 
     ProcessResult();
+    m_damage = CalculateDamage();
+}
 
-    const int damage = CalculateDamage();
+void Battle::ProcessDamage()
+{
     if (m_result == BattleResult::PLAYER1_WIN)
     {
-        m_player2.hero.TakeDamage(m_player2, damage);
+        m_player2.hero.TakeDamage(m_player2, m_damage);
     }
     else if (m_result == BattleResult::PLAYER2_WIN)
     {
-        m_player1.hero.TakeDamage(m_player1, damage);
+        m_player1.hero.TakeDamage(m_player1, m_damage);
     }
 }
 
@@ -157,6 +148,16 @@ bool Battle::Attack()
     target.TakeDamage(attacker);
     attacker.TakeDamage(target);
 
+    if (m_isBoardLoaded)
+    {
+        CombatBoard& attackerBoard =
+            (m_turn == Turn::PLAYER1) ? m_p1Board : m_p2Board;
+        CombatBoard& targetBoard =
+            (m_turn == Turn::PLAYER1) ? m_p2Board : m_p1Board;
+        attackerBoard.Update(attackerIdx, attacker);
+        targetBoard.Update(target.GetZonePosition(), target);
+    }
+
     ProcessDestroy(false);
 
     m_turn = (m_turn == Turn::PLAYER1) ? Turn::PLAYER2 : Turn::PLAYER1;
@@ -165,48 +166,37 @@ bool Battle::Attack()
 
 int Battle::FindAttacker()
 {
-    FieldZone& fieldZone = (m_turn == Turn::PLAYER1) ? m_p1Field : m_p2Field;
+    LoadBoards();
+
+    const CombatBoard& board =
+        (m_turn == Turn::PLAYER1) ? m_p1Board : m_p2Board;
     int nextAttackerIdx =
         (m_turn == Turn::PLAYER1) ? m_p1NextAttackerIdx : m_p2NextAttackerIdx;
 
-    for (int i = 0; i < fieldZone.GetCount(); ++i)
+    // NOTE: Destroyed minions can leave the index out of the field.
+    if (nextAttackerIdx >= board.GetCount())
     {
-        if (fieldZone[nextAttackerIdx].GetAttack() > 0)
-        {
-            return nextAttackerIdx;
-        }
-
-        ++nextAttackerIdx;
-        if (nextAttackerIdx == fieldZone.GetCount())
-        {
-            nextAttackerIdx = 0;
-        }
+        nextAttackerIdx = 0;
     }
 
-    return -1;
+    return CombatBoard::FindNextBit(board.GetAttackerMask(), nextAttackerIdx);
 }
 
 Minion& Battle::GetProperTarget([[maybe_unused]] Minion& attacker)
 {
-    auto& minions = (m_turn == Turn::PLAYER1) ? m_p2Field : m_p1Field;
+    LoadBoards();
 
-    std::vector<std::size_t> tauntMinions;
-    tauntMinions.reserve(MAX_FIELD_SIZE);
-
-    std::size_t minionIdx = 0;
-    minions.ForEach([&](const MinionData& minion) {
-        if (minion.value().HasTaunt())
-        {
-            tauntMinions.emplace_back(minionIdx);
-        }
-
-        ++minionIdx;
-    });
+    auto& minions = (m_turn == Turn::PLAYER1) ? m_p2Field : m_p1Field;
+    const CombatBoard& board =
+        (m_turn == Turn::PLAYER1) ? m_p2Board : m_p1Board;
 
-    if (!tauntMinions.empty())
+    const CombatBoard::Mask tauntMask = board.GetTauntMask();
+    if (tauntMask != 0)
     {
-        const auto idx = Random::get<std::size_t>(0, tauntMinions.size() - 1);
-        return minions[tauntMinions[idx]];
+        const auto numTaunts =
+            static_cast<std::size_t>(CombatBoard::CountBits(tauntMask));
+        const auto idx = Random::get<std::size_t>(0, numTaunts - 1);
+        return minions[CombatBoard::FindBit(tauntMask, static_cast<int>(idx))];
     }
 
     const auto idx = Random::get<int>(0, minions.GetCount() - 1);
@@ -215,54 +205,37 @@ Minion& Battle::GetProperTarget([[maybe_unused]] Minion& attacker)
 
 void Battle::ProcessDestroy(bool beforeAttack)
 {
-    std::vector<std::tuple<int, Minion&>> deadMinions;
+    // NOTE: Removing a minion shifts the minions on its right, so keep the
+    // number of dead minions of each player and find them when processed.
+    // The minions of the player who doesn't attack are processed first.
+    LoadBoards();
 
-    if (m_turn == Turn::PLAYER1)
-    {
-        m_p2Field.ForEach([&](MinionData& minion) {
-            if (minion.value().IsDestroyed())
-            {
-                deadMinions.emplace_back(
-                    std::make_tuple(2, std::ref(minion.value())));
-            }
-        });
-
-        m_p1Field.ForEach([&](MinionData& minion) {
-            if (minion.value().IsDestroyed())
-            {
-                deadMinions.emplace_back(
-                    std::make_tuple(1, std::ref(minion.value())));
-            }
-        });
-    }
-    else
-    {
-        m_p1Field.ForEach([&](MinionData& minion) {
-            if (minion.value().IsDestroyed())
-            {
-                deadMinions.emplace_back(
-                    std::make_tuple(1, std::ref(minion.value())));
-            }
-        });
-
-        m_p2Field.ForEach([&](MinionData& minion) {
-            if (minion.value().IsDestroyed())
-            {
-                deadMinions.emplace_back(
-                    std::make_tuple(2, std::ref(minion.value())));
-            }
-        });
-    }
+    const int p1NumDead = CombatBoard::CountBits(m_p1Board.GetDestroyedMask());
+    const int p2NumDead = CombatBoard::CountBits(m_p2Board.GetDestroyedMask());
+    const int firstPlayer = (m_turn == Turn::PLAYER1) ? 2 : 1;
+    const int numFirstDead = (m_turn == Turn::PLAYER1) ? p2NumDead : p1NumDead;
 
     // A variable to check a minion at the index of next attacker is destroyed
     bool isAttackerDestroyed = false;
 
-    for (auto& deadMinion : deadMinions)
+    for (int i = 0; i < p1NumDead + p2NumDead; ++i)
     {
-        Minion& minion = std::get<1>(deadMinion);
+        LoadBoards();
+
+        const int deadPlayer = i < numFirstDead ? firstPlayer : 3 - firstPlayer;
+        FieldZone& fieldZone = deadPlayer == 1 ? m_p1Field : m_p2Field;
+        CombatBoard& board = deadPlayer == 1 ? m_p1Board : m_p2Board;
+
+        const int deadPos = CombatBoard::FindBit(board.GetDestroyedMask(), 0);
+        if (deadPos == -1)
+        {
+            continue;
+        }
+
+        Minion& minion = fieldZone[deadPos];
         Minion removedMinion;
 
-        if (std::get<0>(deadMinion) == 1)
+        if (deadPlayer == 1)
         {
             if (!beforeAttack)
             {
@@ -282,16 +255,14 @@ void Battle::ProcessDestroy(bool beforeAttack)
                 }
             }
 
-            m_p1Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
+            ActivateDeathTriggers(minion);
 
             minion.SetLastFieldPos(minion.GetZonePosition());
             removedMinion = m_p1Field.Remove(minion);
+            if (m_isBoardLoaded)
+            {
+                board.Remove(deadPos);
+            }
         }
         else
         {
@@ -313,24 +284,23 @@ void Battle::ProcessDestroy(bool beforeAttack)
                 }
             }
 
-            m_p1Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
+            ActivateDeathTriggers(minion);
 
             minion.SetLastFieldPos(minion.GetZonePosition());
             removedMinion = m_p2Field.Remove(minion);
+            if (m_isBoardLoaded)
+            {
+                board.Remove(deadPos);
+            }
         }
 
         // Process deathrattle tasks
         if (removedMinion.HasDeathrattle())
         {
-            removedMinion.ActivateTask(
-                PowerType::DEATHRATTLE,
-                std::get<0>(deadMinion) == 1 ? m_player1 : m_player2);
+            BeginTasks();
+            removedMinion.ActivateTask(PowerType::DEATHRATTLE,
+                                       deadPlayer == 1 ? m_player1 : m_player2);
+            EndTasks();
         }
     }
 
@@ -351,11 +321,11 @@ void Battle::ProcessDestroy(bool beforeAttack)
         }
 
         // Check the boundaries of field zone
-        if (m_p1NextAttackerIdx == m_p1Field.GetCount())
+        if (m_p1NextAttackerIdx >= m_p1Field.GetCount())
         {
             m_p1NextAttackerIdx = 0;
         }
-        if (m_p2NextAttackerIdx == m_p2Field.GetCount())
+        if (m_p2NextAttackerIdx >= m_p2Field.GetCount())
         {
             m_p2NextAttackerIdx = 0;
         }
@@ -431,4 +401,97 @@ BattleResult Battle::GetResult() const
 {
     return m_result;
 }
+
+Player& Battle::GetOpponentPlayer(const Player& player) const
+{
+    return &player == &m_player1 ? m_player2 : m_player1;
+}
+
+int Battle::GetNextCardIndex()
+{
+    return m_cardIndex++;
+}
+
+void Battle::LoadBoards()
+{
+    if (m_isBoardLoaded)
+    {
+        return;
+    }
+
+    m_p1Board.Load(m_p1Field);
+    m_p2Board.Load(m_p2Field);
+
+    // NOTE: A running task can change the battle fields after the boards are
+    // loaded, so they are loaded again whenever they are used.
+    m_isBoardLoaded = m_numRunningTasks == 0;
+}
+
+void Battle::BeginTasks()
+{
+    ++m_numRunningTasks;
+    m_isBoardLoaded = false;
+}
+
+void Battle::EndTasks()
+{
+    --m_numRunningTasks;
+    m_isBoardLoaded = false;
+}
+
+void Battle::ActivateTurnStartTriggers(FieldZone& field,
+                                       const CombatBoard& board)
+{
+    LoadBoards();
+    if (board.GetTriggerMask(TriggerType::TURN_START) == 0)
+    {
+        return;
+    }
+
+    BeginTasks();
+
+    field.ForEachAlive([&](MinionData& owner) {
+        field.ForEachAlive([&](MinionData& minion) {
+            owner.value().ActivateTrigger(TriggerType::TURN_START,
+                                          minion.value());
+        });
+    });
+
+    EndTasks();
+}
+
+void Battle::ActivateDeathTriggers(Minion& deadMinion)
+{
+    // NOTE: Most minions don't have a trigger of death, so skip the fields
+    // that have none.
+    const bool hasP1Triggers =
+        m_p1Board.GetTriggerMask(TriggerType::DEATH) != 0;
+    const bool hasP2Triggers =
+        m_p2Board.GetTriggerMask(TriggerType::DEATH) != 0;
+
+    if (!hasP1Triggers && !hasP2Triggers)
+    {
+        return;
+    }
+
+    BeginTasks();
+
+    if (hasP1Triggers)
+    {
+        m_p1Field.ForEachAlive([&](MinionData& aliveMinion) {
+            aliveMinion.value().ActivateTrigger(TriggerType::DEATH,
+                                                deadMinion);
+        });
+    }
+
+    if (hasP2Triggers)
+    {
+        m_p2Field.ForEachAlive([&](MinionData& aliveMinion) {
+            aliveMinion.value().ActivateTrigger(TriggerType::DEATH,
+                                                deadMinion);
+        });
+    }
+
+    EndTasks();
+}
 }  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,154 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Models/CombatBoard.hpp>
+
+#include <bitset>
+
+namespace RosettaStone::Battlegrounds
+{
+void CombatBoard::Load(const FieldZone& field)
+{
+    m_count = field.GetCount();
+    m_triggerMasks.fill(0);
+    m_aliveMask = 0;
+    m_attackerMask = 0;
+    m_tauntMask = 0;
+
+    for (int i = 0; i < m_count; ++i)
+    {
+        Update(i, field[i]);
+    }
+}
+
+void CombatBoard::Update(int pos, const Minion& minion)
+{
+    m_attack[pos] = minion.GetAttack();
+    m_health[pos] = minion.GetHealth();
+    m_keywords[pos] = static_cast<std::uint8_t>(
+        (minion.HasTaunt() ? TAUNT : 0) |
+        (minion.HasDivineShield() ? DIVINE_SHIELD : 0) |
+        (minion.HasDeathrattle() ? DEATHRATTLE : 0));
+
+    const TriggerType triggerType = minion.GetTriggerType();
+    SetBit(m_triggerMasks[static_cast<std::size_t>(m_triggerTypes[pos])], pos,
+           false);
+    SetBit(m_triggerMasks[static_cast<std::size_t>(triggerType)], pos, true);
+    m_triggerTypes[pos] = triggerType;
+
+    SetBit(m_aliveMask, pos, !minion.IsDestroyed());
+    SetBit(m_attackerMask, pos, m_attack[pos] > 0);
+    SetBit(m_tauntMask, pos, (m_keywords[pos] & TAUNT) != 0);
+}
+
+void CombatBoard::Remove(int pos)
+{
+    for (int i = pos; i < m_count - 1; ++i)
+    {
+        m_attack[i] = m_attack[i + 1];
+        m_health[i] = m_health[i + 1];
+        m_keywords[i] = m_keywords[i + 1];
+        m_triggerTypes[i] = m_triggerTypes[i + 1];
+    }
+
+    for (Mask& mask : m_triggerMasks)
+    {
+        RemoveBit(mask, pos);
+    }
+
+    RemoveBit(m_aliveMask, pos);
+    RemoveBit(m_attackerMask, pos);
+    RemoveBit(m_tauntMask, pos);
+    --m_count;
+}
+
+int CombatBoard::GetCount() const
+{
+    return m_count;
+}
+
+int CombatBoard::GetAttack(int pos) const
+{
+    return m_attack[pos];
+}
+
+int CombatBoard::GetHealth(int pos) const
+{
+    return m_health[pos];
+}
+
+std::uint8_t CombatBoard::GetKeywords(int pos) const
+{
+    return m_keywords[pos];
+}
+
+TriggerType CombatBoard::GetTriggerType(int pos) const
+{
+    return m_triggerTypes[pos];
+}
+
+CombatBoard::Mask CombatBoard::GetAliveMask() const
+{
+    return static_cast<Mask>(((1 << m_count) - 1) & m_aliveMask);
+}
+
+CombatBoard::Mask CombatBoard::GetDestroyedMask() const
+{
+    return static_cast<Mask>(((1 << m_count) - 1) & ~m_aliveMask);
+}
+
+CombatBoard::Mask CombatBoard::GetAttackerMask() const
+{
+    return static_cast<Mask>(GetAliveMask() & m_attackerMask);
+}
+
+CombatBoard::Mask CombatBoard::GetTauntMask() const
+{
+    return static_cast<Mask>(GetAliveMask() & m_tauntMask);
+}
+
+CombatBoard::Mask CombatBoard::GetTriggerMask(TriggerType type) const
+{
+    return m_triggerMasks[static_cast<std::size_t>(type)];
+}
+
+int CombatBoard::CountBits(Mask mask)
+{
+    return static_cast<int>(std::bitset<8>(mask).count());
+}
+
+int CombatBoard::FindBit(Mask mask, int n)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        if ((mask >> i & 1) != 0 && n-- == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int CombatBoard::FindNextBit(Mask mask, int pos)
+{
+    const auto upper = static_cast<Mask>(mask & (0xFF << pos));
+
+    return FindBit(upper != 0 ? upper : mask, 0);
+}
+
+void CombatBoard::SetBit(Mask& mask, int pos, bool value)
+{
+    const auto bit = static_cast<Mask>(1 << pos);
+    mask = static_cast<Mask>(value ? mask | bit : mask & ~bit);
+}
+
+void CombatBoard::RemoveBit(Mask& mask, int pos)
+{
+    const auto lowMask = static_cast<Mask>((1 << pos) - 1);
+    mask = static_cast<Mask>((mask & lowMask) | ((mask >> 1) & ~lowMask));
+}
+}  // namespace RosettaStone::Battlegrounds
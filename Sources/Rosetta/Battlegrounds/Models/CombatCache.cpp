@@ -0,0 +1,198 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Models/CombatBoard.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+#include <iterator>
+#include <stdexcept>
+
+namespace RosettaStone::Battlegrounds
+{
+double CombatCacheStats::GetHitRate() const
+{
+    const std::size_t numLookups = numHits + numMisses;
+
+    return numLookups == 0 ? 0.0
+                           : static_cast<double>(numHits) /
+                                 static_cast<double>(numLookups);
+}
+
+bool CombatCache::BoardKey::operator==(const BoardKey& rhs) const
+{
+    if (hash != rhs.hash || tier != rhs.tier || count != rhs.count)
+    {
+        return false;
+    }
+
+    for (int pos = 0; pos < count; ++pos)
+    {
+        const Slot& lhsSlot = slots[pos];
+        const Slot& rhsSlot = rhs.slots[pos];
+
+        if (lhsSlot.dbfID != rhsSlot.dbfID ||
+            lhsSlot.attack != rhsSlot.attack ||
+            lhsSlot.health != rhsSlot.health ||
+            lhsSlot.keywords != rhsSlot.keywords)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+CombatCache::CombatCache(CombatEstimator& estimator, std::size_t capacity)
+    : m_estimator(estimator), m_capacity(capacity)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument(
+            "CombatCache::CombatCache() - Capacity must be positive.");
+    }
+
+    m_index.reserve(capacity);
+}
+
+const CombatStats& CombatCache::Estimate(const FieldZone& board1, int tier1,
+                                         const FieldZone& board2, int tier2,
+                                         std::size_t numRuns,
+                                         std::uint64_t seed)
+{
+    const BoardKey key1 = MakeKey(board1, tier1);
+    const BoardKey key2 = MakeKey(board2, tier2);
+
+    if (const CombatStats* stats = Find(key1, key2);
+        stats != nullptr && stats->numRuns >= numRuns)
+    {
+        ++m_stats.numHits;
+        return *stats;
+    }
+
+    ++m_stats.numMisses;
+    return Add(key1, key2,
+               m_estimator.Estimate(board1, tier1, board2, tier2, numRuns,
+                                    seed));
+}
+
+const CombatStats* CombatCache::Find(const BoardKey& key1,
+                                     const BoardKey& key2)
+{
+    const auto iter = m_index.find({ key1.hash, key2.hash });
+    if (iter == m_index.end())
+    {
+        return nullptr;
+    }
+
+    // NOTE: The hashes of another pair can collide with the pair.
+    Entry& entry = *iter->second;
+    if (!(entry.board1 == key1) || !(entry.board2 == key2))
+    {
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, iter->second);
+    return &entry.stats;
+}
+
+const CombatStats& CombatCache::Add(const BoardKey& key1,
+                                    const BoardKey& key2,
+                                    const CombatStats& stats)
+{
+    const Key key{ key1.hash, key2.hash };
+
+    if (const auto iter = m_index.find(key); iter != m_index.end())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, iter->second);
+        *iter->second = { key, key1, key2, stats };
+        return iter->second->stats;
+    }
+
+    if (m_entries.size() == m_capacity)
+    {
+        // NOTE: Reuses the node of the least recently used results.
+        m_index.erase(m_entries.back().key);
+        m_entries.splice(m_entries.begin(), m_entries,
+                         std::prev(m_entries.end()));
+        m_entries.front() = { key, key1, key2, stats };
+        ++m_stats.numEvictions;
+    }
+    else
+    {
+        m_entries.push_front({ key, key1, key2, stats });
+    }
+
+    m_index.emplace(key, m_entries.begin());
+    return m_entries.front().stats;
+}
+
+void CombatCache::Clear()
+{
+    m_entries.clear();
+    m_index.clear();
+    m_stats = CombatCacheStats{};
+}
+
+std::size_t CombatCache::GetSize() const
+{
+    return m_entries.size();
+}
+
+std::size_t CombatCache::GetCapacity() const
+{
+    return m_capacity;
+}
+
+const CombatCacheStats& CombatCache::GetStats() const
+{
+    return m_stats;
+}
+
+CombatCache::BoardKey CombatCache::MakeKey(const FieldZone& board, int tier)
+{
+    BoardKey key;
+    key.tier = tier;
+    key.count = board.GetCount();
+
+    CombineHash(key.hash, tier);
+    CombineHash(key.hash, key.count);
+
+    for (int pos = 0; pos < key.count; ++pos)
+    {
+        const Minion& minion = board[pos];
+        BoardKey::Slot& slot = key.slots[pos];
+
+        slot.dbfID = minion.GetCard().dbfID;
+        slot.attack = minion.GetAttack();
+        slot.health = minion.GetHealth();
+        slot.keywords = static_cast<std::uint8_t>(
+            (minion.HasTaunt() ? CombatBoard::TAUNT : 0) |
+            (minion.HasDivineShield() ? CombatBoard::DIVINE_SHIELD : 0) |
+            (minion.HasDeathrattle() ? CombatBoard::DEATHRATTLE : 0));
+
+        CombineHash(key.hash, slot.dbfID);
+        CombineHash(key.hash, slot.attack);
+        CombineHash(key.hash, slot.health);
+        CombineHash(key.hash, static_cast<int>(slot.keywords));
+    }
+
+    return key;
+}
+
+std::size_t CombatCache::ComputeHash(const FieldZone& board, int tier)
+{
+    return MakeKey(board, tier).hash;
+}
+
+std::size_t CombatCache::KeyHash::operator()(const Key& key) const
+{
+    std::size_t seed = key.first;
+    CombineHash(seed, key.second);
+
+    return seed;
+}
+}  // namespace RosettaStone::Battlegrounds
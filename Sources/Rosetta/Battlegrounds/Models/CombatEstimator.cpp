@@ -0,0 +1,170 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatEstimator.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone::Battlegrounds
+{
+double CombatStats::GetWinRate() const
+{
+    return numRuns == 0 ? 0.0
+                        : static_cast<double>(numWins) /
+                              static_cast<double>(numRuns);
+}
+
+double CombatStats::GetTieRate() const
+{
+    return numRuns == 0 ? 0.0
+                        : static_cast<double>(numTies) /
+                              static_cast<double>(numRuns);
+}
+
+double CombatStats::GetLossRate() const
+{
+    return numRuns == 0 ? 0.0
+                        : static_cast<double>(numLosses) /
+                              static_cast<double>(numRuns);
+}
+
+double CombatStats::GetExpectedDamage() const
+{
+    if (numRuns == 0)
+    {
+        return 0.0;
+    }
+
+    double totalDamage = 0.0;
+    for (std::size_t damage = 0; damage < damageDealt.size(); ++damage)
+    {
+        totalDamage += static_cast<double>(damage) *
+                       (static_cast<double>(damageDealt[damage]) -
+                        static_cast<double>(damageTaken[damage]));
+    }
+
+    return totalDamage / static_cast<double>(numRuns);
+}
+
+CombatStats& CombatStats::operator+=(const CombatStats& rhs)
+{
+    numRuns += rhs.numRuns;
+    numWins += rhs.numWins;
+    numTies += rhs.numTies;
+    numLosses += rhs.numLosses;
+
+    for (std::size_t damage = 0; damage < damageDealt.size(); ++damage)
+    {
+        damageDealt[damage] += rhs.damageDealt[damage];
+        damageTaken[damage] += rhs.damageTaken[damage];
+    }
+
+    return *this;
+}
+
+CombatEstimator::CombatEstimator(ThreadPool& pool)
+    : m_pool(pool), m_slots(pool.GetNumThreads())
+{
+    for (auto& slot : m_slots)
+    {
+        Player& player1 = slot.player1;
+        Player& player2 = slot.player2;
+
+        player1.idx = 0;
+        player2.idx = 1;
+
+        for (Player* player : { &player1, &player2 })
+        {
+            player->playState = PlayState::PLAYING;
+            player->isInCombat = true;
+        }
+    }
+}
+
+CombatStats CombatEstimator::Estimate(const FieldZone& board1, int tier1,
+                                      const FieldZone& board2, int tier2,
+                                      std::size_t numRuns, std::uint64_t seed)
+{
+    const std::size_t numChunks =
+        (numRuns + NUM_RUNS_PER_CHUNK - 1) / NUM_RUNS_PER_CHUNK;
+    const std::size_t numSlots = std::min(m_slots.size(), numChunks);
+
+    m_pool.ParallelFor(numSlots, [&](std::size_t slotIdx) {
+        Slot& slot = m_slots[slotIdx];
+        slot.stats = CombatStats{};
+
+        SetBoard(slot, slot.player1, board1, tier1);
+        SetBoard(slot, slot.player2, board2, tier2);
+
+        // NOTE: Chunks are assigned to slots regardless of the thread that
+        // runs the slot, and each chunk seeds its own stream.
+        for (std::size_t chunk = slotIdx; chunk < numChunks; chunk += numSlots)
+        {
+            SeedRandom(seed, chunk);
+
+            const std::size_t begin = chunk * NUM_RUNS_PER_CHUNK;
+            const std::size_t end =
+                std::min(begin + NUM_RUNS_PER_CHUNK, numRuns);
+
+            for (std::size_t run = begin; run < end; ++run)
+            {
+                Battle battle(slot.player1, slot.player2);
+                slot.player1.battle = &battle;
+                slot.player2.battle = &battle;
+
+                battle.Simulate();
+
+                const auto damage = static_cast<std::size_t>(
+                    std::min(battle.CalculateDamage(), MAX_BATTLE_DAMAGE));
+
+                ++slot.stats.numRuns;
+                switch (battle.GetResult())
+                {
+                    case BattleResult::PLAYER1_WIN:
+                        ++slot.stats.numWins;
+                        ++slot.stats.damageDealt[damage];
+                        break;
+                    case BattleResult::PLAYER2_WIN:
+                        ++slot.stats.numLosses;
+                        ++slot.stats.damageTaken[damage];
+                        break;
+                    default:
+                        ++slot.stats.numTies;
+                        break;
+                }
+            }
+        }
+
+        slot.player1.battle = nullptr;
+        slot.player2.battle = nullptr;
+    });
+
+    CombatStats stats;
+    for (std::size_t slotIdx = 0; slotIdx < numSlots; ++slotIdx)
+    {
+        stats += m_slots[slotIdx].stats;
+    }
+
+    return stats;
+}
+
+void CombatEstimator::SetBoard(Slot& slot, Player& player,
+                               const FieldZone& board, int tier)
+{
+    player.currentTier = tier;
+    player.recruitField = board;
+
+    // NOTE: The minions of board belong to other players, so bind them to
+    // the player of the slot and give them distinct indices.
+    int index = &player == &slot.player1 ? 0 : MAX_FIELD_SIZE;
+    player.recruitField.ForEach([&](MinionData& minion) {
+        minion.value().SetPlayer(player);
+        minion.value().SetIndex(index++);
+    });
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -18,7 +18,9 @@ void Hero::Initialize(const Card& heroCard)
 void Hero::TakeDamage(Player& player, int amount)
 {
     health -= amount;
-    if (health <= 0)
+
+    // NOTE: The ghost is the player who is already defeated.
+    if (health <= 0 && player.playState == PlayState::PLAYING)
     {
         player.ProcessDefeat();
     }
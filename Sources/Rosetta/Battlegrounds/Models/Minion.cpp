@@ -8,18 +8,22 @@
 #include <Rosetta/Battlegrounds/Models/Minion.hpp>
 #include <Rosetta/Battlegrounds/Models/Player.hpp>
 
-#include <utility>
 #include <vector>
 
 namespace RosettaStone::Battlegrounds
 {
-Minion::Minion(Card card, int poolIdx)
-    : m_card(std::move(card)),
+Minion::Minion(const Card& card, int poolIdx)
+    : m_card(&card),
       m_poolIdx(poolIdx),
-      m_attack(m_card.GetAttack()),
-      m_health(m_card.GetHealth())
+      m_attack(card.GetAttack()),
+      m_health(card.GetHealth())
 {
-    for (const auto& tag : m_card.gameTags)
+    if (const auto& trigger = card.power.GetTrigger(); trigger.has_value())
+    {
+        m_triggerType = trigger.value().GetTriggerType();
+    }
+
+    for (const auto& tag : card.gameTags)
     {
         switch (tag.first)
         {
@@ -53,9 +57,29 @@ int Minion::GetPoolIndex() const
     return m_poolIdx;
 }
 
+void Minion::SetPoolIndex(int poolIdx)
+{
+    m_poolIdx = poolIdx;
+}
+
+Player& Minion::GetPlayer() const
+{
+    return *m_player;
+}
+
+void Minion::SetPlayer(Player& player)
+{
+    m_player = &player;
+}
+
+const Card& Minion::GetCard() const
+{
+    return *m_card;
+}
+
 std::string_view Minion::GetName() const
 {
-    return m_card.name;
+    return m_card->name;
 }
 
 int Minion::GetGameTag(GameTag tag) const
@@ -83,7 +107,7 @@ void Minion::SetGameTag(GameTag tag, int value)
 
 Race Minion::GetRace() const
 {
-    return m_card.GetRace();
+    return m_card->GetRace();
 }
 
 ZoneType Minion::GetZoneType() const
@@ -118,7 +142,7 @@ void Minion::SetLastFieldPos(int pos)
 
 int Minion::GetTier() const
 {
-    return m_card.GetTier();
+    return m_card->GetTier();
 }
 
 int Minion::GetAttack() const
@@ -187,12 +211,12 @@ bool Minion::IsDestroyed() const
 
 bool Minion::IsPlayableByCardReq(Player& player) const
 {
-    if (!m_card.IsPlayableByCardReq(player))
+    if (!m_card->IsPlayableByCardReq(player))
     {
         return false;
     }
 
-    if (m_card.mustHaveToTargetToPlay && !HasAnyValidPlayTargets(player))
+    if (m_card->mustHaveToTargetToPlay && !HasAnyValidPlayTargets(player))
     {
         return false;
     }
@@ -204,7 +228,7 @@ bool Minion::HasAnyValidPlayTargets(Player& player) const
 {
     bool friendlyMinions = false;
     
-    switch (m_card.targetingType)
+    switch (m_card->targetingType)
     {
         case TargetingType::FRIENDLY_MINIONS:
             friendlyMinions = true;
@@ -217,7 +241,7 @@ bool Minion::HasAnyValidPlayTargets(Player& player) const
     {
         for (auto& minion : player.recruitField.GetAll())
         {
-            if (m_card.TargetingRequirements(minion))
+            if (m_card->TargetingRequirements(minion))
             {
                 return true;
             }
@@ -231,12 +255,12 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
 {
     if (targetIdx == -1)
     {
-        if (m_card.mustHaveToTargetToPlay)
+        if (m_card->mustHaveToTargetToPlay)
         {
             return false;
         }
 
-        if (m_card.targetingType == TargetingType::NONE)
+        if (m_card->targetingType == TargetingType::NONE)
         {
             return true;
         }
@@ -257,7 +281,7 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
             return false;
         }
 
-        if (m_card.TargetingRequirements(target))
+        if (m_card->TargetingRequirements(target))
         {
             return true;
         }
@@ -268,7 +292,7 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
 
 bool Minion::CheckTargetingType([[maybe_unused]] Minion& target)
 {
-    switch (m_card.targetingType)
+    switch (m_card->targetingType)
     {
         case TargetingType::NONE:
             return false;
@@ -281,20 +305,19 @@ bool Minion::CheckTargetingType([[maybe_unused]] Minion& target)
     return true;
 }
 
-void Minion::ActivateTrigger(TriggerType type, Minion& source)
+TriggerType Minion::GetTriggerType() const
 {
-    auto& trigger = m_card.power.GetTrigger();
-    if (!trigger.has_value())
-    {
-        return;
-    }
+    return m_triggerType;
+}
 
-    if (trigger.value().GetTriggerType() != type)
+void Minion::ActivateTrigger(TriggerType type, Minion& source)
+{
+    if (m_triggerType == TriggerType::NONE || m_triggerType != type)
     {
         return;
     }
 
-    trigger.value().Run(*this, source);
+    m_card->power.GetTrigger().value().Run(*this, source);
 }
 
 void Minion::ActivateTask(PowerType type, Player& player)
@@ -342,16 +365,16 @@ void Minion::ActivateTask(PowerType type, Player& player, Minion& target)
     }
 }
 
-std::vector<TaskType> Minion::GetTasks(PowerType type)
+std::vector<TaskType> Minion::GetTasks(PowerType type) const
 {
     switch (type)
     {
         case PowerType::POWER:
-            return m_card.power.GetBattlecryTask();
+            return m_card->power.GetBattlecryTask();
         case PowerType::DEATHRATTLE:
-            return m_card.power.GetDeathrattleTask();
+            return m_card->power.GetDeathrattleTask();
         case PowerType::START_OF_COMBAT:
-            return m_card.power.GetStartCombatTask();
+            return m_card->power.GetStartCombatTask();
         default:
             return std::vector<TaskType>{};
     }
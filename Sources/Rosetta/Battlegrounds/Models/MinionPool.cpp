@@ -10,17 +10,52 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+#include <algorithm>
+
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
+namespace
+{
+//! Returns the minions made from the cards of all tiers in order of tier.
+//! They are made once and shared by all pools, since a minion drawn from a
+//! pool differs from them only by the pool index.
+const std::vector<Minion>& GetPrototypes()
+{
+    static const std::vector<Minion> prototypes = [] {
+        std::vector<Minion> result;
+        const auto addMinions = [&](const auto& cards) {
+            for (const auto& card : cards)
+            {
+                result.emplace_back(card);
+            }
+        };
+
+        addMinions(Cards::GetTier1Minions());
+        addMinions(Cards::GetTier2Minions());
+        addMinions(Cards::GetTier3Minions());
+        addMinions(Cards::GetTier4Minions());
+        addMinions(Cards::GetTier5Minions());
+        addMinions(Cards::GetTier6Minions());
+
+        return result;
+    }();
+
+    return prototypes;
+}
+}  // namespace
+
 void MinionPool::Initialize(Race excludeRace)
 {
+    const std::vector<Minion>& prototypes = GetPrototypes();
+    std::size_t protoIdx = 0;
     std::size_t idx = 0;
 
     // Tier 1
     for (const auto& card : Cards::GetTier1Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -28,7 +63,8 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER1_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
@@ -36,6 +72,7 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 2
     for (const auto& card : Cards::GetTier2Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -43,7 +80,8 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER2_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
@@ -51,6 +89,7 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 3
     for (const auto& card : Cards::GetTier3Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -58,7 +97,8 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER3_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
@@ -66,6 +106,7 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 4
     for (const auto& card : Cards::GetTier4Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -73,7 +114,8 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER4_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
@@ -81,6 +123,7 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 5
     for (const auto& card : Cards::GetTier5Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -88,7 +131,8 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER5_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
@@ -96,6 +140,7 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 6
     for (const auto& card : Cards::GetTier6Minions())
     {
+        const Minion& prototype = prototypes[protoIdx++];
         if (card.GetRace() == excludeRace)
         {
             continue;
@@ -103,12 +148,39 @@ void MinionPool::Initialize(Race excludeRace)
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER6_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_prototypes.at(idx) = &prototype;
+            m_isInPool.at(idx) = true;
             ++idx;
         }
     }
 
     m_count = idx;
+
+    m_tierEnds.fill(0);
+    for (std::size_t i = 0; i < m_count; ++i)
+    {
+        ++m_tierEnds[m_prototypes[i]->GetTier()];
+    }
+    for (int tier = 1; tier <= TIER_UPPER_LIMIT; ++tier)
+    {
+        m_tierEnds[tier] += m_tierEnds[tier - 1];
+    }
+
+    // Builds the tree in O(n), all minions are in the pool.
+    m_tree.fill(0);
+    for (int i = 1; i <= NUM_TOTAL_TAVERN_MINIONS; ++i)
+    {
+        if (i <= static_cast<int>(m_count))
+        {
+            m_tree[i] += 1;
+        }
+
+        const int parent = i + (i & -i);
+        if (parent <= NUM_TOTAL_TAVERN_MINIONS)
+        {
+            m_tree[parent] += m_tree[i];
+        }
+    }
 }
 
 std::size_t MinionPool::GetCount() const
@@ -118,33 +190,51 @@ std::size_t MinionPool::GetCount() const
 
 void MinionPool::AddMinionsToTavern(Player& player, Tavern& tavern)
 {
-    const std::size_t numMinions = GetNumMinionsCanPurchase(player.currentTier);
-    auto minions = GetMinions(1, player.currentTier, true);
-
-    Random::shuffle(minions.begin(), minions.end());
+    const auto numMinions =
+        static_cast<int>(GetNumMinionsCanPurchase(player.currentTier));
 
-    std::size_t idx = 0;
-    for (auto& minion : minions)
+    for (int i = 0; i < numMinions; ++i)
     {
-        tavern.fieldZone.Add(minion);
-        std::get<2>(m_minions.at(minion.GetPoolIndex())) = false;
-        ++idx;
-
-        if (idx == numMinions)
+        const int numAvailable = GetNumAvailableMinions(player.currentTier);
+        if (numAvailable == 0)
         {
             break;
         }
+
+        const int idx = FindMinion(Random::get<int>(0, numAvailable - 1));
+        Minion minion = *m_prototypes[idx];
+        minion.SetPoolIndex(idx);
+
+        tavern.fieldZone.Add(minion);
+        m_isInPool[idx] = false;
+        UpdateTree(idx, -1);
+    }
+}
+
+int MinionPool::GetNumAvailableMinions(int maxTier) const
+{
+    if (maxTier < 1)
+    {
+        return 0;
     }
+
+    return GetPrefixCount(m_tierEnds[std::min(maxTier, TIER_UPPER_LIMIT)]);
 }
 
 void MinionPool::ReturnMinion(int idx)
 {
-    if (idx < 0 || idx >= NUM_TOTAL_TAVERN_MINIONS)
+    if (idx < 0 || idx >= static_cast<int>(m_count))
+    {
+        return;
+    }
+
+    if (m_isInPool[idx])
     {
         return;
     }
 
-    std::get<2>(m_minions.at(idx)) = true;
+    m_isInPool[idx] = true;
+    UpdateTree(idx, 1);
 }
 
 std::vector<Minion> MinionPool::GetMinions(int minTier, int maxTier,
@@ -152,21 +242,65 @@ std::vector<Minion> MinionPool::GetMinions(int minTier, int maxTier,
 {
     std::vector<Minion> result;
 
-    for (auto& minion : m_minions)
+    for (std::size_t idx = 0; idx < m_count; ++idx)
     {
-        const int tier = std::get<0>(minion).GetTier();
+        const int tier = m_prototypes[idx]->GetTier();
 
         if (tier >= minTier && tier <= maxTier)
         {
-            if (isInPoolOnly && std::get<2>(minion) == false)
+            if (isInPoolOnly && !m_isInPool[idx])
             {
                 continue;
             }
 
-            result.emplace_back(std::get<0>(minion));
+            result.emplace_back(*m_prototypes[idx]);
+            result.back().SetPoolIndex(static_cast<int>(idx));
         }
     }
 
     return result;
 }
+
+void MinionPool::UpdateTree(int idx, int delta)
+{
+    for (int i = idx + 1; i <= NUM_TOTAL_TAVERN_MINIONS; i += i & -i)
+    {
+        m_tree[i] += delta;
+    }
+}
+
+int MinionPool::GetPrefixCount(int end) const
+{
+    int count = 0;
+
+    for (int i = end; i > 0; i -= i & -i)
+    {
+        count += m_tree[i];
+    }
+
+    return count;
+}
+
+int MinionPool::FindMinion(int n) const
+{
+    int pos = 0;
+
+    // Descends the tree from the highest power of two.
+    int step = 1;
+    while (step * 2 <= NUM_TOTAL_TAVERN_MINIONS)
+    {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2)
+    {
+        if (pos + step <= NUM_TOTAL_TAVERN_MINIONS && m_tree[pos + step] <= n)
+        {
+            pos += step;
+            n -= m_tree[pos];
+        }
+    }
+
+    return pos;
+}
 }  // namespace RosettaStone::Battlegrounds
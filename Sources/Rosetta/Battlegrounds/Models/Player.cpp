@@ -5,8 +5,13 @@
 // property of any third parties.
 
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Environments/LegalActions.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
 #include <Rosetta/Battlegrounds/Models/Player.hpp>
 
+#include <stdexcept>
+
 namespace RosettaStone::Battlegrounds
 {
 FieldZone& Player::GetField()
@@ -18,13 +23,14 @@ void Player::SelectHero(std::size_t idx)
 {
     const auto heroCard = Cards::FindCardByDbfID(heroChoices.at(idx));
     hero.Initialize(heroCard);
+    hero.health = hero.card.GetHealth();
 
-    selectHeroCallback(*this);
+    game->CompleteSelectHero();
 }
 
 void Player::PrepareTavern()
 {
-    prepareTavernMinionsCallback(*this);
+    game->GetGameState().minionPool.AddMinionsToTavern(*this, tavern);
 }
 
 void Player::PurchaseMinion(std::size_t idx)
@@ -34,7 +40,8 @@ void Player::PurchaseMinion(std::size_t idx)
         return;
     }
 
-    purchaseMinionCallback(*this, idx);
+    Minion minion = tavern.fieldZone.Remove(tavern.fieldZone[idx]);
+    hand.Add(minion, -1);
 
     remainCoin -= NUM_COIN_PURCHASE_MINION;
 }
@@ -60,10 +67,10 @@ void Player::PlayCard(std::size_t handIdx, std::size_t fieldIdx, int targetIdx)
         CardData card = hand.Remove(hand[handIdx]);
 
         auto minion = std::get<Minion>(card);
-        minion.getPlayerCallback = [&]() -> Player& { return *this; };
-        minion.SetIndex(getNextCardIndexCallback());
+        minion.SetPlayer(*this);
+        minion.SetIndex(GetNextCardIndex());
 
-        Player& opponent = getOpponentPlayerCallback(*this);
+        Player& opponent = GetOpponentPlayer();
 
         if (targetIdx == -1)
         {
@@ -114,7 +121,7 @@ void Player::PlayCard(std::size_t handIdx, std::size_t fieldIdx, int targetIdx)
 void Player::SellMinion(std::size_t idx)
 {
     const auto minion = recruitField.Remove(recruitField[idx]);
-    returnMinionCallback(minion.GetPoolIndex());
+    game->GetGameState().minionPool.ReturnMinion(minion.GetPoolIndex());
 
     remainCoin += 1;
 }
@@ -127,7 +134,29 @@ void Player::UpgradeTavern()
     }
 
     remainCoin -= coinToUpgradeTavern;
-    upgradeTavernCallback(*this);
+    ++currentTier;
+
+    // Set the value of coin to upgrade player's Tavern to the next tier
+    switch (currentTier)
+    {
+        case 2:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_3;
+            break;
+        case 3:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_4;
+            break;
+        case 4:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_5;
+            break;
+        case 5:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_6;
+            break;
+        case TIER_UPPER_LIMIT:
+            // NOTE: Tavern can't be upgraded anymore.
+            break;
+        default:
+            throw std::logic_error("Invalid player's current tier");
+    }
 }
 
 void Player::RefreshTavern()
@@ -137,10 +166,18 @@ void Player::RefreshTavern()
         return;
     }
 
-    clearTavernMinionsCallback(*this);
+    MinionPool& minionPool = game->GetGameState().minionPool;
+
+    // Clear a list of minions in Tavern
+    while (!tavern.fieldZone.IsEmpty())
+    {
+        Minion minion = tavern.fieldZone.Remove(tavern.fieldZone[0]);
+        minionPool.ReturnMinion(minion.GetPoolIndex());
+    }
+
     remainCoin -= NUM_COIN_REFRESH_TAVERN;
 
-    prepareTavernMinionsCallback(*this);
+    minionPool.AddMinionsToTavern(*this, tavern);
 }
 
 void Player::FreezeTavern()
@@ -162,11 +199,101 @@ void Player::RearrangeMinion(std::size_t curIdx, std::size_t newIdx)
 
 void Player::CompleteRecruit() const
 {
-    completeRecruitCallback();
+    game->CompleteRecruit();
+}
+
+std::size_t Player::GetLegalActions(LegalActions& actions)
+{
+    actions.Clear();
+
+    const auto numTavern =
+        static_cast<std::uint8_t>(tavern.fieldZone.GetCount());
+    const auto numHand = static_cast<std::uint8_t>(hand.GetCount());
+    const auto numField = static_cast<std::uint8_t>(recruitField.GetCount());
+
+    // Purchase minions in Tavern
+    if (remainCoin >= NUM_COIN_PURCHASE_MINION && !hand.IsFull())
+    {
+        for (std::uint8_t pos = 0; pos < numTavern; ++pos)
+        {
+            actions.Add({ ActionType::PURCHASE, pos, 0, 0 });
+        }
+    }
+
+    // Play minions in hand
+    // NOTE: Spells can't be cast in recruit phase yet.
+    for (std::uint8_t handPos = 0; handPos < numHand && !recruitField.IsFull();
+         ++handPos)
+    {
+        if (!std::holds_alternative<Minion>(hand[handPos]))
+        {
+            continue;
+        }
+
+        auto& minion = std::get<Minion>(hand[handPos]);
+        if (!minion.IsPlayableByCardReq(*this))
+        {
+            continue;
+        }
+
+        for (std::uint8_t target = 0; target <= numField; ++target)
+        {
+            // NOTE: The legality doesn't depend on the field position.
+            if (!minion.IsValidPlayTarget(*this, target - 1))
+            {
+                continue;
+            }
+
+            for (std::uint8_t fieldPos = 0; fieldPos <= numField; ++fieldPos)
+            {
+                actions.Add(
+                    { ActionType::PLAY_CARD, handPos, fieldPos, target });
+            }
+        }
+    }
+
+    // Sell and rearrange minions on the field
+    for (std::uint8_t curPos = 0; curPos < numField; ++curPos)
+    {
+        actions.Add({ ActionType::SELL, curPos, 0, 0 });
+
+        for (std::uint8_t newPos = 0; newPos < numField; ++newPos)
+        {
+            if (curPos != newPos)
+            {
+                actions.Add({ ActionType::REARRANGE, curPos, newPos, 0 });
+            }
+        }
+    }
+
+    if (remainCoin >= NUM_COIN_REFRESH_TAVERN)
+    {
+        actions.Add({ ActionType::REFRESH, 0, 0, 0 });
+    }
+    if (currentTier < TIER_UPPER_LIMIT && remainCoin >= coinToUpgradeTavern)
+    {
+        actions.Add({ ActionType::UPGRADE, 0, 0, 0 });
+    }
+    actions.Add({ ActionType::FREEZE, 0, 0, 0 });
+    actions.Add({ ActionType::END_RECRUIT, 0, 0, 0 });
+
+    return actions.GetCount();
 }
 
 void Player::ProcessDefeat()
 {
-    processDefeatCallback(*this);
+    game->ProcessDefeat(*this);
+}
+
+Player& Player::GetOpponentPlayer()
+{
+    return battle != nullptr ? battle->GetOpponentPlayer(*this)
+                             : game->GetOpponentPlayer(*this);
+}
+
+int Player::GetNextCardIndex()
+{
+    return battle != nullptr ? battle->GetNextCardIndex()
+                             : game->GetNextCardIndex();
 }
 }  // namespace RosettaStone::Battlegrounds
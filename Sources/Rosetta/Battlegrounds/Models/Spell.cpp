@@ -15,6 +15,11 @@ Spell::Spell(Card card) : m_card(std::move(card))
     // Do nothing
 }
 
+const Card& Spell::GetCard() const
+{
+    return m_card;
+}
+
 ZoneType Spell::GetZoneType() const
 {
     return m_zoneType;
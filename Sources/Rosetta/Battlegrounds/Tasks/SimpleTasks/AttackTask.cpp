@@ -19,11 +19,17 @@ AttackTask::AttackTask(EntityType attacker) : m_attacker(attacker)
 
 TaskStatus AttackTask::Run(Player& player, Minion& source)
 {
-    Battle& battle = player.getBattleCallback();
+    Battle& battle = *player.battle;
 
     auto attackers = IncludeTask::GetMinions(m_attacker, player, source);
     for (auto& attacker : attackers)
     {
+        // NOTE: There is no target if a field is empty.
+        if (battle.IsDone())
+        {
+            break;
+        }
+
         Minion& battleTarget = battle.GetProperTarget(attacker);
         battleTarget.TakeDamage(attacker);
         attacker.get().TakeDamage(battleTarget);
@@ -36,12 +42,18 @@ TaskStatus AttackTask::Run(Player& player, Minion& source)
 
 TaskStatus AttackTask::Run(Player& player, Minion& source, Minion& target)
 {
-    Battle& battle = player.getBattleCallback();
+    Battle& battle = *player.battle;
 
     auto attackers =
         IncludeTask::GetMinions(m_attacker, player, source, target);
     for (auto& attacker : attackers)
     {
+        // NOTE: There is no target if a field is empty.
+        if (battle.IsDone())
+        {
+            break;
+        }
+
         Minion& battleTarget = battle.GetProperTarget(attacker);
         battleTarget.TakeDamage(attacker);
         attacker.get().TakeDamage(battleTarget);
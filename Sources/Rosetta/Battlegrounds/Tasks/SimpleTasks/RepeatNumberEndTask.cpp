@@ -20,6 +20,7 @@ TaskStatus RepeatNumberEndTask::Run(Player& player, Minion& source)
         }
     }
 
+    player.taskStack.tasks.clear();
     player.taskStack.isStackingTasks = false;
 
     return TaskStatus::COMPLETE;
@@ -37,6 +38,7 @@ TaskStatus RepeatNumberEndTask::Run(Player& player, Minion& source,
         }
     }
 
+    player.taskStack.tasks.clear();
     player.taskStack.isStackingTasks = false;
 
     return TaskStatus::COMPLETE;
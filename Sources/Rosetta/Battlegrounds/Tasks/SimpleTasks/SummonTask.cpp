@@ -69,7 +69,7 @@ int SummonTask::GetPosition(Minion& source, SummonSide side)
 
 TaskStatus SummonTask::Run(Player& player, Minion& source)
 {
-    const Card card = Cards::FindCardByID(m_cardID);
+    const Card& card = Cards::FindCardByID(m_cardID);
 
     for (int i = 0; i < m_amount; ++i)
     {
@@ -80,6 +80,8 @@ TaskStatus SummonTask::Run(Player& player, Minion& source)
     }
 
     Minion summonMinion{ card };
+    summonMinion.SetPlayer(player);
+    summonMinion.SetIndex(player.GetNextCardIndex());
 
     int summonPos = GetPosition(source, m_side);
     if (summonPos > player.GetField().GetCount())
@@ -89,8 +91,10 @@ TaskStatus SummonTask::Run(Player& player, Minion& source)
 
     player.GetField().Add(summonMinion, summonPos);
 
+    // NOTE: Tasks after this one refer to the summoned minion only.
     if (m_addToStack)
     {
+        player.taskStack.minions.clear();
         player.taskStack.minions.emplace_back(player.GetField()[summonPos]);
     }
 
@@ -100,7 +104,7 @@ TaskStatus SummonTask::Run(Player& player, Minion& source)
 TaskStatus SummonTask::Run(Player& player, Minion& source,
                            [[maybe_unused]] Minion& target)
 {
-    const Card card = Cards::FindCardByID(m_cardID);
+    const Card& card = Cards::FindCardByID(m_cardID);
 
     for (int i = 0; i < m_amount; ++i)
     {
@@ -111,6 +115,8 @@ TaskStatus SummonTask::Run(Player& player, Minion& source,
     }
 
     Minion summonMinion{ card };
+    summonMinion.SetPlayer(player);
+    summonMinion.SetIndex(player.GetNextCardIndex());
 
     int summonPos = GetPosition(source, m_side);
     if (summonPos > player.GetField().GetCount())
@@ -120,8 +126,10 @@ TaskStatus SummonTask::Run(Player& player, Minion& source,
 
     player.GetField().Add(summonMinion, summonPos);
 
+    // NOTE: Tasks after this one refer to the summoned minion only.
     if (m_addToStack)
     {
+        player.taskStack.minions.clear();
         player.taskStack.minions.emplace_back(player.GetField()[summonPos]);
     }
 
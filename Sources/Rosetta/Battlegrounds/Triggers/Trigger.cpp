@@ -39,10 +39,10 @@ void Trigger::SetCondition(SelfCondition&& condition)
     m_condition = condition;
 }
 
-void Trigger::Validate(Minion& owner, Minion& source)
+bool Trigger::Validate(Minion& owner, Minion& source) const
 {
-    Player& ownerPlayer = owner.getPlayerCallback();
-    Player& sourcePlayer = source.getPlayerCallback();
+    Player& ownerPlayer = owner.GetPlayer();
+    Player& sourcePlayer = source.GetPlayer();
 
     switch (m_triggerSource)
     {
@@ -52,13 +52,13 @@ void Trigger::Validate(Minion& owner, Minion& source)
             if (ownerPlayer.idx != sourcePlayer.idx ||
                 owner.GetIndex() == source.GetIndex())
             {
-                return;
+                return false;
             }
             break;
         case TriggerSource::FRIENDLY:
             if (ownerPlayer.idx != sourcePlayer.idx)
             {
-                return;
+                return false;
             }
             break;
         default:
@@ -70,7 +70,7 @@ void Trigger::Validate(Minion& owner, Minion& source)
         case TriggerType::SUMMON:
             if (owner.GetIndex() == source.GetIndex())
             {
-                return;
+                return false;
             }
             break;
         default:
@@ -81,29 +81,27 @@ void Trigger::Validate(Minion& owner, Minion& source)
     {
         if (!m_condition.value().Evaluate(source))
         {
-            return;
+            return false;
         }
     }
 
-    m_isValidated = true;
+    return true;
 }
 
-void Trigger::Run(Minion& owner, Minion& source)
+void Trigger::Run(Minion& owner, Minion& source) const
 {
-    Validate(owner, source);
-
-    if (!m_isValidated)
+    if (!Validate(owner, source))
     {
         return;
     }
 
-    for (auto& task : m_tasks)
+    // NOTE: The trigger is shared by all minions of the card, so run a copy
+    // of each task.
+    for (auto task : m_tasks)
     {
         std::visit(
-            [&](auto&& _task) { _task.Run(owner.getPlayerCallback(), owner); },
+            [&](auto&& _task) { _task.Run(owner.GetPlayer(), owner); },
             task);
     }
-
-    m_isValidated = false;
 }
 }  // namespace RosettaStone::Battlegrounds
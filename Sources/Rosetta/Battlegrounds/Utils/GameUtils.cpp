@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
 #include <Rosetta/Battlegrounds/Utils/GameUtils.hpp>
 
 #include <stdexcept>
@@ -31,4 +32,35 @@ std::size_t GetNumMinionsCanPurchase(int tier)
 
     throw std::invalid_argument("GetNumMinionsCanPurchase() - Incorrect tier");
 }
+
+void PlaySimpleRounds(Game& game, int numRounds)
+{
+    for (int round = 0; round < numRounds; ++round)
+    {
+        if (game.GetGameState().phase != Phase::RECRUIT)
+        {
+            break;
+        }
+
+        for (auto& player : game.GetGameState().players)
+        {
+            if (player.playState != PlayState::PLAYING)
+            {
+                continue;
+            }
+
+            if (player.remainCoin >= NUM_COIN_PURCHASE_MINION &&
+                !player.tavern.fieldZone.IsEmpty())
+            {
+                player.PurchaseMinion(0);
+            }
+            if (player.hand.GetCount() > 0 && !player.recruitField.IsFull())
+            {
+                player.PlayCard(0, 0);
+            }
+
+            player.CompleteRecruit();
+        }
+    }
+}
 }  // namespace RosettaStone::Battlegrounds
@@ -10,6 +10,19 @@
 
 namespace RosettaStone::Battlegrounds
 {
+HandZone& HandZone::operator=(const HandZone& rhs)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    m_cards = rhs.m_cards;
+    m_count = rhs.m_count;
+
+    return *this;
+}
+
 CardData& HandZone::operator[](int zonePos)
 {
     return m_cards.at(zonePos).value();
@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace RosettaStone
+{
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // NOTE: The calling thread runs jobs too, so create one less worker.
+    m_threads.reserve(numThreads - 1);
+    for (std::size_t i = 1; i < numThreads; ++i)
+    {
+        m_threads.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+    }
+
+    m_startCond.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+std::size_t ThreadPool::GetNumThreads() const
+{
+    return m_threads.size() + 1;
+}
+
+void ThreadPool::ParallelFor(std::size_t count,
+                             const std::function<void(std::size_t)>& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> callLock(m_callMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_func = &func;
+        m_count = count;
+        m_nextIdx = 0;
+        m_numBusyThreads = m_threads.size();
+        m_exception = nullptr;
+        ++m_generation;
+    }
+
+    m_startCond.notify_all();
+
+    RunJobs();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finishCond.wait(lock, [this] { return m_numBusyThreads == 0; });
+    m_func = nullptr;
+
+    if (m_exception)
+    {
+        std::rethrow_exception(std::exchange(m_exception, nullptr));
+    }
+}
+
+void ThreadPool::WorkerLoop()
+{
+    std::size_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCond.wait(lock, [&] {
+                return m_isStopped || m_generation != generation;
+            });
+
+            if (m_isStopped)
+            {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_numBusyThreads;
+        }
+
+        m_finishCond.notify_one();
+    }
+}
+
+void ThreadPool::RunJobs()
+{
+    while (true)
+    {
+        const std::size_t idx = m_nextIdx.fetch_add(1);
+        if (idx >= m_count)
+        {
+            break;
+        }
+
+        try
+        {
+            (*m_func)(idx);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+
+            // Skip the remaining jobs
+            m_nextIdx = m_count;
+        }
+    }
+}
+}  // namespace RosettaStone
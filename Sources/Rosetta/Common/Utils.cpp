@@ -80,3 +80,28 @@ std::vector<unsigned char> DecodeBase64(std::string_view src)
 
     return ret;
 }
+
+std::string EncodeBase64(const std::vector<unsigned char>& src)
+{
+    static constexpr char encodeTable[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string ret;
+    ret.reserve((src.size() + 2) / 3 * 4);
+
+    for (std::size_t i = 0; i < src.size(); i += 3)
+    {
+        const std::size_t rest = src.size() - i;
+        const unsigned int bits =
+            (static_cast<unsigned int>(src[i]) << 16) |
+            (rest > 1 ? static_cast<unsigned int>(src[i + 1]) << 8 : 0) |
+            (rest > 2 ? static_cast<unsigned int>(src[i + 2]) : 0);
+
+        ret += encodeTable[(bits >> 18) & 0x3f];
+        ret += encodeTable[(bits >> 12) & 0x3f];
+        ret += rest > 1 ? encodeTable[(bits >> 6) & 0x3f] : '=';
+        ret += rest > 2 ? encodeTable[bits & 0x3f] : '=';
+    }
+
+    return ret;
+}
@@ -145,28 +145,26 @@ bool DeckInfo::DeleteCard(std::string cardID, std::size_t numCardToDelete)
             return elem.first == cardID;
         });
 
-    // A card is in deck
-    if (cardIter != m_cards.end())
+    // A card is not in deck or there are not enough cards to delete
+    if (cardIter == m_cards.end() || (*cardIter).second < numCardToDelete)
     {
-        // Remove a given number of cards from deck
-        (*cardIter).second = std::min((*cardIter).second - numCardToDelete,
-                                      static_cast<std::size_t>(0u));
-        m_numOfCards = std::min(m_numOfCards - numCardToDelete,
-                                static_cast<std::size_t>(0u));
-
-        // If the number of cards is less than 0, remove card from deck
-        if ((*cardIter).second <= 0)
-        {
-            m_cards.erase(cardIter);
-        }
+        return false;
+    }
+
+    // Remove a given number of cards from deck
+    (*cardIter).second -= numCardToDelete;
+    m_numOfCards -= numCardToDelete;
 
-        return true;
+    // If there are no cards left, remove card from deck
+    if ((*cardIter).second == 0)
+    {
+        m_cards.erase(cardIter);
     }
 
-    return false;
+    return true;
 }
 
-std::vector<std::string> DeckInfo::GetCardIDs()
+std::vector<std::string> DeckInfo::GetCardIDs() const
 {
     std::vector<std::string> ret;
     ret.reserve(m_numOfCards);
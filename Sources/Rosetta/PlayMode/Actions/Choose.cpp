@@ -19,7 +19,7 @@
 
 #include <algorithm>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::Generic
 {
@@ -0,0 +1,210 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Managers/GameManager.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/ChooseTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <effolkronium/random.hpp>
+
+using Random = effolkronium::random_thread_local;
+using namespace RosettaStone::PlayMode::PlayerTasks;
+
+namespace RosettaStone::PlayMode
+{
+std::vector<std::unique_ptr<ITask>> RandomAgent::GetValidTasks(Player* player)
+{
+    std::vector<std::unique_ptr<ITask>> tasks;
+
+    // Process pending choice first
+    if (player->choice != nullptr)
+    {
+        if (player->choice->choiceType == ChoiceType::GENERAL)
+        {
+            for (const int choice : player->choice->choices)
+            {
+                tasks.emplace_back(std::make_unique<ChooseTask>(
+                    ChooseTask::Pick(player, choice)));
+            }
+
+            return tasks;
+        }
+
+        if (player->choice->choiceType == ChoiceType::MULLIGAN)
+        {
+            tasks.emplace_back(std::make_unique<ChooseTask>(
+                ChooseTask::Mulligan(player, player->choice->choices)));
+
+            return tasks;
+        }
+    }
+
+    // Play cards in hand
+    for (auto& playable : player->GetHandZone()->GetAll())
+    {
+        if (dynamic_cast<Minion*>(playable) != nullptr &&
+            player->GetFieldZone()->IsFull())
+        {
+            continue;
+        }
+
+        if (!playable->IsPlayableByPlayer() || !playable->IsPlayableByCardReq())
+        {
+            continue;
+        }
+
+        std::vector<int> chooseOnes{ 0 };
+        if (playable->HasChooseOne() && !player->ChooseBoth())
+        {
+            chooseOnes = { 1, 2 };
+        }
+
+        auto targets = playable->GetValidPlayTargets();
+        const bool canPlayWithoutTarget = playable->IsValidPlayTarget(nullptr);
+
+        for (const int chooseOne : chooseOnes)
+        {
+            if (canPlayWithoutTarget)
+            {
+                tasks.emplace_back(std::make_unique<PlayCardTask>(
+                    playable, nullptr, -1, chooseOne));
+            }
+
+            for (auto& target : targets)
+            {
+                if (playable->IsValidPlayTarget(target))
+                {
+                    tasks.emplace_back(std::make_unique<PlayCardTask>(
+                        playable, target, -1, chooseOne));
+                }
+            }
+        }
+    }
+
+    // Use hero power
+    HeroPower& power = player->GetHeroPower();
+    if (power.IsPlayableByPlayer() && power.IsPlayableByCardReq() &&
+        !power.IsExhausted())
+    {
+        if (power.IsValidPlayTarget(nullptr))
+        {
+            tasks.emplace_back(std::make_unique<HeroPowerTask>());
+        }
+
+        for (auto& target : power.GetValidPlayTargets())
+        {
+            if (power.IsValidPlayTarget(target))
+            {
+                tasks.emplace_back(std::make_unique<HeroPowerTask>(target));
+            }
+        }
+    }
+
+    // Attack with hero and minions
+    std::vector<Character*> attackers{ player->GetHero() };
+    for (auto& minion : player->GetFieldZone()->GetAll())
+    {
+        attackers.emplace_back(minion);
+    }
+
+    for (auto& attacker : attackers)
+    {
+        if (!attacker->CanAttack())
+        {
+            continue;
+        }
+
+        for (auto& target : attacker->GetValidAttackTargets(player->opponent))
+        {
+            tasks.emplace_back(std::make_unique<AttackTask>(attacker, target));
+        }
+    }
+
+    // End turn
+    tasks.emplace_back(std::make_unique<EndTurnTask>());
+
+    return tasks;
+}
+
+std::unique_ptr<ITask> RandomAgent::GetRandomTask(Player* player)
+{
+    auto tasks = GetValidTasks(player);
+    const auto idx = Random::get<std::size_t>(0, tasks.size() - 1);
+
+    return std::move(tasks[idx]);
+}
+
+void RandomAgent::ProcessMulligan(Game& game)
+{
+    if (game.step != Step::BEGIN_MULLIGAN)
+    {
+        return;
+    }
+
+    for (Player* player : { game.GetPlayer1(), game.GetPlayer2() })
+    {
+        if (player->choice != nullptr &&
+            player->choice->choiceType == ChoiceType::MULLIGAN)
+        {
+            game.Process(player, ChooseTask::Mulligan(
+                                     player, player->choice->choices));
+        }
+    }
+
+    game.nextStep = Step::MAIN_BEGIN;
+    GameManager::ProcessNextStep(game, game.nextStep);
+}
+
+void RandomAgent::PlayTurn(Game& game)
+{
+    const int turn = game.GetTurn();
+    int numTasks = 0;
+
+    while (game.state != State::COMPLETE && game.GetTurn() == turn)
+    {
+        Player* player = game.GetCurrentPlayer();
+
+        // NOTE: Some tasks fail silently and don't change the state of the
+        // game, so end the turn when the agent processes too many tasks.
+        std::unique_ptr<ITask> task =
+            numTasks >= MAX_AGENT_TASKS_PER_TURN && player->choice == nullptr
+                ? std::make_unique<EndTurnTask>()
+                : GetRandomTask(player);
+        game.Process(player, std::move(task));
+
+        ++numTasks;
+    }
+}
+
+PlayState RandomAgent::PlayGame(Game& game)
+{
+    if (game.step == Step::INVALID)
+    {
+        game.Start();
+    }
+
+    ProcessMulligan(game);
+
+    while (game.state != State::COMPLETE)
+    {
+        if (game.GetTurn() > MAX_GAME_TURN)
+        {
+            return PlayState::TIED;
+        }
+
+        PlayTurn(game);
+    }
+
+    return game.GetPlayer1()->playState;
+}
+}  // namespace RosettaStone::PlayMode
@@ -35,13 +35,15 @@ AuraType Aura::GetType() const
 
 void Aura::Activate(Playable* owner, bool cloning)
 {
-    if (m_effects.empty())
+    auto instance = new Aura(*this, *owner);
+
+    // NOTE: The prototype is shared by all games, so the effects of
+    // enchantment card are copied to the instance instead of the prototype.
+    if (instance->m_effects.empty())
     {
-        m_effects = m_enchantmentCard->power.GetEnchant()->effects;
+        instance->m_effects = m_enchantmentCard->power.GetEnchant()->effects;
     }
 
-    auto instance = new Aura(*this, *owner);
-
     AddToGame(*owner, *instance);
 
     switch (removeTrigger.first)
@@ -43,7 +43,7 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 using namespace RosettaStone::PlayMode::SimpleTasks;
 
@@ -0,0 +1,159 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+constexpr char FEATURES_MAGIC[8] = { 'R', 'S', 'C', 'F', 'E', 'A', 'T', '1' };
+constexpr std::size_t INVALID_INDEX = std::numeric_limits<std::size_t>::max();
+
+int GetTag(const Card& card, GameTag tag)
+{
+    const auto iter = card.gameTags.find(tag);
+    return iter != card.gameTags.end() ? iter->second : 0;
+}
+}  // namespace
+
+CardFeatures::CardFeatures(const std::vector<Card*>& cards) : m_cards(cards)
+{
+    std::stable_sort(m_cards.begin(), m_cards.end(),
+                     [](const Card* lhs, const Card* rhs) {
+                         return lhs->dbfID < rhs->dbfID;
+                     });
+
+    m_data.resize(m_cards.size() * NUM_FEATURES);
+    if (!m_cards.empty())
+    {
+        const int maxDbfID = std::max(m_cards.back()->dbfID, 0);
+        m_dbfIDToIndex.resize(static_cast<std::size_t>(maxDbfID) + 1,
+                              INVALID_INDEX);
+    }
+    m_idToIndex.reserve(m_cards.size());
+
+    for (std::size_t i = 0; i < m_cards.size(); ++i)
+    {
+        const Card& card = *m_cards[i];
+        std::int32_t* row = &m_data[i * NUM_FEATURES];
+
+        std::int32_t keywordBits = 0;
+        for (std::size_t k = 0; k < KEYWORDS.size(); ++k)
+        {
+            if (GetTag(card, KEYWORDS[k]) != 0)
+            {
+                keywordBits |= 1 << k;
+            }
+        }
+
+        const GameTag healthTag = GetTag(card, GameTag::CARDTYPE) ==
+                                          static_cast<int>(CardType::WEAPON)
+                                      ? GameTag::DURABILITY
+                                      : GameTag::HEALTH;
+
+        row[DBF_ID] = card.dbfID;
+        row[COST] = GetTag(card, GameTag::COST);
+        row[ATTACK] = GetTag(card, GameTag::ATK);
+        row[HEALTH] = GetTag(card, healthTag);
+        row[CARD_TYPE] = GetTag(card, GameTag::CARDTYPE);
+        row[CARD_CLASS] = GetTag(card, GameTag::CLASS);
+        row[RACE] = GetTag(card, GameTag::CARDRACE);
+        row[RARITY] = GetTag(card, GameTag::RARITY);
+        row[CARD_SET] = GetTag(card, GameTag::CARD_SET);
+        row[KEYWORD_BITS] = keywordBits;
+
+        if (card.dbfID >= 0 && m_dbfIDToIndex[card.dbfID] == INVALID_INDEX)
+        {
+            m_dbfIDToIndex[card.dbfID] = i;
+        }
+        m_idToIndex.emplace(card.id, i);
+    }
+}
+
+const CardFeatures& CardFeatures::GetInstance()
+{
+    static CardFeatures instance(Cards::GetAllCards());
+    return instance;
+}
+
+std::size_t CardFeatures::GetNumCards() const
+{
+    return m_cards.size();
+}
+
+const std::int32_t* CardFeatures::GetData() const
+{
+    return m_data.data();
+}
+
+Card* CardFeatures::GetCard(std::size_t index) const
+{
+    if (index >= m_cards.size())
+    {
+        throw std::invalid_argument(
+            "CardFeatures::GetCard() - Invalid index " +
+            std::to_string(index));
+    }
+
+    return m_cards[index];
+}
+
+std::size_t CardFeatures::GetIndexByDbfID(int dbfID) const
+{
+    if (dbfID < 0 ||
+        static_cast<std::size_t>(dbfID) >= m_dbfIDToIndex.size() ||
+        m_dbfIDToIndex[dbfID] == INVALID_INDEX)
+    {
+        throw std::invalid_argument(
+            "CardFeatures::GetIndexByDbfID() - Invalid dbfID " +
+            std::to_string(dbfID));
+    }
+
+    return m_dbfIDToIndex[dbfID];
+}
+
+std::size_t CardFeatures::GetIndexByID(const std::string& id) const
+{
+    const auto iter = m_idToIndex.find(id);
+    if (iter == m_idToIndex.end())
+    {
+        throw std::invalid_argument(
+            "CardFeatures::GetIndexByID() - Invalid ID " + id);
+    }
+
+    return iter->second;
+}
+
+void CardFeatures::Save(const std::string& path) const
+{
+    std::ofstream fileOutput(path, std::ios::binary | std::ios::trunc);
+
+    const auto numCards = static_cast<std::uint32_t>(m_cards.size());
+    const auto numFeatures = static_cast<std::uint32_t>(NUM_FEATURES);
+
+    fileOutput.write(FEATURES_MAGIC, sizeof(FEATURES_MAGIC));
+    fileOutput.write(reinterpret_cast<const char*>(&numCards),
+                     sizeof(numCards));
+    fileOutput.write(reinterpret_cast<const char*>(&numFeatures),
+                     sizeof(numFeatures));
+    fileOutput.write(reinterpret_cast<const char*>(m_data.data()),
+                     static_cast<std::streamsize>(m_data.size() *
+                                                  sizeof(std::int32_t)));
+
+    if (!fileOutput)
+    {
+        throw std::runtime_error("CardFeatures::Save() - Can't write " +
+                                 path);
+    }
+}
+}  // namespace RosettaStone::PlayMode
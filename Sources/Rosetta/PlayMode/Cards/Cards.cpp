@@ -20,6 +20,7 @@ std::array<std::vector<Card*>, NUM_PLAYER_CLASS> Cards::m_wildCards;
 std::vector<Card*> Cards::m_allStandardCards;
 std::vector<Card*> Cards::m_allWildCards;
 std::vector<Card*> Cards::m_lackeys;
+std::unordered_map<int, Card*> Cards::m_dbfIDToCard;
 
 Cards::Cards()
 {
@@ -28,9 +29,13 @@ Cards::Cards()
     CardLoader::Load(m_cards);
     InternalCardLoader::Load(m_cards);
 
+    m_dbfIDToCard.reserve(m_cards.size());
     for (Card* card : m_cards)
     {
         card->Initialize();
+
+        // NOTE: The first card wins if cards share a dbfID.
+        m_dbfIDToCard.emplace(card->dbfID, card);
     }
 
     for (Card* card : m_cards)
@@ -76,6 +81,7 @@ Cards::~Cards()
     }
 
     m_cards.clear();
+    m_dbfIDToCard.clear();
 }
 
 Cards& Cards::GetInstance()
@@ -166,15 +172,8 @@ Card* Cards::FindCardByID(const std::string_view& id)
 
 Card* Cards::FindCardByDbfID(int dbfID)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->dbfID == dbfID)
-        {
-            return card;
-        }
-    }
-
-    return &emptyCard;
+    const auto iter = m_dbfIDToCard.find(dbfID);
+    return iter != m_dbfIDToCard.end() ? iter->second : &emptyCard;
 }
 
 std::vector<Card*> Cards::FindCardByRarity(Rarity rarity)
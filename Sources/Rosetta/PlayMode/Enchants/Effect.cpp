@@ -110,6 +110,8 @@ void Effect::ApplyAuraTo(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::ApplyAuraTo() - Invalid effect operator!");
     }
+
+    entity->IncreaseNumChanges();
 }
 
 void Effect::RemoveFrom(Entity* entity) const
@@ -190,6 +192,8 @@ void Effect::RemoveAuraFrom(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::RemoveAuraFrom() - Invalid effect operator!");
     }
+
+    entity->IncreaseNumChanges();
 }
 
 IEffect* Effect::ChangeValue(int newValue) const
@@ -0,0 +1,325 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/ChooseTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace RosettaStone::PlayMode::PlayerTasks;
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! The index of the hero of the player as a target.
+constexpr std::size_t OWN_HERO = 1;
+
+//! The index of the first minion of the player as a target.
+constexpr std::size_t OWN_MINION = OWN_HERO + 1;
+
+//! The index of the hero of the opponent as a target.
+constexpr std::size_t OPPONENT_HERO = OWN_MINION + MAX_FIELD_SIZE;
+
+//! The index of the first minion of the opponent as a target.
+constexpr std::size_t OPPONENT_MINION = OPPONENT_HERO + 1;
+}  // namespace
+
+ActionType ActionSpace::GetActionType(std::size_t action)
+{
+    if (action < ATTACK_OFFSET)
+    {
+        return ActionType::PLAY_CARD;
+    }
+    if (action < HERO_POWER_OFFSET)
+    {
+        return ActionType::ATTACK;
+    }
+    if (action < CHOOSE_OFFSET)
+    {
+        return ActionType::HERO_POWER;
+    }
+    if (action < END_TURN)
+    {
+        return ActionType::CHOOSE;
+    }
+    if (action == END_TURN)
+    {
+        return ActionType::END_TURN;
+    }
+
+    throw std::invalid_argument(
+        "ActionSpace::GetActionType() - Invalid action " +
+        std::to_string(action));
+}
+
+std::size_t ActionSpace::GetActionMask(Player& player, std::uint8_t* mask)
+{
+    std::fill(mask, mask + SIZE, std::uint8_t{ 0 });
+    std::size_t numActions = 0;
+
+    const auto setAction = [&](std::size_t action) {
+        mask[action] = 1;
+        ++numActions;
+    };
+
+    // Process pending choice first
+    if (player.choice != nullptr)
+    {
+        if (player.choice->choiceType == ChoiceType::GENERAL)
+        {
+            const std::size_t numChoices =
+                std::min(player.choice->choices.size(), NUM_CHOICES);
+            for (std::size_t i = 0; i < numChoices; ++i)
+            {
+                setAction(ChooseAction(i));
+            }
+        }
+        else if (player.choice->choiceType == ChoiceType::MULLIGAN)
+        {
+            // NOTE: The mulligan has only one action that keeps all cards.
+            setAction(ChooseAction(0));
+        }
+
+        return numActions;
+    }
+
+    HandZone& handZone = *player.GetHandZone();
+    FieldZone& fieldZone = *player.GetFieldZone();
+    std::vector<std::size_t> targets;
+
+    // Play cards in hand
+    for (int handPos = 0; handPos < handZone.GetCount(); ++handPos)
+    {
+        Playable* playable = handZone[handPos];
+        const bool isMinion = dynamic_cast<Minion*>(playable) != nullptr;
+
+        if (isMinion && fieldZone.IsFull())
+        {
+            continue;
+        }
+
+        if (!playable->IsPlayableByPlayer() || !playable->IsPlayableByCardReq())
+        {
+            continue;
+        }
+
+        targets.clear();
+        if (playable->IsValidPlayTarget(nullptr))
+        {
+            targets.emplace_back(0);
+        }
+        for (auto& target : playable->GetValidPlayTargets())
+        {
+            if (playable->IsValidPlayTarget(target))
+            {
+                targets.emplace_back(GetTargetIndex(player, target));
+            }
+        }
+
+        const std::size_t numFieldPos =
+            isMinion ? static_cast<std::size_t>(fieldZone.GetCount()) + 1 : 1;
+        const bool hasChooseOne =
+            playable->HasChooseOne() && !player.ChooseBoth();
+
+        for (std::size_t chooseOne = hasChooseOne ? 1 : 0;
+             chooseOne <= (hasChooseOne ? 2u : 0u); ++chooseOne)
+        {
+            for (const std::size_t target : targets)
+            {
+                for (std::size_t fieldPos = 0; fieldPos < numFieldPos;
+                     ++fieldPos)
+                {
+                    setAction(PlayCardAction(handPos, target, fieldPos,
+                                             chooseOne));
+                }
+            }
+        }
+    }
+
+    // Attack with hero and minions
+    for (int attacker = 0; attacker <= fieldZone.GetCount(); ++attacker)
+    {
+        Character* character =
+            attacker == 0 ? static_cast<Character*>(player.GetHero())
+                          : fieldZone[attacker - 1];
+        if (!character->CanAttack())
+        {
+            continue;
+        }
+
+        for (auto& target : character->GetValidAttackTargets(player.opponent))
+        {
+            setAction(AttackAction(
+                attacker, GetTargetIndex(player, target) - OPPONENT_HERO));
+        }
+    }
+
+    // Use hero power
+    HeroPower& power = player.GetHeroPower();
+    if (power.IsPlayableByPlayer() && power.IsPlayableByCardReq() &&
+        !power.IsExhausted())
+    {
+        if (power.IsValidPlayTarget(nullptr))
+        {
+            setAction(HeroPowerAction(0));
+        }
+
+        for (auto& target : power.GetValidPlayTargets())
+        {
+            if (power.IsValidPlayTarget(target))
+            {
+                setAction(HeroPowerAction(GetTargetIndex(player, target)));
+            }
+        }
+    }
+
+    // End turn
+    setAction(END_TURN);
+
+    return numActions;
+}
+
+std::unique_ptr<ITask> ActionSpace::Decode(Player& player, std::size_t action)
+{
+    const auto getTarget = [&](std::size_t target) {
+        Character* character = GetTarget(player, target);
+        if (target != 0 && character == nullptr)
+        {
+            throw std::invalid_argument("ActionSpace::Decode() - No target " +
+                                        std::to_string(target));
+        }
+
+        return character;
+    };
+
+    switch (GetActionType(action))
+    {
+        case ActionType::PLAY_CARD:
+        {
+            std::size_t idx = action - PLAY_CARD_OFFSET;
+            const std::size_t chooseOne = idx % NUM_CHOOSE_ONES;
+            idx /= NUM_CHOOSE_ONES;
+            const std::size_t fieldPos = idx % MAX_FIELD_SIZE;
+            idx /= MAX_FIELD_SIZE;
+            const std::size_t target = idx % NUM_TARGETS;
+            const std::size_t handPos = idx / NUM_TARGETS;
+
+            HandZone& handZone = *player.GetHandZone();
+            if (handPos >= static_cast<std::size_t>(handZone.GetCount()))
+            {
+                throw std::invalid_argument(
+                    "ActionSpace::Decode() - No card in hand " +
+                    std::to_string(handPos));
+            }
+
+            Playable* playable = handZone[static_cast<int>(handPos)];
+            const int zonePos = dynamic_cast<Minion*>(playable) != nullptr
+                                    ? static_cast<int>(fieldPos)
+                                    : -1;
+
+            return std::make_unique<PlayCardTask>(
+                playable, getTarget(target), zonePos,
+                static_cast<int>(chooseOne));
+        }
+        case ActionType::ATTACK:
+        {
+            const std::size_t idx = action - ATTACK_OFFSET;
+            Character* attacker = getTarget(OWN_HERO + idx / NUM_CHARACTERS);
+            Character* defender =
+                getTarget(OPPONENT_HERO + idx % NUM_CHARACTERS);
+
+            return std::make_unique<AttackTask>(attacker, defender);
+        }
+        case ActionType::HERO_POWER:
+        {
+            return std::make_unique<HeroPowerTask>(
+                getTarget(action - HERO_POWER_OFFSET));
+        }
+        case ActionType::CHOOSE:
+        {
+            const std::size_t choice = action - CHOOSE_OFFSET;
+            if (player.choice == nullptr ||
+                choice >= player.choice->choices.size())
+            {
+                throw std::invalid_argument(
+                    "ActionSpace::Decode() - No choice " +
+                    std::to_string(choice));
+            }
+
+            if (player.choice->choiceType == ChoiceType::MULLIGAN)
+            {
+                return std::make_unique<ChooseTask>(
+                    ChooseTask::Mulligan(&player, player.choice->choices));
+            }
+
+            return std::make_unique<ChooseTask>(
+                ChooseTask::Pick(&player, player.choice->choices[choice]));
+        }
+        case ActionType::END_TURN:
+            return std::make_unique<EndTurnTask>();
+    }
+
+    throw std::invalid_argument("ActionSpace::Decode() - Invalid action " +
+                                std::to_string(action));
+}
+
+Character* ActionSpace::GetTarget(const Player& player, std::size_t target)
+{
+    const auto getMinion = [](const Player& owner, std::size_t pos) {
+        FieldZone& fieldZone = *owner.GetFieldZone();
+        return pos < static_cast<std::size_t>(fieldZone.GetCount())
+                   ? static_cast<Character*>(fieldZone[static_cast<int>(pos)])
+                   : nullptr;
+    };
+
+    if (target == 0 || target >= NUM_TARGETS)
+    {
+        return nullptr;
+    }
+    if (target == OWN_HERO)
+    {
+        return player.GetHero();
+    }
+    if (target < OPPONENT_HERO)
+    {
+        return getMinion(player, target - OWN_MINION);
+    }
+    if (target == OPPONENT_HERO)
+    {
+        return player.opponent->GetHero();
+    }
+
+    return getMinion(*player.opponent, target - OPPONENT_MINION);
+}
+
+std::size_t ActionSpace::GetTargetIndex(const Player& player,
+                                        const Character* character)
+{
+    if (character == player.GetHero())
+    {
+        return OWN_HERO;
+    }
+    if (character == player.opponent->GetHero())
+    {
+        return OPPONENT_HERO;
+    }
+
+    const auto zonePos = static_cast<std::size_t>(character->GetZonePosition());
+    return character->player == &player ? OWN_MINION + zonePos
+                                        : OPPONENT_MINION + zonePos;
+}
+}  // namespace RosettaStone::PlayMode
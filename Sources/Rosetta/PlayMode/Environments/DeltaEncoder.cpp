@@ -0,0 +1,186 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <cstdint>
+
+namespace RosettaStone::PlayMode
+{
+DeltaEncoder::DeltaEncoder(PlayerType playerType, bool isFiltered)
+    : m_playerType(playerType), m_isFiltered(isFiltered)
+{
+    // Do nothing
+}
+
+void DeltaEncoder::Reset()
+{
+    m_isDirty = true;
+}
+
+template <typename T>
+void DeltaEncoder::Encode(const Game& game, T* buffer)
+{
+    using Encoder = ObservationEncoder;
+
+    const Player* player = m_playerType == PlayerType::PLAYER1
+                               ? game.GetPlayer1()
+                               : game.GetPlayer2();
+
+    if (&game != m_game)
+    {
+        m_game = &game;
+        m_isDirty = true;
+    }
+
+    m_changedRanges.clear();
+
+    // NOTE: Minions and heroes can attack only in the turn of their owner,
+    // so all slots change when the current player changes.
+    const std::array<int, Encoder::GLOBAL_SIZE> global = {
+        static_cast<int>(game.GetTurn()),
+        static_cast<int>(game.GetCurrentPlayer() == player)
+    };
+    m_isCurrentChanged = global[1] != m_global[1];
+
+    if (m_isDirty || global != m_global)
+    {
+        m_global = global;
+        Encoder::EncodeGlobal(game, *player, buffer);
+        AddRange(0, Encoder::GLOBAL_SIZE);
+    }
+
+    EncodePlayer(*player, nullptr, m_caches[0], Encoder::GLOBAL_SIZE, buffer);
+    EncodePlayer(*player->opponent, m_isFiltered ? player : nullptr,
+                 m_caches[1], Encoder::GLOBAL_SIZE + Encoder::PLAYER_SIZE,
+                 buffer);
+
+    m_isDirty = false;
+}
+
+const std::vector<DeltaEncoder::Range>& DeltaEncoder::GetChangedRanges() const
+{
+    return m_changedRanges;
+}
+
+template <typename T>
+void DeltaEncoder::EncodePlayer(const Player& player, const Player* observer,
+                                PlayerCache& cache, std::size_t offset,
+                                T* buffer)
+{
+    using Encoder = ObservationEncoder;
+
+    const bool isAllChanged = m_isDirty || m_isCurrentChanged;
+    T* block = buffer + offset;
+
+    FieldZone& fieldZone = *player.GetFieldZone();
+    HandZone& handZone = *player.GetHandZone();
+    SecretZone& secretZone = *player.GetSecretZone();
+
+    // Hero, weapon, hero power, mana and counts
+    const Hero* hero = player.GetHero();
+    const HeroPower& heroPower = player.GetHeroPower();
+    const std::array<int, 4> counts = { handZone.GetCount(),
+                                        player.GetDeckZone()->GetCount(),
+                                        fieldZone.GetCount(),
+                                        secretZone.GetCount() };
+
+    bool isChanged = UpdateSlot(cache.hero, hero);
+    isChanged |= UpdateSlot(cache.heroPower, &heroPower);
+    isChanged |= UpdateSlot(cache.weapon,
+                            hero->HasWeapon() ? &player.GetWeapon() : nullptr);
+    isChanged |= cache.numChanges != player.GetNumChanges();
+    isChanged |= cache.counts != counts;
+
+    if (isAllChanged || isChanged || heroPower.costManager != nullptr)
+    {
+        cache.numChanges = player.GetNumChanges();
+        cache.counts = counts;
+        Encoder::EncodeHero(player, block);
+        AddRange(offset, Encoder::HERO_SIZE);
+    }
+
+    // Field
+    for (int i = 0; i < static_cast<int>(MAX_FIELD_SIZE); ++i)
+    {
+        const Minion* minion =
+            i < fieldZone.GetCount() ? fieldZone[i] : nullptr;
+        if (UpdateSlot(cache.field[i], minion) || isAllChanged)
+        {
+            const std::size_t pos = Encoder::FIELD_OFFSET +
+                                    i * Encoder::MINION_SIZE;
+            Encoder::EncodeMinion(minion, block + pos);
+            AddRange(offset + pos, Encoder::MINION_SIZE);
+        }
+    }
+
+    // Hand
+    for (int i = 0; i < static_cast<int>(MAX_HAND_SIZE); ++i)
+    {
+        const Playable* playable =
+            i < handZone.GetCount() ? handZone[i] : nullptr;
+        if (UpdateSlot(cache.hand[i], playable) || isAllChanged ||
+            (playable != nullptr && playable->costManager != nullptr))
+        {
+            const std::size_t pos = Encoder::HAND_OFFSET +
+                                    i * Encoder::HAND_CARD_SIZE;
+            Encoder::EncodeHandCard(playable, observer, block + pos);
+            AddRange(offset + pos, Encoder::HAND_CARD_SIZE);
+        }
+    }
+
+    // Secret
+    for (int i = 0; i < static_cast<int>(MAX_SECERT_SIZE); ++i)
+    {
+        const Spell* spell =
+            i < secretZone.GetCount() ? secretZone[i] : nullptr;
+        if (UpdateSlot(cache.secrets[i], spell) || isAllChanged)
+        {
+            const std::size_t pos = Encoder::SECRET_OFFSET +
+                                    i * Encoder::SECRET_SIZE;
+            Encoder::EncodeSecret(spell, observer, block + pos);
+            AddRange(offset + pos, Encoder::SECRET_SIZE);
+        }
+    }
+}
+
+bool DeltaEncoder::UpdateSlot(Slot& slot, const Entity* entity)
+{
+    const int entityID =
+        entity != nullptr ? entity->GetGameTag(GameTag::ENTITY_ID) : -1;
+    const std::size_t numChanges =
+        entity != nullptr ? entity->GetNumChanges() : 0;
+    if (slot.entityID == entityID && slot.numChanges == numChanges)
+    {
+        return false;
+    }
+
+    slot.entityID = entityID;
+    slot.numChanges = numChanges;
+    return true;
+}
+
+void DeltaEncoder::AddRange(std::size_t offset, std::size_t size)
+{
+    if (!m_changedRanges.empty() && m_changedRanges.back().second == offset)
+    {
+        m_changedRanges.back().second += size;
+        return;
+    }
+
+    m_changedRanges.emplace_back(offset, offset + size);
+}
+
+template void DeltaEncoder::Encode<float>(const Game& game, float* buffer);
+template void DeltaEncoder::Encode<std::int32_t>(const Game& game,
+                                                 std::int32_t* buffer);
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,53 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Environments/InformationFilter.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+namespace RosettaStone::PlayMode
+{
+bool InformationFilter::IsVisible(const Player& observer,
+                                  const Playable& playable)
+{
+    if (playable.player == &observer)
+    {
+        return true;
+    }
+
+    switch (playable.GetZoneType())
+    {
+        case ZoneType::HAND:
+        case ZoneType::DECK:
+        case ZoneType::SECRET:
+        case ZoneType::SETASIDE:
+            break;
+        default:
+            return true;
+    }
+
+    // NOTE: A quest is revealed when it is played, so it is hidden in the hand
+    // and the deck like any other card.
+    if (playable.GetGameTag(GameTag::REVEALED) == 1 ||
+        (playable.card->IsQuest() &&
+         playable.GetZoneType() == ZoneType::SECRET))
+    {
+        return true;
+    }
+
+    // NOTE: A card created by the observer, such as a card that the observer
+    // gave to the opponent, is known to the observer.
+    const int creatorID = playable.GetGameTag(GameTag::CREATOR);
+    if (creatorID > 0)
+    {
+        const auto& entityList = playable.game->entityList;
+        const auto iter = entityList.find(creatorID);
+        return iter != entityList.end() && iter->second->player == &observer;
+    }
+
+    return false;
+}
+}  // namespace RosettaStone::PlayMode
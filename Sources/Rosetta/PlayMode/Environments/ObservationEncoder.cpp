@@ -0,0 +1,221 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
+#include <Rosetta/PlayMode/Environments/InformationFilter.hpp>
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Returns the card index of \p card: its row in CardFeatures plus one.
+template <typename T>
+T GetCardIndex(const Card& card)
+{
+    return static_cast<T>(
+        CardFeatures::GetInstance().GetIndexByDbfID(card.dbfID) + 1);
+}
+}  // namespace
+
+template <typename T>
+void ObservationEncoder::Encode(const Game& game, PlayerType playerType,
+                                T* buffer, bool isFiltered)
+{
+    const Player* player = playerType == PlayerType::PLAYER1
+                               ? game.GetPlayer1()
+                               : game.GetPlayer2();
+
+    EncodeGlobal(game, *player, buffer);
+    EncodePlayer(*player, nullptr, buffer + GLOBAL_SIZE);
+    EncodePlayer(*player->opponent, isFiltered ? player : nullptr,
+                 buffer + GLOBAL_SIZE + PLAYER_SIZE);
+}
+
+template <typename T>
+void ObservationEncoder::EncodeGlobal(const Game& game, const Player& player,
+                                      T* buffer)
+{
+    buffer[0] = static_cast<T>(game.GetTurn());
+    buffer[1] = static_cast<T>(game.GetCurrentPlayer() == &player);
+}
+
+template <typename T>
+void ObservationEncoder::EncodePlayer(const Player& player,
+                                      const Player* observer, T* buffer)
+{
+    EncodeHero(player, buffer);
+
+    FieldZone& fieldZone = *player.GetFieldZone();
+    for (int i = 0; i < static_cast<int>(MAX_FIELD_SIZE); ++i)
+    {
+        EncodeMinion(i < fieldZone.GetCount() ? fieldZone[i] : nullptr,
+                     buffer + FIELD_OFFSET + i * MINION_SIZE);
+    }
+
+    HandZone& handZone = *player.GetHandZone();
+    for (int i = 0; i < static_cast<int>(MAX_HAND_SIZE); ++i)
+    {
+        EncodeHandCard(i < handZone.GetCount() ? handZone[i] : nullptr,
+                       observer, buffer + HAND_OFFSET + i * HAND_CARD_SIZE);
+    }
+
+    SecretZone& secretZone = *player.GetSecretZone();
+    for (int i = 0; i < static_cast<int>(MAX_SECERT_SIZE); ++i)
+    {
+        EncodeSecret(i < secretZone.GetCount() ? secretZone[i] : nullptr,
+                     observer, buffer + SECRET_OFFSET + i * SECRET_SIZE);
+    }
+}
+
+template <typename T>
+void ObservationEncoder::EncodeHero(const Player& player, T* buffer)
+{
+    const Hero* hero = player.GetHero();
+    const HeroPower& heroPower = player.GetHeroPower();
+    T* values = buffer;
+
+    *values++ = static_cast<T>(hero->GetHealth());
+    *values++ = static_cast<T>(hero->GetBaseHealth());
+    *values++ = static_cast<T>(hero->GetArmor());
+    *values++ = static_cast<T>(hero->GetAttack());
+    *values++ = static_cast<T>(hero->CanAttack());
+
+    if (hero->HasWeapon())
+    {
+        const Weapon& weapon = player.GetWeapon();
+        *values++ = T{ 1 };
+        *values++ = static_cast<T>(weapon.GetAttack());
+        *values++ = static_cast<T>(weapon.GetDurability());
+    }
+    else
+    {
+        *values++ = T{ 0 };
+        *values++ = T{ 0 };
+        *values++ = T{ 0 };
+    }
+
+    *values++ = static_cast<T>(heroPower.GetCost());
+    *values++ = static_cast<T>(heroPower.IsExhausted());
+
+    *values++ = static_cast<T>(player.GetTotalMana());
+    *values++ = static_cast<T>(player.GetUsedMana());
+    *values++ = static_cast<T>(player.GetTemporaryMana());
+    *values++ = static_cast<T>(player.GetRemainingMana());
+    *values++ = static_cast<T>(player.GetOverloadOwed());
+    *values++ = static_cast<T>(player.GetOverloadLocked());
+
+    *values++ = static_cast<T>(player.GetHandZone()->GetCount());
+    *values++ = static_cast<T>(player.GetDeckZone()->GetCount());
+    *values++ = static_cast<T>(player.GetFieldZone()->GetCount());
+    *values++ = static_cast<T>(player.GetSecretZone()->GetCount());
+}
+
+template <typename T>
+void ObservationEncoder::EncodeMinion(const Minion* minion, T* buffer)
+{
+    if (minion == nullptr)
+    {
+        std::fill(buffer, buffer + MINION_SIZE, T{ 0 });
+        return;
+    }
+
+    T* values = buffer;
+
+    *values++ = T{ 1 };
+    *values++ = GetCardIndex<T>(*minion->card);
+    *values++ = static_cast<T>(minion->GetAttack());
+    *values++ = static_cast<T>(minion->GetHealth());
+    *values++ = static_cast<T>(minion->GetBaseHealth());
+    *values++ = static_cast<T>(minion->CanAttack());
+    *values++ = static_cast<T>(minion->HasTaunt());
+    *values++ = static_cast<T>(minion->HasDivineShield());
+    *values++ = static_cast<T>(minion->HasPoisonous());
+    *values++ = static_cast<T>(minion->HasStealth());
+    *values++ = static_cast<T>(minion->HasWindfury());
+    *values++ = static_cast<T>(minion->IsFrozen());
+}
+
+template <typename T>
+void ObservationEncoder::EncodeHandCard(const Playable* playable,
+                                        const Player* observer, T* buffer)
+{
+    std::fill(buffer, buffer + HAND_CARD_SIZE, T{ 0 });
+    if (playable == nullptr)
+    {
+        return;
+    }
+
+    buffer[0] = T{ 1 };
+    if (observer == nullptr ||
+        InformationFilter::IsVisible(*observer, *playable))
+    {
+        buffer[1] = GetCardIndex<T>(*playable->card);
+        buffer[2] = static_cast<T>(playable->GetCost());
+    }
+}
+
+template <typename T>
+void ObservationEncoder::EncodeSecret(const Spell* spell,
+                                      const Player* observer, T* buffer)
+{
+    std::fill(buffer, buffer + SECRET_SIZE, T{ 0 });
+    if (spell == nullptr)
+    {
+        return;
+    }
+
+    buffer[0] = T{ 1 };
+    if (observer == nullptr || InformationFilter::IsVisible(*observer, *spell))
+    {
+        buffer[1] = GetCardIndex<T>(*spell->card);
+    }
+    buffer[2] = static_cast<T>(spell->card->GetCardClass());
+}
+
+template void ObservationEncoder::Encode<float>(const Game& game,
+                                                PlayerType playerType,
+                                                float* buffer,
+                                                bool isFiltered);
+template void ObservationEncoder::Encode<std::int32_t>(const Game& game,
+                                                       PlayerType playerType,
+                                                       std::int32_t* buffer,
+                                                       bool isFiltered);
+
+template void ObservationEncoder::EncodeGlobal<float>(const Game& game,
+                                                      const Player& player,
+                                                      float* buffer);
+template void ObservationEncoder::EncodeHero<float>(const Player& player,
+                                                    float* buffer);
+template void ObservationEncoder::EncodeMinion<float>(const Minion* minion,
+                                                      float* buffer);
+template void ObservationEncoder::EncodeHandCard<float>(
+    const Playable* playable, const Player* observer, float* buffer);
+template void ObservationEncoder::EncodeSecret<float>(const Spell* spell,
+                                                      const Player* observer,
+                                                      float* buffer);
+
+template void ObservationEncoder::EncodeGlobal<std::int32_t>(
+    const Game& game, const Player& player, std::int32_t* buffer);
+template void ObservationEncoder::EncodeHero<std::int32_t>(
+    const Player& player, std::int32_t* buffer);
+template void ObservationEncoder::EncodeMinion<std::int32_t>(
+    const Minion* minion, std::int32_t* buffer);
+template void ObservationEncoder::EncodeHandCard<std::int32_t>(
+    const Playable* playable, const Player* observer, std::int32_t* buffer);
+template void ObservationEncoder::EncodeSecret<std::int32_t>(
+    const Spell* spell, const Player* observer, std::int32_t* buffer);
+}  // namespace RosettaStone::PlayMode
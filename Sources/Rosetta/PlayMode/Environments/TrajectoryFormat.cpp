@@ -0,0 +1,70 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Environments/TrajectoryFormat.hpp>
+
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+std::array<std::size_t, TrajectoryFormat::NUM_COLUMNS + 1>
+TrajectoryFormat::GetColumnOffsets(const TrajectoryShape& shape,
+                                   std::size_t numSteps)
+{
+    std::array<std::size_t, NUM_COLUMNS + 1> offsets{};
+    offsets[0] = CHUNK_HEADER_SIZE;
+
+    for (std::size_t i = 0; i < NUM_COLUMNS; ++i)
+    {
+        const auto column = static_cast<TrajectoryColumn>(i);
+        offsets[i + 1] =
+            offsets[i] + Align(numSteps * GetNumValues(shape, column) *
+                               GetValueSize(column));
+    }
+
+    return offsets;
+}
+
+std::size_t TrajectoryFormat::GetValueSize(TrajectoryColumn column)
+{
+    switch (column)
+    {
+        case TrajectoryColumn::OBSERVATIONS:
+        case TrajectoryColumn::REWARDS:
+        case TrajectoryColumn::STATS:
+            return sizeof(float);
+        case TrajectoryColumn::ACTIONS:
+            return sizeof(std::int32_t);
+        case TrajectoryColumn::MASKS:
+        case TrajectoryColumn::DONES:
+            return sizeof(std::uint8_t);
+    }
+
+    throw std::invalid_argument(
+        "TrajectoryFormat::GetValueSize() - Invalid column");
+}
+
+std::size_t TrajectoryFormat::GetNumValues(const TrajectoryShape& shape,
+                                           TrajectoryColumn column)
+{
+    switch (column)
+    {
+        case TrajectoryColumn::OBSERVATIONS:
+            return shape.observationSize;
+        case TrajectoryColumn::MASKS:
+            return shape.actionSize;
+        case TrajectoryColumn::STATS:
+            return shape.numStats;
+        case TrajectoryColumn::ACTIONS:
+        case TrajectoryColumn::REWARDS:
+        case TrajectoryColumn::DONES:
+            return 1;
+    }
+
+    throw std::invalid_argument(
+        "TrajectoryFormat::GetNumValues() - Invalid column");
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,269 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryReader.hpp>
+
+#if defined(ROSETTASTONE_WINDOWS)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+template <typename T>
+T TrajectoryReader::Read(std::size_t offset) const
+{
+    T value;
+    std::memcpy(&value, m_data + offset, sizeof(T));
+
+    return value;
+}
+
+TrajectoryReader::TrajectoryReader(const std::string& path)
+{
+#if defined(ROSETTASTONE_WINDOWS)
+    // NOTE: The file is read into memory because mmap isn't available.
+    std::ifstream fileInput(path, std::ios::binary | std::ios::ate);
+    if (!fileInput)
+    {
+        throw std::runtime_error(
+            "TrajectoryReader::TrajectoryReader() - Can't open " + path);
+    }
+
+    m_buffer.resize(static_cast<std::size_t>(fileInput.tellg()));
+    fileInput.seekg(0);
+    fileInput.read(reinterpret_cast<char*>(m_buffer.data()),
+                   static_cast<std::streamsize>(m_buffer.size()));
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error(
+            "TrajectoryReader::TrajectoryReader() - Can't open " + path);
+    }
+
+    struct stat fileStat
+    {
+    };
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw std::runtime_error(
+            "TrajectoryReader::TrajectoryReader() - Can't open " + path);
+    }
+
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+    if (m_size >= TrajectoryFormat::HEADER_SIZE)
+    {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            throw std::runtime_error(
+                "TrajectoryReader::TrajectoryReader() - Failed to map " +
+                path);
+        }
+        m_data = static_cast<const unsigned char*>(data);
+    }
+    close(fd);
+#endif
+
+    if (m_size < TrajectoryFormat::HEADER_SIZE ||
+        std::memcmp(m_data, TrajectoryFormat::FILE_MAGIC,
+                    sizeof(TrajectoryFormat::FILE_MAGIC)) != 0)
+    {
+        Unmap();
+        throw std::runtime_error(
+            "TrajectoryReader::TrajectoryReader() - Invalid trajectory file " +
+            path);
+    }
+
+    constexpr std::size_t valueOffset = sizeof(TrajectoryFormat::FILE_MAGIC);
+    m_shape.observationSize = Read<std::uint32_t>(valueOffset);
+    m_shape.actionSize = Read<std::uint32_t>(valueOffset + 4);
+    m_shape.numStats = Read<std::uint32_t>(valueOffset + 8);
+    m_chunkSize = Read<std::uint32_t>(valueOffset + 12);
+
+    if (!ReadIndex())
+    {
+        ScanChunks();
+    }
+
+    for (const auto& chunk : m_index)
+    {
+        m_numSteps += static_cast<std::size_t>(chunk.second);
+    }
+}
+
+TrajectoryReader::~TrajectoryReader()
+{
+    Unmap();
+}
+
+const TrajectoryShape& TrajectoryReader::GetShape() const
+{
+    return m_shape;
+}
+
+std::size_t TrajectoryReader::GetChunkSize() const
+{
+    return m_chunkSize;
+}
+
+std::size_t TrajectoryReader::GetNumChunks() const
+{
+    return m_index.size();
+}
+
+std::size_t TrajectoryReader::GetNumSteps() const
+{
+    return m_numSteps;
+}
+
+TrajectoryChunk TrajectoryReader::GetChunk(std::size_t idx) const
+{
+    if (idx >= m_index.size())
+    {
+        throw std::invalid_argument(
+            "TrajectoryReader::GetChunk() - Invalid chunk " +
+            std::to_string(idx));
+    }
+
+    const auto [offset, numSteps] = m_index[idx];
+    const auto offsets = TrajectoryFormat::GetColumnOffsets(
+        m_shape, static_cast<std::size_t>(numSteps));
+    const unsigned char* chunk = m_data + offset;
+
+    const auto getColumn = [&](TrajectoryColumn column) {
+        return chunk + offsets[static_cast<std::size_t>(column)];
+    };
+
+    TrajectoryChunk result;
+    result.numSteps = static_cast<std::size_t>(numSteps);
+    result.observations = reinterpret_cast<const float*>(
+        getColumn(TrajectoryColumn::OBSERVATIONS));
+    result.actions = reinterpret_cast<const std::int32_t*>(
+        getColumn(TrajectoryColumn::ACTIONS));
+    result.masks = getColumn(TrajectoryColumn::MASKS);
+    result.rewards =
+        reinterpret_cast<const float*>(getColumn(TrajectoryColumn::REWARDS));
+    result.dones = getColumn(TrajectoryColumn::DONES);
+    result.stats =
+        reinterpret_cast<const float*>(getColumn(TrajectoryColumn::STATS));
+
+    return result;
+}
+
+bool TrajectoryReader::ReadIndex()
+{
+    constexpr std::size_t entrySize = 2 * sizeof(std::uint64_t);
+
+    if (m_size < TrajectoryFormat::HEADER_SIZE + TrajectoryFormat::FOOTER_SIZE)
+    {
+        return false;
+    }
+
+    const std::size_t footer = m_size - TrajectoryFormat::FOOTER_SIZE;
+    if (std::memcmp(m_data + footer + 3 * sizeof(std::uint64_t),
+                    TrajectoryFormat::FOOTER_MAGIC,
+                    sizeof(TrajectoryFormat::FOOTER_MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    const auto indexOffset = Read<std::uint64_t>(footer);
+    const auto numChunks = Read<std::uint64_t>(footer + 8);
+    if (indexOffset > footer || (footer - indexOffset) / entrySize != numChunks)
+    {
+        return false;
+    }
+
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> index;
+    index.reserve(static_cast<std::size_t>(numChunks));
+
+    for (std::size_t i = 0; i < numChunks; ++i)
+    {
+        const std::size_t entry = indexOffset + i * entrySize;
+        const auto offset = Read<std::uint64_t>(entry);
+        const auto numSteps = Read<std::uint64_t>(entry + 8);
+
+        if (!IsValidChunk(offset, numSteps))
+        {
+            return false;
+        }
+        index.emplace_back(offset, numSteps);
+    }
+
+    m_index = std::move(index);
+    return true;
+}
+
+void TrajectoryReader::ScanChunks()
+{
+    std::uint64_t offset = TrajectoryFormat::HEADER_SIZE;
+
+    while (offset + TrajectoryFormat::CHUNK_HEADER_SIZE <= m_size)
+    {
+        const auto numSteps = Read<std::uint64_t>(
+            offset + sizeof(TrajectoryFormat::CHUNK_MAGIC));
+        if (!IsValidChunk(offset, numSteps))
+        {
+            break;
+        }
+
+        m_index.emplace_back(offset, numSteps);
+        offset += TrajectoryFormat::GetColumnOffsets(
+                      m_shape, static_cast<std::size_t>(numSteps))
+                      .back();
+    }
+}
+
+void TrajectoryReader::Unmap()
+{
+#if !defined(ROSETTASTONE_WINDOWS)
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool TrajectoryReader::IsValidChunk(std::uint64_t offset,
+                                    std::uint64_t numSteps) const
+{
+    if (offset < TrajectoryFormat::HEADER_SIZE ||
+        offset % TrajectoryFormat::ALIGNMENT != 0 ||
+        offset + TrajectoryFormat::CHUNK_HEADER_SIZE > m_size ||
+        numSteps == 0 || numSteps > m_size)
+    {
+        return false;
+    }
+
+    const std::size_t chunkSize =
+        TrajectoryFormat::GetColumnOffsets(
+            m_shape, static_cast<std::size_t>(numSteps))
+            .back();
+
+    constexpr std::size_t magicSize = sizeof(TrajectoryFormat::CHUNK_MAGIC);
+    return chunkSize <= m_size - offset &&
+           std::memcmp(m_data + offset, TrajectoryFormat::CHUNK_MAGIC,
+                       magicSize) == 0 &&
+           Read<std::uint64_t>(offset + magicSize) == numSteps;
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,338 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Environments/TrajectoryWriter.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+TrajectoryWriter::TrajectoryWriter(const std::string& path,
+                                   const TrajectoryShape& shape,
+                                   std::size_t chunkSize,
+                                   std::size_t maxPendingChunks)
+    : m_file(path, std::ios::binary | std::ios::trunc),
+      m_shape(shape),
+      m_chunkSize(chunkSize),
+      m_maxPendingChunks(maxPendingChunks),
+      m_offsets(TrajectoryFormat::GetColumnOffsets(shape, chunkSize))
+{
+    if (chunkSize == 0)
+    {
+        throw std::invalid_argument(
+            "TrajectoryWriter::TrajectoryWriter() - The number of steps per "
+            "chunk must be positive!");
+    }
+
+    if (maxPendingChunks == 0)
+    {
+        throw std::invalid_argument(
+            "TrajectoryWriter::TrajectoryWriter() - The number of pending "
+            "chunks must be positive!");
+    }
+
+    std::array<char, TrajectoryFormat::HEADER_SIZE> header{};
+    const std::array<std::uint32_t, 4> values = {
+        static_cast<std::uint32_t>(shape.observationSize),
+        static_cast<std::uint32_t>(shape.actionSize),
+        static_cast<std::uint32_t>(shape.numStats),
+        static_cast<std::uint32_t>(chunkSize)
+    };
+    std::memcpy(header.data(), TrajectoryFormat::FILE_MAGIC,
+                sizeof(TrajectoryFormat::FILE_MAGIC));
+    std::memcpy(header.data() + sizeof(TrajectoryFormat::FILE_MAGIC),
+                values.data(), sizeof(values));
+
+    m_file.write(header.data(), header.size());
+    if (!m_file)
+    {
+        throw std::runtime_error(
+            "TrajectoryWriter::TrajectoryWriter() - Can't write " + path);
+    }
+
+    m_fileOffset = TrajectoryFormat::HEADER_SIZE;
+    m_chunk.assign(m_offsets.back(), 0);
+    m_thread = std::thread([this] { WriterLoop(); });
+}
+
+TrajectoryWriter::~TrajectoryWriter()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+        // NOTE: A destructor must not throw. Call Close() to get the error.
+    }
+}
+
+void TrajectoryWriter::Append(std::size_t numSteps, const float* observations,
+                              const std::int32_t* actions,
+                              const std::uint8_t* masks, const float* rewards,
+                              const std::uint8_t* dones, const float* stats)
+{
+    const std::array<const void*, TrajectoryFormat::NUM_COLUMNS> sources = {
+        observations, actions, masks, rewards, dones, stats
+    };
+
+    std::lock_guard<std::mutex> chunkLock(m_chunkMutex);
+    if (m_isClosed)
+    {
+        throw std::logic_error(
+            "TrajectoryWriter::Append() - The file is already closed!");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        CheckError();
+    }
+
+    std::size_t step = 0;
+    while (step < numSteps)
+    {
+        const std::size_t count =
+            std::min(numSteps - step, m_chunkSize - m_numChunkSteps);
+
+        for (std::size_t i = 0; i < TrajectoryFormat::NUM_COLUMNS; ++i)
+        {
+            const auto column = static_cast<TrajectoryColumn>(i);
+            const std::size_t rowSize =
+                TrajectoryFormat::GetNumValues(m_shape, column) *
+                TrajectoryFormat::GetValueSize(column);
+            unsigned char* dst =
+                m_chunk.data() + m_offsets[i] + m_numChunkSteps * rowSize;
+
+            if (sources[i] == nullptr)
+            {
+                std::memset(dst, 0, count * rowSize);
+            }
+            else
+            {
+                std::memcpy(
+                    dst,
+                    static_cast<const unsigned char*>(sources[i]) +
+                        step * rowSize,
+                    count * rowSize);
+            }
+        }
+
+        step += count;
+        m_numChunkSteps += count;
+        m_numSteps += count;
+
+        if (m_numChunkSteps == m_chunkSize)
+        {
+            PushChunk();
+        }
+    }
+}
+
+void TrajectoryWriter::Flush()
+{
+    {
+        std::lock_guard<std::mutex> chunkLock(m_chunkMutex);
+        PushChunk();
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_writtenCond.wait(
+        lock, [this] { return m_numWrittenChunks == m_numPushedChunks; });
+    CheckError();
+}
+
+void TrajectoryWriter::Close()
+{
+    std::lock_guard<std::mutex> chunkLock(m_chunkMutex);
+    if (m_isClosed)
+    {
+        return;
+    }
+
+    m_isClosed = true;
+    PushChunk();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+    }
+    m_queueCond.notify_one();
+    m_thread.join();
+
+    // NOTE: The background thread is joined, so this thread owns the file.
+    if (!m_error.empty())
+    {
+        m_file.close();
+        CheckError();
+    }
+
+    for (const auto& [offset, numSteps] : m_index)
+    {
+        const std::array<std::uint64_t, 2> entry = { offset, numSteps };
+        m_file.write(reinterpret_cast<const char*>(entry.data()),
+                     sizeof(entry));
+    }
+
+    std::array<char, TrajectoryFormat::FOOTER_SIZE> footer{};
+    const std::array<std::uint64_t, 3> values = {
+        m_fileOffset, static_cast<std::uint64_t>(m_index.size()),
+        static_cast<std::uint64_t>(m_numSteps)
+    };
+    std::memcpy(footer.data(), values.data(), sizeof(values));
+    std::memcpy(footer.data() + sizeof(values), TrajectoryFormat::FOOTER_MAGIC,
+                sizeof(TrajectoryFormat::FOOTER_MAGIC));
+
+    m_file.write(footer.data(), footer.size());
+    m_file.close();
+
+    if (!m_file)
+    {
+        throw std::runtime_error(
+            "TrajectoryWriter::Close() - Failed to write the index!");
+    }
+}
+
+const TrajectoryShape& TrajectoryWriter::GetShape() const
+{
+    return m_shape;
+}
+
+std::size_t TrajectoryWriter::GetNumSteps() const
+{
+    std::lock_guard<std::mutex> chunkLock(m_chunkMutex);
+    return m_numSteps;
+}
+
+void TrajectoryWriter::PushChunk()
+{
+    const std::size_t numSteps = m_numChunkSteps;
+    if (numSteps == 0)
+    {
+        return;
+    }
+
+    std::vector<unsigned char> chunk;
+    if (numSteps == m_chunkSize)
+    {
+        chunk = std::move(m_chunk);
+    }
+    else
+    {
+        // NOTE: A partial chunk is packed so that its columns are contiguous.
+        const auto offsets =
+            TrajectoryFormat::GetColumnOffsets(m_shape, numSteps);
+        chunk.assign(offsets.back(), 0);
+
+        for (std::size_t i = 0; i < TrajectoryFormat::NUM_COLUMNS; ++i)
+        {
+            const auto column = static_cast<TrajectoryColumn>(i);
+            const std::size_t rowSize =
+                TrajectoryFormat::GetNumValues(m_shape, column) *
+                TrajectoryFormat::GetValueSize(column);
+            std::memcpy(chunk.data() + offsets[i],
+                        m_chunk.data() + m_offsets[i], numSteps * rowSize);
+        }
+    }
+
+    const auto numChunkSteps = static_cast<std::uint64_t>(numSteps);
+    std::memcpy(chunk.data(), TrajectoryFormat::CHUNK_MAGIC,
+                sizeof(TrajectoryFormat::CHUNK_MAGIC));
+    std::memcpy(chunk.data() + sizeof(TrajectoryFormat::CHUNK_MAGIC),
+                &numChunkSteps, sizeof(numChunkSteps));
+    m_numChunkSteps = 0;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // NOTE: The writer thread keeps consuming the queue after an error,
+        // so this wait always ends.
+        m_writtenCond.wait(lock, [this] {
+            return m_numPushedChunks - m_numWrittenChunks <
+                   m_maxPendingChunks;
+        });
+
+        if (m_chunk.empty())
+        {
+            if (m_freeChunks.empty())
+            {
+                m_chunk.assign(m_offsets.back(), 0);
+            }
+            else
+            {
+                m_chunk = std::move(m_freeChunks.back());
+                m_freeChunks.pop_back();
+            }
+        }
+
+        m_queue.emplace_back(std::move(chunk), numSteps);
+        ++m_numPushedChunks;
+    }
+
+    m_queueCond.notify_one();
+}
+
+void TrajectoryWriter::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_queueCond.wait(lock,
+                         [this] { return m_isStopped || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            break;
+        }
+
+        auto [chunk, numSteps] = std::move(m_queue.front());
+        m_queue.pop_front();
+        const bool isLast = m_queue.empty();
+        const bool hasError = !m_error.empty();
+        lock.unlock();
+
+        if (!hasError)
+        {
+            m_file.write(reinterpret_cast<const char*>(chunk.data()),
+                         static_cast<std::streamsize>(chunk.size()));
+            if (isLast)
+            {
+                m_file.flush();
+            }
+        }
+        const bool isFailed = !hasError && !m_file;
+
+        lock.lock();
+        if (isFailed)
+        {
+            m_error = "TrajectoryWriter::WriterLoop() - Failed to write a "
+                      "chunk!";
+        }
+        else if (!hasError)
+        {
+            m_index.emplace_back(m_fileOffset, numSteps);
+            m_fileOffset += chunk.size();
+        }
+
+        if (chunk.size() == m_offsets.back())
+        {
+            m_freeChunks.emplace_back(std::move(chunk));
+        }
+
+        ++m_numWrittenChunks;
+        m_writtenCond.notify_all();
+    }
+}
+
+void TrajectoryWriter::CheckError() const
+{
+    if (!m_error.empty())
+    {
+        throw std::runtime_error(m_error);
+    }
+}
+}  // namespace RosettaStone::PlayMode
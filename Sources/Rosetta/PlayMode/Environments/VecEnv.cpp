@@ -0,0 +1,240 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Environments/VecEnv.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+GameConfig MakeEnvConfig(const GameConfig& config)
+{
+    GameConfig envConfig = config;
+    envConfig.skipMulligan = true;
+    envConfig.autoRun = true;
+
+    return envConfig;
+}
+
+bool IsDone(const Game& game)
+{
+    return game.state == State::COMPLETE || game.GetTurn() > MAX_GAME_TURN;
+}
+}  // namespace
+
+VecEnv::VecEnv(ThreadPool& pool, const GameConfig& config,
+               std::size_t numEnvs, std::uint64_t seed)
+    : m_pool(pool),
+      m_prototype(MakeEnvConfig(config)),
+      m_seed(seed),
+      m_envs(numEnvs),
+      m_observations(numEnvs * OBSERVATION_SIZE, 0.0f),
+      m_rewards(numEnvs, 0.0f),
+      m_dones(numEnvs, 0),
+      m_actionMasks(numEnvs * ACTION_SIZE, 0)
+{
+    if (numEnvs == 0)
+    {
+        throw std::invalid_argument(
+            "VecEnv::VecEnv() - The number of games must be positive!");
+    }
+}
+
+void VecEnv::Reset()
+{
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_dones.begin(), m_dones.end(), std::uint8_t{ 0 });
+
+    m_pool.ParallelFor(m_envs.size(), [this](std::size_t idx) {
+        ResetEnv(idx);
+        UpdateEnv(idx);
+    });
+}
+
+void VecEnv::Step(const std::vector<int>& actions)
+{
+    if (actions.size() != m_envs.size())
+    {
+        throw std::invalid_argument(
+            "VecEnv::Step() - The number of actions must match the number of "
+            "games!");
+    }
+
+    for (std::size_t idx = 0; idx < m_envs.size(); ++idx)
+    {
+        if (m_envs[idx].game == nullptr)
+        {
+            throw std::logic_error(
+                "VecEnv::Step() - Reset() must be called before Step()!");
+        }
+
+        const int action = actions[idx];
+        if (action < 0 || action >= static_cast<int>(ACTION_SIZE) ||
+            m_actionMasks[idx * ACTION_SIZE + action] == 0)
+        {
+            throw std::invalid_argument(
+                "VecEnv::Step() - Invalid action " + std::to_string(action) +
+                " of game " + std::to_string(idx));
+        }
+    }
+
+    m_pool.ParallelFor(m_envs.size(), [&](std::size_t idx) {
+        StepEnv(idx, actions[idx]);
+        UpdateEnv(idx);
+    });
+}
+
+void VecEnv::Step(const std::vector<int>& actions, TrajectoryWriter& writer,
+                  const float* stats)
+{
+    const TrajectoryShape& shape = writer.GetShape();
+    if (shape.observationSize != OBSERVATION_SIZE ||
+        shape.actionSize != ACTION_SIZE)
+    {
+        throw std::invalid_argument(
+            "VecEnv::Step() - The shape of trajectory doesn't match the "
+            "environment!");
+    }
+
+    // NOTE: Step() overwrites the buffers, so keep the inputs of actions.
+    m_prevObservations = m_observations;
+    m_prevActionMasks = m_actionMasks;
+
+    Step(actions);
+
+    writer.Append(m_envs.size(), m_prevObservations.data(), actions.data(),
+                  m_prevActionMasks.data(), m_rewards.data(), m_dones.data(),
+                  stats);
+}
+
+std::size_t VecEnv::GetNumEnvs() const
+{
+    return m_envs.size();
+}
+
+const Game& VecEnv::GetGame(std::size_t idx) const
+{
+    return *m_envs.at(idx).game;
+}
+
+float* VecEnv::GetObservations()
+{
+    return m_observations.data();
+}
+
+float* VecEnv::GetRewards()
+{
+    return m_rewards.data();
+}
+
+std::uint8_t* VecEnv::GetDones()
+{
+    return m_dones.data();
+}
+
+std::uint8_t* VecEnv::GetActionMasks()
+{
+    return m_actionMasks.data();
+}
+
+void VecEnv::Seed(std::size_t idx)
+{
+    // NOTE: Streams of games are interleaved, so they never overlap.
+    Env& env = m_envs[idx];
+    SeedRandom(m_seed, env.numSeeds++ * m_envs.size() + idx);
+}
+
+void VecEnv::ResetEnv(std::size_t idx)
+{
+    Env& env = m_envs[idx];
+    Seed(idx);
+
+    env.game = m_prototype.CreateGame();
+    env.encoder.Reset();
+    env.game->Start();
+    PlayOpponent(*env.game);
+
+    env.turn = env.game->GetTurn();
+    env.numTasks = 0;
+}
+
+void VecEnv::StepEnv(std::size_t idx, std::size_t action)
+{
+    Env& env = m_envs[idx];
+    Game& game = *env.game;
+    Seed(idx);
+
+    Player* player = game.GetPlayer1();
+    game.Process(player, ActionSpace::Decode(*player, action));
+    ++env.numTasks;
+
+    PlayOpponent(game);
+
+    if (game.GetTurn() != env.turn)
+    {
+        env.turn = game.GetTurn();
+        env.numTasks = 0;
+    }
+
+    if (!IsDone(game))
+    {
+        m_rewards[idx] = 0.0f;
+        m_dones[idx] = 0;
+        return;
+    }
+
+    switch (game.GetPlayer1()->playState)
+    {
+        case PlayState::WON:
+            m_rewards[idx] = 1.0f;
+            break;
+        case PlayState::LOST:
+        case PlayState::CONCEDED:
+            m_rewards[idx] = -1.0f;
+            break;
+        default:
+            m_rewards[idx] = 0.0f;
+            break;
+    }
+    m_dones[idx] = 1;
+
+    ResetEnv(idx);
+}
+
+void VecEnv::PlayOpponent(Game& game)
+{
+    while (!IsDone(game) && game.GetCurrentPlayer() == game.GetPlayer2())
+    {
+        RandomAgent::PlayTurn(game);
+    }
+}
+
+void VecEnv::UpdateEnv(std::size_t idx)
+{
+    Env& env = m_envs[idx];
+    Player* player = env.game->GetPlayer1();
+
+    env.encoder.Encode(*env.game, &m_observations[idx * OBSERVATION_SIZE]);
+
+    std::uint8_t* mask = &m_actionMasks[idx * ACTION_SIZE];
+    ActionSpace::GetActionMask(*player, mask);
+
+    // NOTE: Some tasks fail silently and don't change the state of the game,
+    // so allow only ending the turn when the agent processes too many tasks.
+    if (player->choice == nullptr &&
+        env.numTasks >= MAX_AGENT_TASKS_PER_TURN)
+    {
+        std::fill(mask, mask + ACTION_SIZE, std::uint8_t{ 0 });
+        mask[ActionSpace::END_TURN] = 1;
+    }
+}
+}  // namespace RosettaStone::PlayMode
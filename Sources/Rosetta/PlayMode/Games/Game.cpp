@@ -10,6 +10,7 @@
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Enchants/Power.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
 #include <Rosetta/PlayMode/Managers/GameManager.hpp>
 #include <Rosetta/PlayMode/Models/Enchantment.hpp>
 #include <Rosetta/PlayMode/Tasks/ITask.hpp>
@@ -24,7 +25,7 @@
 
 #include <algorithm>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 using namespace RosettaStone::PlayMode::PlayerTasks;
 
 namespace RosettaStone::PlayMode
@@ -114,23 +115,50 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
         }
     }
 
-    // Determine first player
-    switch (m_gameConfig.startPlayer)
+    DetermineFirstPlayer();
+}
+
+Game::Game(const GamePrototype& prototype)
+    : m_gameConfig(prototype.GetGame().m_gameConfig)
+{
+    Initialize();
+
+    // NOTE: The game of prototype always starts with player 1, so the first
+    // player is determined from the config of prototype.
+    m_gameConfig.startPlayer = prototype.GetGameConfig().startPlayer;
+
+    const Game& source = prototype.GetGame();
+
+    for (std::size_t i = 0; i < m_players.size(); ++i)
     {
-        case PlayerType::RANDOM:
+        Player& p = m_players[i];
+        const Player& sourcePlayer = source.m_players[i];
+
+        // Add hero and hero power
+        p.AddHeroAndPower(*sourcePlayer.GetHero());
+
+        // Set base class
+        p.baseClass = sourcePlayer.baseClass;
+
+        // Copy decks in the same order, the order is shuffled by each game
+        DeckZone& sourceDeck = *sourcePlayer.GetDeckZone();
+        for (int j = 0; j < sourceDeck.GetCount(); ++j)
         {
-            const auto val = Random::get(0, 1);
-            m_currentPlayer =
-                (val == 0) ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
-            break;
+            Playable* playable = Entity::GetFromPrototype(&p, sourceDeck[j]);
+            p.GetDeckZone()->Add(playable);
+
+            //! Set Galakrond hero card
+            if (sourceDeck[j] == sourcePlayer.galakrond)
+            {
+                p.galakrond = playable;
+            }
         }
-        default:
-            m_currentPlayer = m_gameConfig.startPlayer;
-            break;
     }
 
-    // Set first turn
-    m_turn = 1;
+    // Copies keep the entity IDs of prototype
+    m_entityID = source.m_entityID;
+
+    DetermineFirstPlayer();
 }
 
 void Game::Initialize()
@@ -833,4 +861,24 @@ std::tuple<PlayState, PlayState> Game::CheckGameOver()
 
     return { GetPlayer1()->playState, GetPlayer2()->playState };
 }
+
+void Game::DetermineFirstPlayer()
+{
+    switch (m_gameConfig.startPlayer)
+    {
+        case PlayerType::RANDOM:
+        {
+            const auto val = Random::get(0, 1);
+            m_currentPlayer =
+                (val == 0) ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
+            break;
+        }
+        default:
+            m_currentPlayer = m_gameConfig.startPlayer;
+            break;
+    }
+
+    // Set first turn
+    m_turn = 1;
+}
 }  // namespace RosettaStone::PlayMode
@@ -0,0 +1,43 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
+
+namespace RosettaStone::PlayMode
+{
+GamePrototype::GamePrototype(const GameConfig& gameConfig)
+    : m_gameConfig(gameConfig)
+{
+    // NOTE: Each game determines the first player, so the game of prototype
+    // doesn't consume a random number for it.
+    GameConfig config = gameConfig;
+    config.startPlayer = PlayerType::PLAYER1;
+
+    m_game = std::make_unique<Game>(config);
+}
+
+GamePrototype::~GamePrototype() = default;
+
+GamePrototype::GamePrototype(GamePrototype&&) noexcept = default;
+
+GamePrototype& GamePrototype::operator=(GamePrototype&&) noexcept = default;
+
+std::unique_ptr<Game> GamePrototype::CreateGame() const
+{
+    return std::make_unique<Game>(*this);
+}
+
+const GameConfig& GamePrototype::GetGameConfig() const
+{
+    return m_gameConfig;
+}
+
+const Game& GamePrototype::GetGame() const
+{
+    return *m_game;
+}
+}  // namespace RosettaStone::PlayMode
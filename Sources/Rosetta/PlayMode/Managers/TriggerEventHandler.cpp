@@ -10,7 +10,7 @@
 
 namespace RosettaStone::PlayMode
 {
-int TriggerEventHandler::counter = 0;
+std::atomic<int> TriggerEventHandler::counter = 0;
 
 TriggerEventHandler::TriggerEventHandler() : id(0)
 {
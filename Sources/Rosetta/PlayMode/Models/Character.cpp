@@ -23,6 +23,12 @@ Character::Character(Player* player, Card* card, std::map<GameTag, int> tags,
     // Do nothing
 }
 
+Character::Character(Player* player, const Character& prototype)
+    : Playable(player, prototype)
+{
+    // Do nothing
+}
+
 int Character::GetAttack() const
 {
     const int value = GetGameTag(GameTag::ATK);
@@ -17,17 +17,22 @@
 namespace RosettaStone::PlayMode
 {
 Entity::Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags, int _id)
-    : game(_game), card(_card), m_gameTags(std::move(_tags))
+    : game(_game), card(_card), m_gameTags(_card->gameTags)
 {
-    for (auto& gameTag : _card->gameTags)
-    {
-        Entity::SetGameTag(gameTag.first, gameTag.second);
-    }
+    // NOTE: Copy all tags of the card at once and add the given tags that the
+    // card doesn't have, because tags of the card take precedence over them.
+    m_gameTags.insert(_tags.begin(), _tags.end());
 
     Entity::SetGameTag(GameTag::ENTITY_ID,
                        _id < 0 ? static_cast<int>(game->GetNextID()) : _id);
 }
 
+Entity::Entity(Game* _game, const Entity& prototype)
+    : game(_game), card(prototype.card), m_gameTags(prototype.m_gameTags)
+{
+    // Do nothing
+}
+
 Entity::~Entity()
 {
     delete auraEffects;
@@ -43,6 +48,7 @@ int Entity::GetNativeGameTag(GameTag tag) const
 void Entity::SetNativeGameTag(GameTag tag, int value)
 {
     m_gameTags.insert_or_assign(tag, value);
+    ++m_numChanges;
 }
 
 std::map<GameTag, int> Entity::GetGameTags() const
@@ -87,6 +93,7 @@ int Entity::GetGameTag(GameTag tag) const
 void Entity::SetGameTag(GameTag tag, int value)
 {
     m_gameTags.insert_or_assign(tag, value);
+    ++m_numChanges;
 }
 
 int Entity::GetCardTarget() const
@@ -114,6 +121,17 @@ void Entity::Reset()
     m_gameTags.erase(GameTag::STEALTH);
     m_gameTags.erase(GameTag::SPELLBURST);
     m_gameTags.erase(GameTag::NUM_ATTACKS_THIS_TURN);
+    ++m_numChanges;
+}
+
+std::size_t Entity::GetNumChanges() const
+{
+    return m_numChanges;
+}
+
+void Entity::IncreaseNumChanges()
+{
+    ++m_numChanges;
 }
 
 Playable* Entity::GetFromCard(Player* player, Card* card,
@@ -161,4 +179,41 @@ Playable* Entity::GetFromCard(Player* player, Card* card,
 
     return result;
 }
+
+Playable* Entity::GetFromPrototype(Player* player, const Playable* prototype)
+{
+    Playable* result;
+
+    // NOTE: GetFromCard() makes the type of entity from the type of card.
+    switch (prototype->card->GetCardType())
+    {
+        case CardType::HERO:
+            result = new Hero(player, *static_cast<const Hero*>(prototype));
+            break;
+        case CardType::HERO_POWER:
+            result = new HeroPower(player,
+                                   *static_cast<const HeroPower*>(prototype));
+            break;
+        case CardType::MINION:
+            result =
+                new Minion(player, *static_cast<const Minion*>(prototype));
+            break;
+        case CardType::SPELL:
+            result = new Spell(player, *static_cast<const Spell*>(prototype));
+            break;
+        case CardType::WEAPON:
+            result =
+                new Weapon(player, *static_cast<const Weapon*>(prototype));
+            break;
+        default:
+            throw std::invalid_argument(
+                "Entity::GetFromPrototype() - Invalid card type!");
+    }
+
+    // Add entity to list
+    player->game->entityList.emplace(result->GetGameTag(GameTag::ENTITY_ID),
+                                     result);
+
+    return result;
+}
 }  // namespace RosettaStone::PlayMode
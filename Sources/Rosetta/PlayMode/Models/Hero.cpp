@@ -19,6 +19,11 @@ Hero::Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     // Do nothing
 }
 
+Hero::Hero(Player* player, const Hero& prototype) : Character(player, prototype)
+{
+    // Do nothing
+}
+
 Hero::~Hero()
 {
     delete weapon;
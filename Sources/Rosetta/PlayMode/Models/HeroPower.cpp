@@ -18,6 +18,12 @@ HeroPower::HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
     // Do nothing
 }
 
+HeroPower::HeroPower(Player* player, const HeroPower& prototype)
+    : Playable(player, prototype)
+{
+    // Do nothing
+}
+
 bool HeroPower::TargetingRequirements(Card* card, Character* target) const
 {
     return !target->GetGameTag(GameTag::CANT_BE_TARGETED_BY_HERO_POWERS) &&
@@ -22,6 +22,12 @@ Minion::Minion(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     // Do nothing
 }
 
+Minion::Minion(Player* player, const Minion& prototype)
+    : Character(player, prototype)
+{
+    // Do nothing
+}
+
 int Minion::GetLastBoardPos() const
 {
     return GetGameTag(GameTag::TAG_LAST_KNOWN_COST_IN_HAND);
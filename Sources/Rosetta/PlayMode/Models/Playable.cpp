@@ -16,7 +16,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode
 {
@@ -27,6 +27,12 @@ Playable::Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
     player = _player;
 }
 
+Playable::Playable(Player* _player, const Playable& prototype)
+    : Entity(_player->game, prototype)
+{
+    player = _player;
+}
+
 Playable::~Playable()
 {
     delete ongoingEffect;
@@ -186,6 +192,7 @@ void Playable::ResetCost()
     {
         m_gameTags.erase(iter);
     }
+    ++m_numChanges;
 
     if (const auto effect = dynamic_cast<AdaptiveCostEffect*>(ongoingEffect);
         effect != nullptr)
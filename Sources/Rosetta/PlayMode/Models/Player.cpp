@@ -150,6 +150,7 @@ int Player::GetGameTag(GameTag tag) const
 void Player::SetGameTag(GameTag tag, int value)
 {
     m_gameTags.insert_or_assign(tag, value);
+    IncreaseNumChanges();
 }
 
 int Player::GetTimeOut() const
@@ -427,4 +428,11 @@ void Player::AddHeroAndPower(Card* heroCard, Card* powerCard)
     m_hero->weapon = weapon;
     m_hero->auraEffects = auraEffects;
 }
+
+void Player::AddHeroAndPower(const Hero& hero)
+{
+    m_hero = dynamic_cast<Hero*>(GetFromPrototype(this, &hero));
+    m_hero->heroPower =
+        dynamic_cast<HeroPower*>(GetFromPrototype(this, hero.heroPower));
+}
 }  // namespace RosettaStone::PlayMode
@@ -18,6 +18,12 @@ Spell::Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     // Do nothing
 }
 
+Spell::Spell(Player* player, const Spell& prototype)
+    : Playable(player, prototype)
+{
+    // Do nothing
+}
+
 int Spell::GetQuestProgress() const
 {
     return GetGameTag(GameTag::QUEST_PROGRESS);
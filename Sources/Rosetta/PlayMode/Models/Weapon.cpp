@@ -17,6 +17,12 @@ Weapon::Weapon(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     // Do nothing
 }
 
+Weapon::Weapon(Player* player, const Weapon& prototype)
+    : Playable(player, prototype)
+{
+    // Do nothing
+}
+
 Weapon::~Weapon()
 {
     player->GetHero()->weapon = nullptr;
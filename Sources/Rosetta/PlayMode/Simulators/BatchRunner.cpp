@@ -0,0 +1,608 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Simulators/BatchRunner.hpp>
+
+#if !defined(ROSETTASTONE_WINDOWS)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// NOTE: Counters are shared between processes, so they must not rely on a
+// lock that lives in the memory of a process.
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic<JobState>::is_always_lock_free);
+
+// NOTE: A slot of worker has the number of finished games followed by the
+// number of wins, losses and ties of each matchup.
+constexpr std::size_t NUM_COUNTERS = 3;
+constexpr std::size_t WIN_IDX = 0;
+constexpr std::size_t LOSS_IDX = 1;
+constexpr std::size_t TIE_IDX = 2;
+
+constexpr char CHECKPOINT_MAGIC[8] = { 'R', 'S', 'C', 'K', 'P', 'T', '0', '1' };
+
+//! Returns the offset of the counters of \p matchup in a slot.
+constexpr std::size_t GetMatchupOffset(std::size_t matchup)
+{
+    return 1 + NUM_COUNTERS * matchup;
+}
+
+//! Converts \p playState to the state of a finished job.
+JobState ToJobState(PlayState playState)
+{
+    switch (playState)
+    {
+        case PlayState::WON:
+            return JobState::WON;
+        case PlayState::LOST:
+        case PlayState::CONCEDED:
+            return JobState::LOST;
+        default:
+            return JobState::TIED;
+    }
+}
+
+//! Converts \p state of a finished job to the play state of player 1.
+PlayState ToPlayState(JobState state)
+{
+    switch (state)
+    {
+        case JobState::WON:
+            return PlayState::WON;
+        case JobState::LOST:
+            return PlayState::LOST;
+        default:
+            return PlayState::TIED;
+    }
+}
+
+//! Mixes \p data into \p hash with FNV-1a.
+void HashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3;
+    }
+}
+
+//! Mixes \p value into \p hash with FNV-1a.
+void HashValue(std::uint64_t& hash, std::uint64_t value)
+{
+    HashBytes(hash, &value, sizeof(value));
+}
+
+//! Writes \p value to \p stream.
+void WriteValue(std::ostream& stream, std::uint64_t value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//! Reads a value from \p stream.
+std::uint64_t ReadValue(std::istream& stream)
+{
+    std::uint64_t value = 0;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+
+    return value;
+}
+}  // namespace
+
+SharedCounters::SharedCounters(std::size_t numWorkers, std::size_t numMatchups,
+                               std::size_t numJobs)
+    : m_numWorkers(numWorkers)
+{
+    const std::size_t numBytes =
+        GetMatchupOffset(numMatchups) * sizeof(std::atomic<std::uint64_t>);
+    m_slotSize = (numBytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE *
+                 CACHE_LINE_SIZE;
+    m_size = m_slotSize * numWorkers + numJobs * sizeof(std::atomic<JobState>);
+
+#if defined(ROSETTASTONE_WINDOWS)
+    m_memory = ::operator new(m_size, std::align_val_t{ CACHE_LINE_SIZE });
+#else
+    m_memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (m_memory == MAP_FAILED)
+    {
+        throw std::runtime_error(
+            "SharedCounters::SharedCounters() - Failed to map memory!");
+    }
+#endif
+
+    for (std::size_t worker = 0; worker < numWorkers; ++worker)
+    {
+        for (std::size_t i = 0; i < GetMatchupOffset(numMatchups); ++i)
+        {
+            new (&GetCounter(worker, i)) std::atomic<std::uint64_t>(0);
+        }
+    }
+
+    for (std::size_t job = 0; job < numJobs; ++job)
+    {
+        new (&GetJob(job)) std::atomic<JobState>(JobState::PENDING);
+    }
+}
+
+SharedCounters::~SharedCounters()
+{
+#if defined(ROSETTASTONE_WINDOWS)
+    ::operator delete(m_memory, std::align_val_t{ CACHE_LINE_SIZE });
+#else
+    munmap(m_memory, m_size);
+#endif
+}
+
+void SharedCounters::Add(std::size_t worker, std::size_t matchup,
+                         std::size_t job, PlayState playState)
+{
+    std::size_t offset = GetMatchupOffset(matchup);
+
+    switch (playState)
+    {
+        case PlayState::WON:
+            offset += WIN_IDX;
+            break;
+        case PlayState::LOST:
+        case PlayState::CONCEDED:
+            offset += LOSS_IDX;
+            break;
+        default:
+            offset += TIE_IDX;
+            break;
+    }
+
+    GetCounter(worker, offset).fetch_add(1, std::memory_order_relaxed);
+    GetCounter(worker, 0).fetch_add(1, std::memory_order_release);
+
+    // NOTE: A checkpoint is made from the state of jobs only, so it is
+    // always consistent even if it is written while workers are running.
+    GetJob(job).store(ToJobState(playState), std::memory_order_release);
+}
+
+std::uint64_t SharedCounters::GetNumDoneGames(std::size_t worker) const
+{
+    return GetCounter(worker, 0).load(std::memory_order_acquire);
+}
+
+MatchResult SharedCounters::GetResult(std::size_t matchup) const
+{
+    MatchResult result;
+    const std::size_t offset = GetMatchupOffset(matchup);
+
+    for (std::size_t worker = 0; worker < m_numWorkers; ++worker)
+    {
+        result.numWins += GetCounter(worker, offset + WIN_IDX)
+                              .load(std::memory_order_relaxed);
+        result.numLosses += GetCounter(worker, offset + LOSS_IDX)
+                                .load(std::memory_order_relaxed);
+        result.numTies += GetCounter(worker, offset + TIE_IDX)
+                              .load(std::memory_order_relaxed);
+    }
+
+    result.numGames = result.numWins + result.numLosses + result.numTies;
+
+    return result;
+}
+
+JobState SharedCounters::GetJobState(std::size_t job) const
+{
+    return GetJob(job).load(std::memory_order_acquire);
+}
+
+void SharedCounters::SetJobState(std::size_t job, JobState state)
+{
+    GetJob(job).store(state, std::memory_order_release);
+}
+
+std::atomic<std::uint64_t>& SharedCounters::GetCounter(
+    std::size_t worker, std::size_t offset) const
+{
+    auto* slot = static_cast<std::byte*>(m_memory) + worker * m_slotSize;
+    return reinterpret_cast<std::atomic<std::uint64_t>*>(slot)[offset];
+}
+
+std::atomic<JobState>& SharedCounters::GetJob(std::size_t job) const
+{
+    auto* jobs = static_cast<std::byte*>(m_memory) + m_numWorkers * m_slotSize;
+    return reinterpret_cast<std::atomic<JobState>*>(jobs)[job];
+}
+
+BatchRunner::BatchRunner(std::vector<Matchup> matchups, FormatType formatType,
+                         BatchConfig config)
+    : m_matchups(std::move(matchups)),
+      m_formatType(formatType),
+      m_config(std::move(config)),
+      m_resumedResults(m_matchups.size())
+{
+    if (m_config.numProcesses == 0)
+    {
+        throw std::invalid_argument(
+            "BatchRunner::BatchRunner() - The number of processes must be "
+            "positive!");
+    }
+
+    // NOTE: Prototypes are made before forking workers, so the cards they
+    // point to are shared by all workers with copy-on-write pages.
+    m_prototypes.reserve(m_matchups.size());
+    for (const auto& [deck1, deck2] : m_matchups)
+    {
+        m_prototypes.emplace_back(
+            MatchSimulator::MakeGameConfig(deck1, deck2, formatType));
+    }
+
+    m_counters = std::make_unique<SharedCounters>(
+        m_config.numProcesses, m_matchups.size(),
+        m_config.numGames * m_matchups.size());
+}
+
+bool BatchRunner::Resume()
+{
+    std::ifstream fileInput(m_config.checkpointPath, std::ios::binary);
+    if (!fileInput.is_open())
+    {
+        std::cerr << "Failed to open checkpoint " << m_config.checkpointPath
+                  << '\n';
+        return false;
+    }
+
+    char magic[sizeof(CHECKPOINT_MAGIC)] = {};
+    fileInput.read(magic, sizeof(magic));
+    const std::uint64_t fingerprint = ReadValue(fileInput);
+    const std::uint64_t numJobs = ReadValue(fileInput);
+
+    if (std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 ||
+        fingerprint != GetFingerprint() ||
+        numJobs != m_config.numGames * m_matchups.size())
+    {
+        std::cerr << "Checkpoint doesn't match matchups and options\n";
+        return false;
+    }
+
+    std::vector<MatchResult> results(m_matchups.size());
+    for (auto& result : results)
+    {
+        result.numWins = ReadValue(fileInput);
+        result.numLosses = ReadValue(fileInput);
+        result.numTies = ReadValue(fileInput);
+        result.numGames = result.numWins + result.numLosses + result.numTies;
+    }
+
+    std::vector<std::uint64_t> bitmap((numJobs + 63) / 64);
+    for (auto& word : bitmap)
+    {
+        word = ReadValue(fileInput);
+    }
+
+    if (!fileInput)
+    {
+        std::cerr << "Checkpoint is truncated\n";
+        return false;
+    }
+
+    m_resumedResults = std::move(results);
+    for (std::size_t job = 0; job < numJobs; ++job)
+    {
+        if (bitmap[job / 64] & (std::uint64_t{ 1 } << (job % 64)))
+        {
+            m_counters->SetJobState(job, JobState::RESUMED);
+        }
+    }
+
+    return true;
+}
+
+bool BatchRunner::Run()
+{
+    const std::size_t numWorkers = m_config.numProcesses;
+    const std::size_t numJobs = m_config.numGames * m_matchups.size();
+
+#if defined(ROSETTASTONE_WINDOWS)
+    if (numWorkers > 1)
+    {
+        std::cerr << "Multiple processes are not supported on this platform\n";
+        return false;
+    }
+#endif
+
+    std::vector<std::size_t> pendingJobs;
+    for (std::size_t job = 0; job < numJobs; ++job)
+    {
+        if (m_counters->GetJobState(job) == JobState::PENDING)
+        {
+            pendingJobs.emplace_back(job);
+        }
+    }
+
+    const std::size_t numResumedJobs = numJobs - pendingJobs.size();
+    if (m_config.maxGamesPerRun > 0 &&
+        pendingJobs.size() > m_config.maxGamesPerRun)
+    {
+        pendingJobs.resize(m_config.maxGamesPerRun);
+    }
+
+    std::atomic<bool> isFailed = false;
+    std::atomic<bool> isFinished = false;
+    std::size_t numRunningWorkers = 0;
+    std::thread thread;
+
+    if (numWorkers == 1)
+    {
+        // NOTE: The launcher plays jobs in another thread to write
+        // checkpoints while playing.
+        numRunningWorkers = 1;
+        thread = std::thread([&]() {
+            try
+            {
+                RunWorker(0, pendingJobs);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Worker 0 failed: " << e.what() << '\n';
+                isFailed = true;
+            }
+
+            isFinished = true;
+        });
+    }
+
+#if !defined(ROSETTASTONE_WINDOWS)
+    std::vector<pid_t> pids(numWorkers, -1);
+
+    if (numWorkers > 1)
+    {
+        // NOTE: Buffered output would be written again by every worker.
+        std::cout.flush();
+        std::cerr.flush();
+
+        for (std::size_t worker = 0; worker < numWorkers; ++worker)
+        {
+            const pid_t pid = fork();
+
+            if (pid == 0)
+            {
+                int exitCode = EXIT_SUCCESS;
+
+                try
+                {
+                    RunWorker(worker, pendingJobs);
+                }
+                catch (const std::exception& e)
+                {
+                    std::cerr << "Worker " << worker
+                              << " failed: " << e.what() << '\n';
+                    exitCode = EXIT_FAILURE;
+                }
+
+                // NOTE: Skip destructors of objects owned by the launcher.
+                std::cerr.flush();
+                _exit(exitCode);
+            }
+
+            if (pid < 0)
+            {
+                std::cerr << "Failed to fork worker " << worker << '\n';
+                isFailed = true;
+                break;
+            }
+
+            pids[worker] = pid;
+            ++numRunningWorkers;
+        }
+    }
+#endif
+
+    auto lastCheckpointTime = std::chrono::steady_clock::now();
+
+    while (numRunningWorkers > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+
+        if (numWorkers == 1 && isFinished)
+        {
+            --numRunningWorkers;
+        }
+
+#if !defined(ROSETTASTONE_WINDOWS)
+        for (std::size_t worker = 0; worker < numWorkers; ++worker)
+        {
+            int status = 0;
+            if (pids[worker] <= 0 || waitpid(pids[worker], &status, WNOHANG) !=
+                                         pids[worker])
+            {
+                continue;
+            }
+
+            pids[worker] = -1;
+            --numRunningWorkers;
+
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+            {
+                std::cerr << "Worker " << worker << " terminated abnormally\n";
+                isFailed = true;
+            }
+        }
+#endif
+
+        std::uint64_t numDoneGames = numResumedJobs;
+        for (std::size_t worker = 0; worker < numWorkers; ++worker)
+        {
+            numDoneGames += m_counters->GetNumDoneGames(worker);
+        }
+
+        std::cerr << "Progress: " << numDoneGames << " / " << numJobs
+                  << " games\n";
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!m_config.checkpointPath.empty() &&
+            now - lastCheckpointTime >=
+                std::chrono::seconds(m_config.checkpointInterval))
+        {
+            WriteCheckpoint();
+            lastCheckpointTime = now;
+        }
+    }
+
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+
+    if (!m_config.checkpointPath.empty())
+    {
+        WriteCheckpoint();
+    }
+
+    return !isFailed;
+}
+
+MatchResult BatchRunner::GetResult(std::size_t matchup) const
+{
+    MatchResult result = m_resumedResults[matchup];
+    result += m_counters->GetResult(matchup);
+
+    return result;
+}
+
+const std::vector<BatchRunner::Matchup>& BatchRunner::GetMatchups() const
+{
+    return m_matchups;
+}
+
+const SharedCounters& BatchRunner::GetCounters() const
+{
+    return *m_counters;
+}
+
+void BatchRunner::RunWorker(std::size_t worker,
+                            const std::vector<std::size_t>& pendingJobs) const
+{
+    // NOTE: Pending job i goes to worker (i % the number of workers).
+    const std::size_t numWorkers = m_config.numProcesses;
+    const std::size_t numShardJobs =
+        worker < pendingJobs.size()
+            ? (pendingJobs.size() - worker - 1) / numWorkers + 1
+            : 0;
+
+    ThreadPool pool(m_config.numThreads);
+    pool.ParallelFor(numShardJobs, [&](std::size_t idx) {
+        const std::size_t job = pendingJobs[worker + idx * numWorkers];
+        const std::size_t matchup = job / m_config.numGames;
+
+        const PlayState playState = MatchSimulator::PlayGame(
+            m_prototypes[matchup], m_config.seed, job);
+        m_counters->Add(worker, matchup, job, playState);
+    });
+}
+
+void BatchRunner::WriteCheckpoint() const
+{
+    const std::size_t numJobs = m_config.numGames * m_matchups.size();
+
+    std::vector<std::uint64_t> bitmap((numJobs + 63) / 64, 0);
+    std::vector<MatchResult> results = m_resumedResults;
+
+    for (std::size_t job = 0; job < numJobs; ++job)
+    {
+        const JobState state = m_counters->GetJobState(job);
+        if (state == JobState::PENDING)
+        {
+            continue;
+        }
+
+        bitmap[job / 64] |= std::uint64_t{ 1 } << (job % 64);
+        if (state != JobState::RESUMED)
+        {
+            results[job / m_config.numGames].Add(ToPlayState(state));
+        }
+    }
+
+    // NOTE: Write to a temporary file first, so a checkpoint is never
+    // corrupted even if the process dies while writing it.
+    const std::string tempPath = m_config.checkpointPath + ".tmp";
+    {
+        std::ofstream fileOutput(tempPath, std::ios::binary | std::ios::trunc);
+        fileOutput.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+        WriteValue(fileOutput, GetFingerprint());
+        WriteValue(fileOutput, numJobs);
+
+        for (const auto& result : results)
+        {
+            WriteValue(fileOutput, result.numWins);
+            WriteValue(fileOutput, result.numLosses);
+            WriteValue(fileOutput, result.numTies);
+        }
+
+        for (const auto word : bitmap)
+        {
+            WriteValue(fileOutput, word);
+        }
+
+        if (!fileOutput)
+        {
+            std::cerr << "Failed to write checkpoint " << tempPath << '\n';
+            return;
+        }
+    }
+
+#if defined(ROSETTASTONE_WINDOWS)
+    // NOTE: std::rename() fails on Windows if the destination exists.
+    std::remove(m_config.checkpointPath.c_str());
+#endif
+    if (std::rename(tempPath.c_str(), m_config.checkpointPath.c_str()) != 0)
+    {
+        std::cerr << "Failed to write checkpoint " << m_config.checkpointPath
+                  << '\n';
+    }
+}
+
+std::uint64_t BatchRunner::GetFingerprint() const
+{
+    std::uint64_t hash = 0xcbf29ce484222325;
+
+    HashValue(hash, m_config.seed);
+    HashValue(hash, m_config.numGames);
+    HashValue(hash, static_cast<std::uint64_t>(m_formatType));
+
+    for (const auto& [deck1, deck2] : m_matchups)
+    {
+        for (const DeckInfo* deck : { &deck1, &deck2 })
+        {
+            HashValue(hash, static_cast<std::uint64_t>(deck->GetClass()));
+
+            for (std::size_t i = 0; i < deck->GetUniqueNumOfCards(); ++i)
+            {
+                const auto [cardID, numCards] = deck->GetCard(i);
+                HashBytes(hash, cardID.data(), cardID.size());
+                HashValue(hash, numCards);
+            }
+        }
+    }
+
+    return hash;
+}
+}  // namespace RosettaStone::PlayMode
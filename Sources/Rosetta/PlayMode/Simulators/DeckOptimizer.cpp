@@ -0,0 +1,350 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Simulators/DeckOptimizer.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Checks \p card can be put into a deck of \p deckClass and \p formatType.
+bool IsCandidateCard(const Card* card, CardClass deckClass,
+                     FormatType formatType)
+{
+    if (!card->IsCollectible() || card->GetCardType() == CardType::HERO)
+    {
+        return false;
+    }
+
+    if (formatType == FormatType::STANDARD && !card->IsStandardSet())
+    {
+        return false;
+    }
+
+    const CardClass cardClass = card->GetCardClass();
+    return cardClass == deckClass || cardClass == CardClass::NEUTRAL;
+}
+}  // namespace
+
+DeckOptimizer::DeckOptimizer(ThreadPool& pool, DeckOptimizerConfig config)
+    : m_pool(pool), m_config(std::move(config)), m_generator(m_config.seed)
+{
+    if (m_config.gauntlet.empty())
+    {
+        throw std::invalid_argument(
+            "DeckOptimizer::DeckOptimizer() - Gauntlet is empty!");
+    }
+
+    if (m_config.populationSize == 0 ||
+        m_config.numEliteDecks > m_config.populationSize)
+    {
+        throw std::invalid_argument(
+            "DeckOptimizer::DeckOptimizer() - Invalid population size!");
+    }
+}
+
+std::vector<DeckOptimizer::ScoredDeck> DeckOptimizer::Run(
+    const DeckInfo& seedDeck)
+{
+    m_deckClass = seedDeck.GetClass();
+
+    m_candidateCards.clear();
+    for (Card* card : Cards::GetAllCards())
+    {
+        if (IsCandidateCard(card, m_deckClass, m_config.formatType))
+        {
+            m_candidateCards.emplace_back(card);
+        }
+    }
+
+    if (m_candidateCards.empty())
+    {
+        throw std::invalid_argument(
+            "DeckOptimizer::Run() - There are no cards for the deck class!");
+    }
+
+    // NOTE: Cards of the seed deck that can't be put into the deck and excess
+    // copies are dropped, so every deck of the search is legal.
+    DeckInfo firstDeck(seedDeck.GetName(), m_deckClass);
+    for (const auto& cardID : seedDeck.GetCardIDs())
+    {
+        if (firstDeck.GetNumOfCards() == START_DECK_SIZE)
+        {
+            break;
+        }
+
+        const Card* card = Cards::FindCardByID(cardID);
+        if (IsCandidateCard(card, m_deckClass, m_config.formatType))
+        {
+            firstDeck.AddCard(cardID, 1);
+        }
+    }
+
+    FillDeck(firstDeck);
+
+    std::vector<DeckInfo> population;
+    population.reserve(m_config.populationSize);
+    population.emplace_back(firstDeck);
+    while (population.size() < m_config.populationSize)
+    {
+        population.emplace_back(Mutate(firstDeck));
+    }
+
+    std::vector<ScoredDeck> scoredDecks;
+
+    for (std::size_t generation = 0;; ++generation)
+    {
+        for (const auto& deck : population)
+        {
+            if (!IsValidDeck(deck))
+            {
+                throw std::logic_error(
+                    "DeckOptimizer::Run() - Invalid deck is made!");
+            }
+        }
+
+        const auto scores = Evaluate(population);
+
+        scoredDecks.clear();
+        for (std::size_t i = 0; i < population.size(); ++i)
+        {
+            scoredDecks.emplace_back(population[i], scores[i]);
+        }
+
+        std::stable_sort(scoredDecks.begin(), scoredDecks.end(),
+                         [](const ScoredDeck& lhs, const ScoredDeck& rhs) {
+                             return lhs.second > rhs.second;
+                         });
+
+        if (generation + 1 >= m_config.numGenerations)
+        {
+            break;
+        }
+
+        // Keep elite decks and make the rest by crossover and mutation
+        population.clear();
+        for (std::size_t i = 0; i < m_config.numEliteDecks; ++i)
+        {
+            population.emplace_back(scoredDecks[i].first);
+        }
+
+        // NOTE: Parents are selected by binary tournament.
+        std::uniform_int_distribution<std::size_t> dist(
+            0, scoredDecks.size() - 1);
+        const auto SelectParent = [&]() -> const DeckInfo& {
+            const std::size_t idx1 = dist(m_generator);
+            const std::size_t idx2 = dist(m_generator);
+            return scoredDecks[std::min(idx1, idx2)].first;
+        };
+
+        while (population.size() < m_config.populationSize)
+        {
+            const DeckInfo& parent1 = SelectParent();
+            const DeckInfo& parent2 = SelectParent();
+            population.emplace_back(Mutate(Crossover(parent1, parent2)));
+        }
+    }
+
+    return scoredDecks;
+}
+
+double DeckOptimizer::Evaluate(const DeckInfo& deck)
+{
+    return Evaluate(std::vector<DeckInfo>{ deck })[0];
+}
+
+bool DeckOptimizer::IsValidDeck(const DeckInfo& deck) const
+{
+    if (deck.GetNumOfCards() != START_DECK_SIZE)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < deck.GetUniqueNumOfCards(); ++i)
+    {
+        const auto [cardID, numCards] = deck.GetCard(i);
+        const Card* card = Cards::FindCardByID(cardID);
+
+        if (!IsCandidateCard(card, deck.GetClass(), m_config.formatType) ||
+            numCards > card->GetMaxAllowedInDeck())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t DeckOptimizer::GetNumEvaluatedDecks() const
+{
+    return m_scoreCache.size();
+}
+
+std::size_t DeckOptimizer::GetNumCacheHits() const
+{
+    return m_numCacheHits;
+}
+
+std::vector<std::string> DeckOptimizer::GetDeckKey(const DeckInfo& deck)
+{
+    auto key = deck.GetCardIDs();
+    std::sort(key.begin(), key.end());
+
+    return key;
+}
+
+std::vector<double> DeckOptimizer::Evaluate(const std::vector<DeckInfo>& decks)
+{
+    std::vector<double> scores(decks.size(), 0.0);
+
+    // Collect decks that are not cached
+    std::vector<std::size_t> deckIndices;
+    std::map<std::vector<std::string>, std::size_t> pendingDecks;
+    std::vector<std::vector<std::string>> keys;
+
+    for (std::size_t i = 0; i < decks.size(); ++i)
+    {
+        auto key = GetDeckKey(decks[i]);
+
+        if (const auto iter = m_scoreCache.find(key);
+            iter != m_scoreCache.end())
+        {
+            scores[i] = iter->second;
+            ++m_numCacheHits;
+        }
+        else if (pendingDecks.find(key) == pendingDecks.end())
+        {
+            pendingDecks.emplace(key, deckIndices.size());
+            deckIndices.emplace_back(i);
+            keys.emplace_back(std::move(key));
+        }
+    }
+
+    if (!deckIndices.empty())
+    {
+        const std::size_t numOpponents = m_config.gauntlet.size();
+        const std::size_t numGames = m_config.numGamesPerOpponent;
+
+        std::vector<std::unique_ptr<GamePrototype>> prototypes;
+        prototypes.reserve(deckIndices.size() * numOpponents);
+        for (const std::size_t deckIdx : deckIndices)
+        {
+            for (const auto& opponent : m_config.gauntlet)
+            {
+                prototypes.emplace_back(std::make_unique<GamePrototype>(
+                    MatchSimulator::MakeGameConfig(
+                        decks[deckIdx], opponent, m_config.formatType)));
+            }
+        }
+
+        // NOTE: Every deck plays the game with the same random stream
+        // against the same opponent (common random numbers), so the
+        // difference of scores comes from the decks rather than luck.
+        std::vector<PlayState> playStates(prototypes.size() * numGames);
+        m_pool.ParallelFor(playStates.size(), [&](std::size_t idx) {
+            const std::size_t protoIdx = idx / numGames;
+            const std::size_t opponentIdx = protoIdx % numOpponents;
+            const std::size_t gameIdx = idx % numGames;
+
+            playStates[idx] = MatchSimulator::PlayGame(
+                *prototypes[protoIdx], m_config.seed,
+                opponentIdx * numGames + gameIdx);
+        });
+
+        for (std::size_t i = 0; i < deckIndices.size(); ++i)
+        {
+            double totalWinRate = 0.0;
+
+            for (std::size_t j = 0; j < numOpponents; ++j)
+            {
+                MatchResult result;
+                const std::size_t begin = (i * numOpponents + j) * numGames;
+                for (std::size_t k = 0; k < numGames; ++k)
+                {
+                    result.Add(playStates[begin + k]);
+                }
+
+                totalWinRate += result.GetWinRate();
+            }
+
+            m_scoreCache.emplace(keys[i], totalWinRate / numOpponents);
+        }
+
+        for (std::size_t i = 0; i < decks.size(); ++i)
+        {
+            scores[i] = m_scoreCache.at(GetDeckKey(decks[i]));
+        }
+    }
+
+    return scores;
+}
+
+void DeckOptimizer::FillDeck(DeckInfo& deck)
+{
+    std::uniform_int_distribution<std::size_t> dist(
+        0, m_candidateCards.size() - 1);
+
+    while (deck.GetNumOfCards() < START_DECK_SIZE)
+    {
+        const Card* card = m_candidateCards[dist(m_generator)];
+        deck.AddCard(card->id, 1);
+    }
+}
+
+DeckInfo DeckOptimizer::Mutate(const DeckInfo& deck)
+{
+    DeckInfo result = deck;
+
+    for (std::size_t i = 0; i < m_config.numMutations; ++i)
+    {
+        const auto cardIDs = result.GetCardIDs();
+        if (cardIDs.empty())
+        {
+            break;
+        }
+
+        std::uniform_int_distribution<std::size_t> dist(0,
+                                                        cardIDs.size() - 1);
+        result.DeleteCard(cardIDs[dist(m_generator)], 1);
+    }
+
+    FillDeck(result);
+
+    return result;
+}
+
+DeckInfo DeckOptimizer::Crossover(const DeckInfo& deck1, const DeckInfo& deck2)
+{
+    auto cardIDs = deck1.GetCardIDs();
+    const auto cardIDs2 = deck2.GetCardIDs();
+    cardIDs.insert(cardIDs.end(), cardIDs2.begin(), cardIDs2.end());
+    std::shuffle(cardIDs.begin(), cardIDs.end(), m_generator);
+
+    // NOTE: DeckInfo::AddCard() rejects a card that exceeds the number of
+    // copies allowed by Card::GetMaxAllowedInDeck().
+    DeckInfo result(deck1.GetName(), deck1.GetClass());
+    for (const auto& cardID : cardIDs)
+    {
+        if (result.GetNumOfCards() == START_DECK_SIZE)
+        {
+            break;
+        }
+
+        result.AddCard(cardID, 1);
+    }
+
+    FillDeck(result);
+
+    return result;
+}
+}  // namespace RosettaStone::PlayMode
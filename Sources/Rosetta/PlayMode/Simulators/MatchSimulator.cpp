@@ -0,0 +1,109 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+void MatchResult::Add(PlayState playState)
+{
+    ++numGames;
+
+    switch (playState)
+    {
+        case PlayState::WON:
+            ++numWins;
+            break;
+        case PlayState::LOST:
+        case PlayState::CONCEDED:
+            ++numLosses;
+            break;
+        default:
+            ++numTies;
+            break;
+    }
+}
+
+MatchResult& MatchResult::operator+=(const MatchResult& rhs)
+{
+    numGames += rhs.numGames;
+    numWins += rhs.numWins;
+    numLosses += rhs.numLosses;
+    numTies += rhs.numTies;
+
+    return *this;
+}
+
+double MatchResult::GetWinRate() const
+{
+    if (numGames == 0)
+    {
+        return 0.0;
+    }
+
+    return (static_cast<double>(numWins) + 0.5 * numTies) / numGames;
+}
+
+GameConfig MatchSimulator::MakeGameConfig(const DeckInfo& deck1,
+                                          const DeckInfo& deck2,
+                                          FormatType formatType)
+{
+    GameConfig config;
+    config.formatType = formatType;
+    config.player1Class = deck1.GetClass();
+    config.player2Class = deck2.GetClass();
+    config.startPlayer = PlayerType::RANDOM;
+    config.doShuffle = true;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    const auto cards1 = deck1.GetPrimitiveDeck();
+    const auto cards2 = deck2.GetPrimitiveDeck();
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        config.player1Deck[i] = i < cards1.size() ? cards1[i] : nullptr;
+        config.player2Deck[i] = i < cards2.size() ? cards2[i] : nullptr;
+    }
+
+    return config;
+}
+
+PlayState MatchSimulator::PlayGame(const GamePrototype& prototype,
+                                   std::uint64_t seed, std::uint64_t idx)
+{
+    SeedRandom(seed, idx);
+
+    const auto game = prototype.CreateGame();
+    return RandomAgent::PlayGame(*game);
+}
+
+MatchResult MatchSimulator::Run(ThreadPool& pool, const GameConfig& config,
+                                std::size_t numGames, std::uint64_t seed)
+{
+    GameConfig gameConfig = config;
+    gameConfig.autoRun = true;
+
+    const GamePrototype prototype(gameConfig);
+    std::vector<PlayState> playStates(numGames, PlayState::INVALID);
+
+    pool.ParallelFor(numGames, [&](std::size_t idx) {
+        playStates[idx] = PlayGame(prototype, seed, idx);
+    });
+
+    MatchResult result;
+    for (const auto playState : playStates)
+    {
+        result.Add(playState);
+    }
+
+    return result;
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,157 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Simulators/MulliganEvaluator.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/ChooseTask.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace RosettaStone::PlayMode::PlayerTasks;
+
+namespace RosettaStone::PlayMode
+{
+MulliganEvaluator::MulliganEvaluator(ThreadPool& pool, DeckInfo deck,
+                                     DeckInfo opponent, FormatType formatType)
+    : m_pool(pool),
+      m_deck(std::move(deck)),
+      m_opponent(std::move(opponent)),
+      m_formatType(formatType)
+{
+    // Do nothing
+}
+
+std::vector<MulliganResult> MulliganEvaluator::Run(
+    const std::vector<std::string>& openingHand, bool isFirstPlayer,
+    std::size_t numGames, std::uint64_t seed) const
+{
+    const std::size_t numHandCards = isFirstPlayer ? 3 : 4;
+    if (openingHand.size() != numHandCards)
+    {
+        throw std::invalid_argument(
+            "MulliganEvaluator::Run() - Invalid number of cards in hand!");
+    }
+
+    // Checks the deck has all cards of the opening hand
+    DeckInfo restDeck = m_deck;
+    for (const auto& cardID : openingHand)
+    {
+        if (!restDeck.DeleteCard(cardID, 1))
+        {
+            throw std::invalid_argument(
+                "MulliganEvaluator::Run() - The deck doesn't have " + cardID);
+        }
+    }
+
+    // NOTE: Bit i of the subset indicates the player keeps i-th card.
+    const std::size_t numSubsets = std::size_t{ 1 } << numHandCards;
+    std::vector<PlayState> playStates(numSubsets * numGames,
+                                      PlayState::INVALID);
+
+    m_pool.ParallelFor(playStates.size(), [&](std::size_t idx) {
+        const std::size_t subset = idx / numGames;
+        const std::size_t gameIdx = idx % numGames;
+
+        SeedRandom(seed, gameIdx);
+
+        Game game(MakeGameConfig(openingHand, isFirstPlayer));
+        game.Start();
+
+        Player* player = game.GetPlayer1();
+        const auto hand = player->GetHandZone()->GetAll();
+
+        std::vector<int> keepIDs;
+        for (std::size_t i = 0; i < numHandCards; ++i)
+        {
+            if (subset & (std::size_t{ 1 } << i))
+            {
+                keepIDs.emplace_back(hand[i]->GetGameTag(GameTag::ENTITY_ID));
+            }
+        }
+
+        game.Process(player, ChooseTask::Mulligan(player, keepIDs));
+        playStates[idx] = RandomAgent::PlayGame(game);
+    });
+
+    std::vector<MulliganResult> results(numSubsets);
+    for (std::size_t subset = 0; subset < numSubsets; ++subset)
+    {
+        MulliganResult& result = results[subset];
+
+        for (std::size_t i = 0; i < numHandCards; ++i)
+        {
+            if (subset & (std::size_t{ 1 } << i))
+            {
+                result.keptCardIDs.emplace_back(openingHand[i]);
+            }
+            else
+            {
+                result.replacedCardIDs.emplace_back(openingHand[i]);
+            }
+        }
+
+        for (std::size_t i = 0; i < numGames; ++i)
+        {
+            result.result.Add(playStates[subset * numGames + i]);
+        }
+    }
+
+    std::stable_sort(results.begin(), results.end(),
+                     [](const MulliganResult& lhs, const MulliganResult& rhs) {
+                         return lhs.result.GetWinRate() >
+                                rhs.result.GetWinRate();
+                     });
+
+    return results;
+}
+
+GameConfig MulliganEvaluator::MakeGameConfig(
+    const std::vector<std::string>& openingHand, bool isFirstPlayer) const
+{
+    GameConfig config =
+        MatchSimulator::MakeGameConfig(m_deck, m_opponent, m_formatType);
+    config.startPlayer =
+        isFirstPlayer ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
+    config.skipMulligan = false;
+
+    // NOTE: The first card of the deck is drawn first if decks are not
+    // shuffled by the game.
+    config.doShuffle = false;
+
+    auto cards = m_deck.GetPrimitiveDeck();
+    std::vector<Card*> deckCards;
+    deckCards.reserve(START_DECK_SIZE);
+
+    for (const auto& cardID : openingHand)
+    {
+        const auto iter =
+            std::find_if(cards.begin(), cards.end(),
+                         [&](const Card* card) { return card->id == cardID; });
+        deckCards.emplace_back(*iter);
+        cards.erase(iter);
+    }
+
+    Random::shuffle(cards.begin(), cards.end());
+    deckCards.insert(deckCards.end(), cards.begin(), cards.end());
+
+    auto opponentCards = m_opponent.GetPrimitiveDeck();
+    Random::shuffle(opponentCards.begin(), opponentCards.end());
+
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        config.player1Deck[i] = i < deckCards.size() ? deckCards[i] : nullptr;
+        config.player2Deck[i] =
+            i < opponentCards.size() ? opponentCards[i] : nullptr;
+    }
+
+    return config;
+}
+}  // namespace RosettaStone::PlayMode
@@ -9,10 +9,189 @@
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Utils/DeckCode.hpp>
 
+#include <algorithm>
+#include <map>
 #include <stdexcept>
 
 namespace RosettaStone::PlayMode
 {
+namespace
+{
+//! The number of rows that a job of batch functions processes.
+constexpr std::size_t ROWS_PER_JOB = 256;
+
+//! Returns true if \p src is a padded Base64 based string.
+bool IsValidBase64(std::string_view src)
+{
+    if (src.empty() || src.size() % 4 != 0)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+        const char ch = src[i];
+        if (ch == '=')
+        {
+            // NOTE: Padding is allowed only at the last two characters.
+            if (i + 2 < src.size() ||
+                (i + 2 == src.size() && src.back() != '='))
+            {
+                return false;
+            }
+        }
+        else if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+                   (ch >= '0' && ch <= '9') || ch == '+' || ch == '/'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//! Parses \p deckCode into the outputs of DeckCode::DecodeRow().
+DeckCodeError ParseRow(std::string_view deckCode, std::int32_t& hero,
+                       std::int32_t& format, std::int32_t* dbfIDs,
+                       std::int32_t* counts)
+{
+    if (!IsValidBase64(deckCode))
+    {
+        return DeckCodeError::INVALID_BASE64;
+    }
+
+    const std::vector<unsigned char> code = DecodeBase64(deckCode);
+    std::size_t pos = 0;
+
+    const auto readVarint = [&](int& result) {
+        unsigned int bits = 0;
+        int shift = 0;
+
+        while (pos < code.size() && shift < 32)
+        {
+            const unsigned int ch = code[pos];
+            ++pos;
+
+            bits |= (ch & 0x7f) << shift;
+            shift += 7;
+
+            if ((ch & 0x80) == 0)
+            {
+                result = static_cast<int>(bits);
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    if (code.empty() || code[pos] != '\0')
+    {
+        return DeckCodeError::INVALID_DECK_CODE;
+    }
+    ++pos;
+
+    int value = 0;
+    if (!readVarint(value))
+    {
+        return DeckCodeError::UNEXPECTED_EOF;
+    }
+    if (value != DECK_CODE_VERSION)
+    {
+        return DeckCodeError::VERSION_MISMATCH;
+    }
+
+    if (!readVarint(format))
+    {
+        return DeckCodeError::UNEXPECTED_EOF;
+    }
+    if (format != static_cast<int>(FormatType::STANDARD) &&
+        format != static_cast<int>(FormatType::WILD))
+    {
+        return DeckCodeError::INVALID_FORMAT;
+    }
+
+    if (!readVarint(value))
+    {
+        return DeckCodeError::UNEXPECTED_EOF;
+    }
+    if (value != 1)
+    {
+        return DeckCodeError::INVALID_HERO_COUNT;
+    }
+
+    if (!readVarint(hero))
+    {
+        return DeckCodeError::UNEXPECTED_EOF;
+    }
+    const Card* heroCard = Cards::FindCardByDbfID(hero);
+    if (heroCard->id.empty() ||
+        heroCard->GetCardClass() == CardClass::INVALID)
+    {
+        return DeckCodeError::INVALID_HERO;
+    }
+
+    // Single-copy, 2-copy and n-copy cards
+    std::size_t numCards = 0;
+    for (int copies = 1; copies <= 3; ++copies)
+    {
+        int num = 0;
+        if (!readVarint(num))
+        {
+            return DeckCodeError::UNEXPECTED_EOF;
+        }
+
+        for (int i = 0; i < num; ++i)
+        {
+            int dbfID = 0, count = copies;
+            if (!readVarint(dbfID) || (copies == 3 && !readVarint(count)))
+            {
+                return DeckCodeError::UNEXPECTED_EOF;
+            }
+            if (count < 1 || Cards::FindCardByDbfID(dbfID)->id.empty())
+            {
+                return DeckCodeError::INVALID_CARD;
+            }
+            if (numCards == DeckCodeBatch::MAX_CARDS)
+            {
+                return DeckCodeError::TOO_MANY_CARDS;
+            }
+
+            dbfIDs[numCards] = dbfID;
+            counts[numCards] = count;
+            ++numCards;
+        }
+    }
+
+    return DeckCodeError::NONE;
+}
+
+//! Writes \p value as a varint into \p code.
+void WriteVarint(std::vector<unsigned char>& code, int value)
+{
+    auto bits = static_cast<unsigned int>(value);
+
+    while (bits >= 0x80)
+    {
+        code.emplace_back(static_cast<unsigned char>((bits & 0x7f) | 0x80));
+        bits >>= 7;
+    }
+
+    code.emplace_back(static_cast<unsigned char>(bits));
+}
+}  // namespace
+
+DeckCodeBatch::DeckCodeBatch(std::size_t _size)
+    : size(_size),
+      heroes(_size, 0),
+      formats(_size, 0),
+      errors(_size, 0),
+      dbfIDs(_size * MAX_CARDS, 0),
+      counts(_size * MAX_CARDS, 0)
+{
+    // Do nothing
+}
+
 DeckInfo DeckCode::Decode(std::string_view deckCode)
 {
     std::size_t pos = 0;
@@ -99,4 +278,130 @@ DeckInfo DeckCode::Decode(std::string_view deckCode)
 
     return deckInfo;
 }
+
+DeckCodeError DeckCode::DecodeRow(std::string_view deckCode,
+                                  std::int32_t& hero, std::int32_t& format,
+                                  std::int32_t* dbfIDs, std::int32_t* counts)
+{
+    hero = 0;
+    format = 0;
+    std::fill(dbfIDs, dbfIDs + DeckCodeBatch::MAX_CARDS, 0);
+    std::fill(counts, counts + DeckCodeBatch::MAX_CARDS, 0);
+
+    const DeckCodeError error =
+        ParseRow(deckCode, hero, format, dbfIDs, counts);
+    if (error != DeckCodeError::NONE)
+    {
+        hero = 0;
+        format = 0;
+        std::fill(dbfIDs, dbfIDs + DeckCodeBatch::MAX_CARDS, 0);
+        std::fill(counts, counts + DeckCodeBatch::MAX_CARDS, 0);
+    }
+
+    return error;
+}
+
+DeckCodeBatch DeckCode::DecodeBatch(
+    ThreadPool& pool, const std::vector<std::string_view>& deckCodes)
+{
+    constexpr std::size_t MAX_CARDS = DeckCodeBatch::MAX_CARDS;
+
+    DeckCodeBatch batch(deckCodes.size());
+    const std::size_t numJobs =
+        (batch.size + ROWS_PER_JOB - 1) / ROWS_PER_JOB;
+
+    pool.ParallelFor(numJobs, [&](std::size_t job) {
+        const std::size_t end =
+            std::min(batch.size, (job + 1) * ROWS_PER_JOB);
+
+        for (std::size_t i = job * ROWS_PER_JOB; i < end; ++i)
+        {
+            batch.errors[i] = static_cast<std::int32_t>(DecodeRow(
+                deckCodes[i], batch.heroes[i], batch.formats[i],
+                batch.dbfIDs.data() + i * MAX_CARDS,
+                batch.counts.data() + i * MAX_CARDS));
+        }
+    });
+
+    return batch;
+}
+
+std::string DeckCode::Encode(int hero, FormatType format,
+                             const std::int32_t* dbfIDs,
+                             const std::int32_t* counts, std::size_t numCards)
+{
+    // NOTE: Hearthstone sorts cards by dbfID in each group.
+    std::map<int, int> cards;
+    for (std::size_t i = 0; i < numCards; ++i)
+    {
+        if (dbfIDs[i] != 0 && counts[i] > 0)
+        {
+            cards[dbfIDs[i]] += counts[i];
+        }
+    }
+
+    std::vector<unsigned char> code;
+    code.emplace_back('\0');
+    WriteVarint(code, DECK_CODE_VERSION);
+    WriteVarint(code, static_cast<int>(format));
+    WriteVarint(code, 1);
+    WriteVarint(code, hero);
+
+    // Single-copy, 2-copy and n-copy cards
+    for (int copies = 1; copies <= 3; ++copies)
+    {
+        const auto inGroup = [copies](const std::pair<const int, int>& card) {
+            return copies == 3 ? card.second > 2 : card.second == copies;
+        };
+
+        WriteVarint(code, static_cast<int>(std::count_if(
+                              cards.begin(), cards.end(), inGroup)));
+
+        for (const auto& card : cards)
+        {
+            if (inGroup(card))
+            {
+                WriteVarint(code, card.first);
+                if (copies == 3)
+                {
+                    WriteVarint(code, card.second);
+                }
+            }
+        }
+    }
+
+    return EncodeBase64(code);
+}
+
+std::vector<std::string> DeckCode::EncodeBatch(ThreadPool& pool,
+                                               const DeckCodeBatch& batch)
+{
+    constexpr std::size_t MAX_CARDS = DeckCodeBatch::MAX_CARDS;
+
+    std::vector<std::string> deckCodes(batch.size);
+    const std::size_t numJobs =
+        (batch.size + ROWS_PER_JOB - 1) / ROWS_PER_JOB;
+
+    pool.ParallelFor(numJobs, [&](std::size_t job) {
+        const std::size_t end =
+            std::min(batch.size, (job + 1) * ROWS_PER_JOB);
+
+        for (std::size_t i = job * ROWS_PER_JOB; i < end; ++i)
+        {
+            if (batch.errors[i] != static_cast<std::int32_t>(
+                                       DeckCodeError::NONE))
+            {
+                continue;
+            }
+
+            deckCodes[i] =
+                Encode(batch.heroes[i],
+                       static_cast<FormatType>(batch.formats[i]),
+                       batch.dbfIDs.data() + i * MAX_CARDS,
+                       batch.counts.data() + i * MAX_CARDS, MAX_CARDS);
+        }
+    });
+
+    return deckCodes;
+}
 }  // namespace RosettaStone::PlayMode
@@ -0,0 +1,42 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_action_mask():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	game.start()
+
+	ActionSpace = pyRosetta.ActionSpace
+	mask = ActionSpace.action_mask(game.current_player())
+
+	assert mask.shape == (ActionSpace.size,)
+	assert mask[ActionSpace.end_turn]
+	assert ActionSpace.action_type(ActionSpace.end_turn) == pyRosetta.ActionType.END_TURN
+
+	with pytest.raises(Exception):
+		ActionSpace.decode(game.current_player(), ActionSpace.choose_action(0))
+
+def test_play_game():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	game.start()
+
+	ActionSpace = pyRosetta.ActionSpace
+	rng = np.random.default_rng(0)
+
+	while not game.is_done() and game.turn() <= 30:
+		player = game.current_player()
+		mask = ActionSpace.action_mask(player)
+
+		# End the turn often to keep the game short
+		action = ActionSpace.end_turn if rng.random() < 0.3 else rng.choice(np.flatnonzero(mask))
+		game.process(player, ActionSpace.decode(player, action))
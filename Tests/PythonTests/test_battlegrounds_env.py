@@ -0,0 +1,62 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+VecEnv = pyRosetta.battlegrounds.VecEnv
+ActionSpace = pyRosetta.battlegrounds.ActionSpace
+
+def test_action_space():
+	assert ActionSpace.size == VecEnv.action_size
+	assert ActionSpace.action_type(ActionSpace.purchase_action(0)) == pyRosetta.battlegrounds.ActionType.PURCHASE
+	assert ActionSpace.action_type(ActionSpace.play_card_action(0, 0)) == pyRosetta.battlegrounds.ActionType.PLAY_CARD
+	assert ActionSpace.action_type(ActionSpace.end_recruit) == pyRosetta.battlegrounds.ActionType.END_RECRUIT
+
+def test_step():
+	pool = pyRosetta.ThreadPool(2)
+	env = VecEnv(pool, 4, 42)
+
+	obs = env.reset()
+
+	assert obs.shape == (4, VecEnv.num_players, VecEnv.observation_size)
+	assert env.action_masks.shape == (4, VecEnv.num_players, VecEnv.action_size)
+	assert env.action_masks.any(axis=2).all()
+
+	rng = np.random.default_rng(0)
+	reward_sums = np.zeros(4)
+	num_dones = 0
+
+	for _ in range(1000):
+		masks = env.action_masks
+		actions = np.array([[rng.choice(np.flatnonzero(mask)) for mask in lobby] for lobby in masks], dtype=np.int32)
+		end_recruit = (rng.random(actions.shape) < 0.25) & masks[:, :, ActionSpace.end_recruit]
+		actions[end_recruit] = ActionSpace.end_recruit
+
+		obs, rewards, dones, masks = env.step(actions)
+
+		assert obs.shape == (4, VecEnv.num_players, VecEnv.observation_size)
+		assert masks.any(axis=2).all()
+
+		reward_sums += rewards.sum(axis=1)
+		assert np.allclose(reward_sums[dones], 0.0, atol=1e-4)
+		reward_sums[dones] = 0.0
+		num_dones += dones.sum()
+
+	assert num_dones > 0
+
+def test_invalid_action():
+	pool = pyRosetta.ThreadPool(1)
+	env = VecEnv(pool, 2)
+	env.reset()
+
+	with pytest.raises(Exception):
+		env.step(np.zeros(VecEnv.num_players, dtype=np.int32))
+	with pytest.raises(Exception):
+		env.step(np.full((2, VecEnv.num_players), ActionSpace.end_recruit, dtype=np.int32))
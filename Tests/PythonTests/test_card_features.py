@@ -0,0 +1,40 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+def test_data():
+	Features = pyRosetta.CardFeatures
+	data = Features.data()
+
+	assert data.shape == (Features.num_cards(), Features.num_features)
+	assert data.dtype == np.int32
+	assert not data.flags.writeable
+	assert np.shares_memory(data, Features.data())
+	assert (np.diff(data[:, Features.dbf_id]) >= 0).all()
+
+	card = pyRosetta.Cards.find_card_by_name('River Crocolisk')
+	index = Features.index_by_dbf_id(card.dbf_id)
+	assert Features.index_by_id(card.id) == index
+	assert Features.ids()[index] == card.id
+	assert data[index, Features.cost] == 2
+	assert data[index, Features.attack] == 2
+	assert data[index, Features.health] == 3
+
+	with pytest.raises(Exception):
+		Features.index_by_id('INVALID')
+
+def test_save(tmp_path):
+	Features = pyRosetta.CardFeatures
+	path = str(tmp_path / 'cards.bin')
+	Features.save(path)
+
+	data = np.memmap(path, dtype=np.int32, mode='r', offset=Features.header_size, shape=(Features.num_cards(), Features.num_features))
+	assert (data == Features.data()).all()
@@ -6,6 +6,7 @@ personal capacity and are not conveying any rights to any intellectual
 property of any third parties.
 """
 
+import numpy as np
 import pyRosetta
 import pytest
 
@@ -70,3 +71,39 @@ def test_decode():
 	assert info2.num_card_in_deck('BOT_548') == 1
 	assert info2.num_card_in_deck('DAL_378') == 2
 	assert info2.num_card_in_deck('TRL_065') == 1
+
+def test_decode_batch():
+	hunter = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+	codes = [hunter, 'AAECAR8I', 'AQECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA=', '!!', hunter.encode()]
+	pool = pyRosetta.ThreadPool(2)
+
+	batch = pyRosetta.DeckCode.decode_batch(pool, codes)
+	max_cards = pyRosetta.DeckCode.max_cards
+
+	assert batch['dbf_ids'].shape == (5, max_cards)
+	assert batch['counts'].shape == (5, max_cards)
+	assert list(batch['errors']) == [
+		int(pyRosetta.DeckCodeError.NONE),
+		int(pyRosetta.DeckCodeError.UNEXPECTED_EOF),
+		int(pyRosetta.DeckCodeError.INVALID_DECK_CODE),
+		int(pyRosetta.DeckCodeError.INVALID_BASE64),
+		int(pyRosetta.DeckCodeError.NONE)]
+	assert batch['counts'][0].sum() == 30
+	assert batch['counts'][1].sum() == 0
+	assert batch['heroes'][1] == 0
+	assert np.array_equal(batch['dbf_ids'][0], batch['dbf_ids'][4])
+
+	# A NumPy array of deck codes is accepted too
+	batch2 = pyRosetta.DeckCode.decode_batch(pool, np.array(codes[:3]))
+	assert np.array_equal(batch2['counts'], batch['counts'][:3])
+
+def test_encode_batch():
+	hunter = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+	pool = pyRosetta.ThreadPool(2)
+
+	batch = pyRosetta.DeckCode.decode_batch(pool, [hunter])
+	codes = pyRosetta.DeckCode.encode_batch(pool, batch['heroes'], batch['formats'], batch['dbf_ids'], batch['counts'])
+	assert codes == [hunter]
+
+	with pytest.raises(Exception):
+		pyRosetta.DeckCode.encode_batch(pool, batch['heroes'], batch['formats'], batch['dbf_ids'][:, :5], batch['counts'])
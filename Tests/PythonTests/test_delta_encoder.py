@@ -0,0 +1,34 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import random
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_delta_encode():
+	random.seed(0)
+
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	game.start()
+
+	encoder = pyRosetta.DeltaEncoder(pyRosetta.PlayerType.PLAYER1)
+	obs = np.zeros(pyRosetta.ObservationEncoder.size, dtype=np.float32)
+
+	assert encoder.encode(game, obs) == [(0, pyRosetta.ObservationEncoder.size)]
+	assert encoder.encode(game, obs) == []
+
+	while not game.is_done() and game.turn() <= 20:
+		player = game.current_player()
+		tasks = pyRosetta.RandomAgent.get_valid_tasks(player)
+		game.process(player, random.choice(tasks))
+
+		ranges = encoder.encode(game, obs)
+		assert ranges == encoder.changed_ranges()
+		assert (obs == pyRosetta.ObservationEncoder.encode(game, pyRosetta.PlayerType.PLAYER1)).all()
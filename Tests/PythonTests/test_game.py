@@ -0,0 +1,61 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import pyRosetta
+import random
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_config():
+	config = pyRosetta.GameConfig.from_deck_codes(DECK_CODE, DECK_CODE)
+
+	assert config.player1_class == pyRosetta.CardClass.HUNTER
+	assert config.player2_class == pyRosetta.CardClass.HUNTER
+	assert config.skip_mulligan
+
+	config.start_player = pyRosetta.PlayerType.PLAYER1
+	game = pyRosetta.Game(config)
+	game.start()
+
+	assert game.current_player().player_type == pyRosetta.PlayerType.PLAYER1
+	assert game.player1().hand_zone().count() == 4
+	assert game.player2().hand_zone().count() == 5
+
+def test_mulligan():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE, pyRosetta.PlayerType.PLAYER1, False)
+	game.start()
+
+	assert game.step == pyRosetta.Step.BEGIN_MULLIGAN
+
+	for player in [game.player1(), game.player2()]:
+		assert player.choice_type() == pyRosetta.ChoiceType.MULLIGAN
+		game.process(player, pyRosetta.ChooseTask.mulligan(player, player.choices()))
+
+	assert game.step == pyRosetta.Step.MAIN_ACTION
+	assert game.turn() == 1
+
+def test_play_game():
+	random.seed(0)
+
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	game.start()
+
+	while not game.is_done() and game.turn() <= 50:
+		player = game.current_player()
+		tasks = pyRosetta.RandomAgent.get_valid_tasks(player)
+		game.process(player, random.choice(tasks))
+
+	if game.is_done():
+		assert game.reward(pyRosetta.PlayerType.PLAYER1) + game.reward(pyRosetta.PlayerType.PLAYER2) == 0
+		assert game.reward(pyRosetta.PlayerType.PLAYER1) != 0
+
+def test_random_agent():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	state = pyRosetta.RandomAgent.play_game(game)
+
+	assert state in [pyRosetta.PlayState.WON, pyRosetta.PlayState.LOST, pyRosetta.PlayState.TIED]
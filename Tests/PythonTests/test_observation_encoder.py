@@ -0,0 +1,70 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_encode():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE, pyRosetta.PlayerType.PLAYER1)
+	game.start()
+
+	Encoder = pyRosetta.ObservationEncoder
+	obs = Encoder.encode(game, pyRosetta.PlayerType.PLAYER1)
+
+	assert obs.shape == (Encoder.size,)
+	assert obs.dtype == np.float32
+	assert obs[0] == game.turn()
+	assert obs[1] == 1
+
+	player = obs[Encoder.global_size:Encoder.global_size + Encoder.player_size]
+	assert player[0] == game.player1().hero().health()
+	assert player[16] == game.player1().hand_zone().count()
+
+	hand = player[Encoder.hand_offset:Encoder.secret_offset].reshape(-1, Encoder.hand_card_size)
+	assert (hand[:game.player1().hand_zone().count(), 0] == 1).all()
+	assert (hand[game.player1().hand_zone().count():] == 0).all()
+
+def test_encode_into():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE)
+	game.start()
+
+	Encoder = pyRosetta.ObservationEncoder
+	batch = np.zeros((2, Encoder.size), dtype=np.int32)
+
+	out = Encoder.encode(game, pyRosetta.PlayerType.PLAYER1, batch[0])
+	Encoder.encode(game, pyRosetta.PlayerType.PLAYER2, batch[1])
+
+	assert np.shares_memory(out, batch)
+	assert batch[0, 1] + batch[1, 1] == 1
+
+	with pytest.raises(Exception):
+		Encoder.encode(game, pyRosetta.PlayerType.PLAYER1, np.zeros(Encoder.size, dtype=np.float64))
+	with pytest.raises(Exception):
+		Encoder.encode(game, pyRosetta.PlayerType.PLAYER1, np.zeros(Encoder.size - 1, dtype=np.float32))
+
+def test_encode_hidden_information():
+	game = pyRosetta.Game.from_deck_codes(DECK_CODE, DECK_CODE, pyRosetta.PlayerType.PLAYER1)
+	game.start()
+
+	Encoder = pyRosetta.ObservationEncoder
+	filtered = Encoder.encode(game, pyRosetta.PlayerType.PLAYER1)
+	full = Encoder.encode(game, pyRosetta.PlayerType.PLAYER1, is_filtered=False)
+
+	begin = Encoder.global_size + Encoder.player_size
+	opponent = filtered[begin:begin + Encoder.player_size]
+	hand = opponent[Encoder.hand_offset:Encoder.secret_offset].reshape(-1, Encoder.hand_card_size)
+	count = game.player2().hand_zone().count()
+
+	assert opponent[16] == count
+	assert (hand[:count, 0] == 1).all()
+	assert (hand[:, 1:] == 0).all()
+	assert full[begin + Encoder.hand_offset + 1] != 0
+	assert (filtered[:begin] == full[:begin]).all()
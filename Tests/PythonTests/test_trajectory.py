@@ -0,0 +1,72 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_write_and_read(tmp_path):
+	path = str(tmp_path / 'trajectory.bin')
+	rng = np.random.default_rng(0)
+
+	observations = rng.random((10, 5), dtype=np.float32)
+	actions = np.arange(10, dtype=np.int32)
+	masks = rng.random((10, 7)) < 0.5
+	rewards = rng.random(10, dtype=np.float32)
+	dones = np.arange(10) % 3 == 0
+	stats = rng.random((10, 2), dtype=np.float32)
+
+	with pyRosetta.TrajectoryWriter(path, 5, 7, 2, chunk_size=4) as writer:
+		writer.append(observations[:3], actions[:3], masks[:3], rewards[:3], dones[:3], stats[:3])
+		writer.append(observations[3:], actions[3:], masks[3:], rewards[3:], dones[3:], stats[3:])
+		assert writer.num_steps() == 10
+
+		with pytest.raises(Exception):
+			writer.append(observations, actions[:3], masks, rewards, dones)
+
+	reader = pyRosetta.TrajectoryReader(path)
+	assert reader.observation_size() == 5
+	assert reader.action_size() == 7
+	assert reader.num_stats() == 2
+	assert reader.num_chunks() == 3
+	assert reader.num_steps() == 10
+
+	chunks = [reader.chunk(i) for i in range(reader.num_chunks())]
+	assert np.array_equal(np.concatenate([c['observations'] for c in chunks]), observations)
+	assert np.array_equal(np.concatenate([c['actions'] for c in chunks]), actions)
+	assert np.array_equal(np.concatenate([c['masks'] for c in chunks]), masks)
+	assert np.array_equal(np.concatenate([c['rewards'] for c in chunks]), rewards)
+	assert np.array_equal(np.concatenate([c['dones'] for c in chunks]), dones)
+	assert np.array_equal(np.concatenate([c['stats'] for c in chunks]), stats)
+	assert not chunks[0]['observations'].flags.writeable
+
+def test_vec_env_step(tmp_path):
+	path = str(tmp_path / 'trajectory.bin')
+	pool = pyRosetta.ThreadPool(2)
+	config = pyRosetta.GameConfig.from_deck_codes(DECK_CODE, DECK_CODE)
+	env = pyRosetta.VecEnv(pool, config, 4, 42)
+	env.reset()
+
+	rng = np.random.default_rng(0)
+	writer = pyRosetta.TrajectoryWriter(path, pyRosetta.VecEnv.observation_size, pyRosetta.VecEnv.action_size, 1)
+	first_obs = env.observations.copy()
+
+	for _ in range(20):
+		actions = np.array([rng.choice(np.flatnonzero(mask)) for mask in env.action_masks], dtype=np.int32)
+		env.step(actions, writer, np.ones((4, 1), dtype=np.float32))
+	writer.close()
+
+	reader = pyRosetta.TrajectoryReader(path)
+	assert reader.num_steps() == 80
+
+	chunk = reader.chunk(0)
+	assert np.array_equal(chunk['observations'][:4], first_obs)
+	assert (chunk['stats'] == 1).all()
+	assert chunk['masks'][np.arange(4), chunk['actions'][:4]].all()
@@ -0,0 +1,49 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+DECK_CODE = 'AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/mWA76YAwA='
+
+def test_step():
+	pool = pyRosetta.ThreadPool(2)
+	config = pyRosetta.GameConfig.from_deck_codes(DECK_CODE, DECK_CODE)
+	env = pyRosetta.VecEnv(pool, config, 8, 42)
+
+	obs = env.reset()
+
+	assert obs.shape == (8, pyRosetta.VecEnv.observation_size)
+	assert env.action_masks.shape == (8, pyRosetta.VecEnv.action_size)
+	assert env.action_masks.any(axis=1).all()
+
+	rng = np.random.default_rng(0)
+	num_dones = 0
+
+	for _ in range(300):
+		masks = env.action_masks
+		actions = np.array([rng.choice(np.flatnonzero(mask)) for mask in masks], dtype=np.int32)
+		obs, rewards, dones, masks = env.step(actions)
+
+		assert obs.shape == (8, pyRosetta.VecEnv.observation_size)
+		assert (rewards[~dones] == 0).all()
+		num_dones += dones.sum()
+
+	assert num_dones > 0
+
+def test_invalid_action():
+	pool = pyRosetta.ThreadPool(1)
+	config = pyRosetta.GameConfig.from_deck_codes(DECK_CODE, DECK_CODE)
+	env = pyRosetta.VecEnv(pool, config, 2)
+	env.reset()
+
+	with pytest.raises(Exception):
+		env.step(np.array([0], dtype=np.int32))
+	with pytest.raises(Exception):
+		env.step(np.array([pyRosetta.VecEnv.action_size, 0], dtype=np.int32))
@@ -685,8 +685,8 @@ TEST_CASE("[Battlegrounds : Minion] - BGS_061 : Scallywag")
     Battle battle(player1, player2);
     battle.Initialize();
 
-    player1.getBattleCallback = [&]() -> Battle& { return battle; };
-    player2.getBattleCallback = [&]() -> Battle& { return battle; };
+    player1.battle = &battle;
+    player2.battle = &battle;
 
     CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
     CHECK_EQ(battle.GetPlayer2Field().GetCount(), 1);
@@ -758,8 +758,8 @@ TEST_CASE("[Battlegrounds : Minion] - OG_221 : Selfless Hero")
     Battle battle(player1, player2);
     battle.Initialize();
 
-    player1.getBattleCallback = [&]() -> Battle& { return battle; };
-    player2.getBattleCallback = [&]() -> Battle& { return battle; };
+    player1.battle = &battle;
+    player2.battle = &battle;
 
     CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
     CHECK_EQ(battle.GetPlayer2Field().GetCount(), 1);
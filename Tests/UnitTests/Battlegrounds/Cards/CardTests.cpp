@@ -0,0 +1,28 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Card.hpp>
+
+#include <cstring>
+#include <new>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[Card] - Default Values")
+{
+    // Default-initializes a card on the memory filled with garbage.
+    alignas(Card) unsigned char buffer[sizeof(Card)];
+    std::memset(buffer, 0xff, sizeof(buffer));
+
+    Card* card = new (buffer) Card;
+    CHECK_EQ(card->targetingType, TargetingType::NONE);
+    CHECK_EQ(card->isCurHero, false);
+
+    card->~Card();
+}
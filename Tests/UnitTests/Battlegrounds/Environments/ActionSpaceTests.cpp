@@ -0,0 +1,104 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Environments/ActionSpace.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[ActionSpace] - GetActionType")
+{
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::SelectHeroAction(3)),
+             ActionType::SELECT_HERO);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::PurchaseAction(6)),
+             ActionType::PURCHASE);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::PlayCardAction(9, 6, 7)),
+             ActionType::PLAY_CARD);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::SellAction(0)),
+             ActionType::SELL);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::RearrangeAction(6, 6)),
+             ActionType::REARRANGE);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::REFRESH),
+             ActionType::REFRESH);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::UPGRADE),
+             ActionType::UPGRADE);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::FREEZE),
+             ActionType::FREEZE);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::END_RECRUIT),
+             ActionType::END_RECRUIT);
+    CHECK_THROWS_AS(ActionSpace::GetActionType(ActionSpace::SIZE),
+                    std::invalid_argument);
+}
+
+TEST_CASE("[ActionSpace] - GetActionMask and Apply")
+{
+    Game game;
+    game.Start();
+
+    GameState& gameState = game.GetGameState();
+    Player& player1 = gameState.players.at(0);
+    std::vector<std::uint8_t> mask(ActionSpace::SIZE, 0);
+
+    // Select hero phase
+    std::size_t numActions =
+        ActionSpace::GetActionMask(gameState.phase, player1, mask.data());
+    CHECK_EQ(numActions, NUM_HEROES_ON_SELECTION_LIST);
+    CHECK_EQ(mask[ActionSpace::SelectHeroAction(0)], 1);
+    CHECK_EQ(mask[ActionSpace::PurchaseAction(0)], 0);
+    CHECK_EQ(mask[ActionSpace::END_RECRUIT], 0);
+
+    for (auto& player : gameState.players)
+    {
+        ActionSpace::Apply(player, ActionSpace::SelectHeroAction(0));
+    }
+    CHECK_EQ(gameState.phase, Phase::RECRUIT);
+
+    // Recruit phase: 3 coins, 3 minions in Tavern and no cards
+    ActionSpace::GetActionMask(gameState.phase, player1, mask.data());
+    CHECK_EQ(mask[ActionSpace::SelectHeroAction(0)], 0);
+    CHECK_EQ(mask[ActionSpace::PurchaseAction(0)], 1);
+    CHECK_EQ(mask[ActionSpace::PurchaseAction(2)], 1);
+    CHECK_EQ(mask[ActionSpace::PurchaseAction(3)], 0);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, 0, 0)], 0);
+    CHECK_EQ(mask[ActionSpace::SellAction(0)], 0);
+    CHECK_EQ(mask[ActionSpace::REFRESH], 1);
+    CHECK_EQ(mask[ActionSpace::UPGRADE], 0);
+    CHECK_EQ(mask[ActionSpace::FREEZE], 1);
+    CHECK_EQ(mask[ActionSpace::END_RECRUIT], 1);
+
+    ActionSpace::Apply(player1, ActionSpace::PurchaseAction(0));
+    CHECK_EQ(player1.hand.GetCount(), 1);
+    CHECK_EQ(player1.remainCoin, 0);
+
+    ActionSpace::GetActionMask(gameState.phase, player1, mask.data());
+    CHECK_EQ(mask[ActionSpace::PurchaseAction(0)], 0);
+    CHECK_EQ(mask[ActionSpace::REFRESH], 0);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, 0, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, 1, 0)], 0);
+    CHECK(ActionSpace::IsLegal(gameState.phase, player1,
+                               ActionSpace::PlayCardAction(0, 0, 0)));
+    CHECK_FALSE(ActionSpace::IsLegal(gameState.phase, player1,
+                                     ActionSpace::SellAction(0)));
+
+    ActionSpace::Apply(player1, ActionSpace::PlayCardAction(0, 0, 0));
+    CHECK_EQ(player1.hand.GetCount(), 0);
+    CHECK(player1.recruitField.GetCount() >= 1);
+
+    ActionSpace::GetActionMask(gameState.phase, player1, mask.data());
+    CHECK_EQ(mask[ActionSpace::SellAction(0)], 1);
+
+    // Other phases
+    numActions =
+        ActionSpace::GetActionMask(Phase::COMBAT, player1, mask.data());
+    CHECK_EQ(numActions, 0);
+    CHECK_EQ(mask[ActionSpace::END_RECRUIT], 0);
+}
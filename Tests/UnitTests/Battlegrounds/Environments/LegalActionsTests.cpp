@@ -0,0 +1,83 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Environments/LegalActions.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[LegalActions] - GetLegalActions")
+{
+    Game game;
+    game.Start();
+
+    GameState& gameState = game.GetGameState();
+    for (auto& player : gameState.players)
+    {
+        player.SelectHero(0);
+    }
+    CHECK_EQ(gameState.phase, Phase::RECRUIT);
+
+    Player& player1 = gameState.players.at(0);
+    LegalActions actions;
+    std::vector<std::uint8_t> mask(ActionSpace::SIZE, 0);
+
+    // Recruit phase: 3 coins, 3 minions in Tavern and no cards
+    std::size_t numActions = player1.GetLegalActions(actions);
+    CHECK_EQ(numActions, 6);
+    CHECK_EQ(actions.GetCount(), 6);
+    CHECK_EQ(actions[0].type, ActionType::PURCHASE);
+    CHECK_EQ(actions[2].type, ActionType::PURCHASE);
+    CHECK_EQ(actions[2].pos, 2);
+    CHECK_EQ(actions[3].type, ActionType::REFRESH);
+    CHECK_EQ(actions[4].type, ActionType::FREEZE);
+    CHECK_EQ(actions[5].type, ActionType::END_RECRUIT);
+    CHECK_EQ(actions.GetMask().count(), 6);
+    CHECK(actions.IsLegal(ActionSpace::PurchaseAction(2)));
+    CHECK_FALSE(actions.IsLegal(ActionSpace::PurchaseAction(3)));
+    CHECK_FALSE(actions.IsLegal(ActionSpace::UPGRADE));
+    CHECK_FALSE(actions.IsLegal(ActionSpace::SIZE));
+
+    player1.PurchaseMinion(0);
+
+    // 0 coins, a minion in hand and no minions on the field
+    numActions = player1.GetLegalActions(actions);
+    CHECK_EQ(numActions, 3);
+    CHECK_EQ(actions[0].type, ActionType::PLAY_CARD);
+    CHECK_EQ(actions[0].pos, 0);
+    CHECK_EQ(actions[0].fieldPos, 0);
+    CHECK_EQ(actions[0].target, 0);
+    CHECK_EQ(actions[0].GetAction(), ActionSpace::PlayCardAction(0, 0, 0));
+    CHECK_FALSE(actions.IsLegal(ActionSpace::PurchaseAction(0)));
+    CHECK_FALSE(actions.IsLegal(ActionSpace::REFRESH));
+
+    player1.PlayCard(0, 0);
+    player1.remainCoin = 10;
+
+    // Records, the mask and ActionSpace agree with each other
+    numActions = player1.GetLegalActions(actions);
+    CHECK_EQ(ActionSpace::GetActionMask(gameState.phase, player1, mask.data()),
+             numActions);
+    CHECK_EQ(actions.GetMask().count(), numActions);
+    CHECK(actions.IsLegal(ActionSpace::SellAction(0)));
+    CHECK(actions.IsLegal(ActionSpace::UPGRADE));
+
+    for (const auto& action : actions)
+    {
+        CHECK_EQ(mask[action.GetAction()], 1);
+    }
+    for (std::size_t action = 0; action < ActionSpace::SIZE; ++action)
+    {
+        CHECK_EQ(actions.IsLegal(action), mask[action] == 1);
+        CHECK_EQ(actions.IsLegal(action),
+                 ActionSpace::IsLegal(gameState.phase, player1, action));
+    }
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Environments/LobbyRunner.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+// Ends recruit whenever it can, so lobbies finish quickly.
+class PassiveAgent : public Agent
+{
+ public:
+    std::size_t SelectAction([[maybe_unused]] GameState& gameState,
+                             [[maybe_unused]] std::size_t playerIdx,
+                             const std::uint8_t* actionMask,
+                             std::size_t numLegalActions) override
+    {
+        if (actionMask[ActionSpace::END_RECRUIT] != 0)
+        {
+            return ActionSpace::END_RECRUIT;
+        }
+
+        return m_randomAgent.SelectAction(gameState, playerIdx, actionMask,
+                                          numLegalActions);
+    }
+
+ private:
+    RandomAgent m_randomAgent;
+};
+
+// Selects an action that is never legal.
+class InvalidAgent : public Agent
+{
+ public:
+    std::size_t SelectAction([[maybe_unused]] GameState& gameState,
+                             [[maybe_unused]] std::size_t playerIdx,
+                             [[maybe_unused]] const std::uint8_t* actionMask,
+                             [[maybe_unused]] std::size_t numLegalActions)
+        override
+    {
+        return ActionSpace::SIZE;
+    }
+};
+
+std::vector<LobbyResult> RunLobbies(ThreadPool& pool, std::size_t numLobbies)
+{
+    // Seat 0 plays random actions against passive players
+    const auto agentFactory =
+        [](std::size_t playerIdx) -> std::unique_ptr<Agent> {
+        if (playerIdx == 0)
+        {
+            return std::make_unique<RandomAgent>();
+        }
+
+        return std::make_unique<PassiveAgent>();
+    };
+    LobbyRunner runner(pool, agentFactory);
+
+    std::vector<LobbyResult> results;
+    runner.Run(numLobbies, 42, [&](const LobbyResult& result) {
+        results.emplace_back(result);
+    });
+
+    std::sort(results.begin(), results.end(),
+              [](const LobbyResult& lhs, const LobbyResult& rhs) {
+                  return lhs.lobbyIdx < rhs.lobbyIdx;
+              });
+
+    return results;
+}
+}  // namespace
+
+TEST_CASE("[LobbyRunner] - Run")
+{
+    ThreadPool pool1(1);
+    ThreadPool pool4(4);
+
+    const auto results1 = RunLobbies(pool1, 6);
+    const auto results4 = RunLobbies(pool4, 6);
+    CHECK_EQ(results1.size(), 6);
+    CHECK_EQ(results4.size(), 6);
+
+    for (std::size_t i = 0; i < results1.size(); ++i)
+    {
+        const LobbyResult& result = results1[i];
+        CHECK_EQ(result.lobbyIdx, i);
+        CHECK_GT(result.numRounds, 1);
+        CHECK_LE(result.numRounds, LobbyRunner::MAX_NUM_ROUNDS + 1);
+
+        // Ranks are a permutation of places
+        std::vector<std::size_t> ranks;
+        for (const auto& player : result.players)
+        {
+            ranks.emplace_back(player.rank);
+            CHECK_NE(player.heroDbfID, 0);
+            CHECK_GE(player.tier, 1);
+            CHECK_LE(player.numMinions, MAX_FIELD_SIZE);
+
+            for (int pos = 0; pos < player.numMinions; ++pos)
+            {
+                CHECK_NE(player.board[pos].dbfID, 0);
+            }
+        }
+
+        std::sort(ranks.begin(), ranks.end());
+        for (std::size_t rank = 0; rank < ranks.size(); ++rank)
+        {
+            CHECK_EQ(ranks[rank], rank + 1);
+        }
+
+        // The result doesn't depend on the number of threads
+        const LobbyResult& result4 = results4[i];
+        CHECK_EQ(result.numRounds, result4.numRounds);
+
+        for (std::size_t playerIdx = 0; playerIdx < LobbyRunner::NUM_PLAYERS;
+             ++playerIdx)
+        {
+            const auto& player1 = result.players[playerIdx];
+            const auto& player4 = result4.players[playerIdx];
+            CHECK_EQ(player1.rank, player4.rank);
+            CHECK_EQ(player1.heroDbfID, player4.heroDbfID);
+            CHECK_EQ(player1.health, player4.health);
+            CHECK_EQ(player1.numMinions, player4.numMinions);
+
+            for (int pos = 0; pos < player1.numMinions; ++pos)
+            {
+                CHECK_EQ(player1.board[pos].dbfID, player4.board[pos].dbfID);
+                CHECK_EQ(player1.board[pos].attack,
+                         player4.board[pos].attack);
+            }
+        }
+    }
+}
+
+TEST_CASE("[LobbyRunner] - Invalid agents")
+{
+    ThreadPool pool(2);
+
+    CHECK_THROWS_AS(LobbyRunner(pool,
+                                [](std::size_t) -> std::unique_ptr<Agent> {
+                                    return nullptr;
+                                }),
+                    std::invalid_argument);
+
+    LobbyRunner runner(pool, [](std::size_t) -> std::unique_ptr<Agent> {
+        return std::make_unique<InvalidAgent>();
+    });
+
+    std::size_t numResults = 0;
+    CHECK_THROWS_AS(runner.Run(4, 0, [&](const LobbyResult&) { ++numResults; }),
+                    std::logic_error);
+    CHECK_EQ(numResults, 0);
+}
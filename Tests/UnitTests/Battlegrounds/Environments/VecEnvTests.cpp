@@ -0,0 +1,162 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Environments/VecEnv.hpp>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+// Chooses a random valid action, which ends recruit with probability 1/4 if
+// possible, so games proceed to combats.
+std::vector<int> GetRandomActions(VecEnv& env, std::mt19937& rng)
+{
+    std::vector<int> actions(env.GetNumLobbies() * VecEnv::NUM_PLAYERS, 0);
+
+    for (std::size_t i = 0; i < actions.size(); ++i)
+    {
+        const std::uint8_t* mask =
+            env.GetActionMasks() + i * VecEnv::ACTION_SIZE;
+
+        std::vector<int> validActions;
+        for (std::size_t j = 0; j < VecEnv::ACTION_SIZE; ++j)
+        {
+            if (mask[j] != 0)
+            {
+                validActions.emplace_back(static_cast<int>(j));
+            }
+        }
+
+        if (rng() % 4 == 0 && mask[ActionSpace::END_RECRUIT] != 0)
+        {
+            actions[i] = static_cast<int>(ActionSpace::END_RECRUIT);
+        }
+        else
+        {
+            actions[i] = validActions[rng() % validActions.size()];
+        }
+    }
+
+    return actions;
+}
+}  // namespace
+
+TEST_CASE("[VecEnv] - Reset")
+{
+    ThreadPool pool(2);
+    CHECK_THROWS_AS(VecEnv(pool, 0), std::invalid_argument);
+
+    VecEnv env(pool, 2, 7);
+    CHECK_THROWS_AS(
+        env.Step(std::vector<int>(2 * VecEnv::NUM_PLAYERS,
+                                  static_cast<int>(ActionSpace::END_RECRUIT))),
+        std::logic_error);
+
+    env.Reset();
+
+    for (std::size_t i = 0; i < env.GetNumLobbies(); ++i)
+    {
+        CHECK_EQ(env.GetGame(i).GetGameState().phase, Phase::SELECT_HERO);
+        CHECK_EQ(env.GetRound(i), 0);
+        CHECK_EQ(env.GetDones()[i], 0);
+
+        for (std::size_t j = 0; j < VecEnv::NUM_PLAYERS; ++j)
+        {
+            const std::uint8_t* mask =
+                env.GetActionMasks() +
+                (i * VecEnv::NUM_PLAYERS + j) * VecEnv::ACTION_SIZE;
+            CHECK_EQ(mask[ActionSpace::SelectHeroAction(0)], 1);
+            CHECK_EQ(mask[ActionSpace::END_RECRUIT], 0);
+        }
+    }
+
+    // Wrong number of actions
+    CHECK_THROWS_AS(env.Step({ 0, 0 }), std::invalid_argument);
+
+    // Illegal action
+    std::vector<int> actions(2 * VecEnv::NUM_PLAYERS, 0);
+    actions.back() = static_cast<int>(ActionSpace::END_RECRUIT);
+    CHECK_THROWS_AS(env.Step(actions), std::invalid_argument);
+
+    // All players select heroes
+    actions.back() = 0;
+    env.Step(actions);
+
+    for (std::size_t i = 0; i < env.GetNumLobbies(); ++i)
+    {
+        CHECK_EQ(env.GetGame(i).GetGameState().phase, Phase::RECRUIT);
+        CHECK_EQ(env.GetRound(i), 1);
+    }
+}
+
+TEST_CASE("[VecEnv] - Step")
+{
+    ThreadPool pool1(1);
+    ThreadPool pool4(4);
+    VecEnv env1(pool1, 4, 42);
+    VecEnv env4(pool4, 4, 42);
+    env1.Reset();
+    env4.Reset();
+
+    std::mt19937 rng(0);
+    std::vector<float> rewardSums(env1.GetNumLobbies(), 0.0f);
+    int numDones = 0;
+
+    for (int step = 0; step < 1000; ++step)
+    {
+        // NOTE: Both environments are in the same state, so the actions are
+        // valid for both of them.
+        const std::vector<int> actions = GetRandomActions(env1, rng);
+        env1.Step(actions);
+        env4.Step(actions);
+
+        for (std::size_t i = 0; i < env1.GetNumLobbies(); ++i)
+        {
+            // The result doesn't depend on the number of threads
+            CHECK_EQ(env1.GetDones()[i], env4.GetDones()[i]);
+            CHECK_EQ(env1.GetRound(i), env4.GetRound(i));
+
+            for (std::size_t j = 0; j < VecEnv::NUM_PLAYERS; ++j)
+            {
+                const std::size_t idx = i * VecEnv::NUM_PLAYERS + j;
+                CHECK_EQ(env1.GetRewards()[idx], env4.GetRewards()[idx]);
+                rewardSums[i] += env1.GetRewards()[idx];
+            }
+
+            if (env1.GetDones()[i] != 0)
+            {
+                ++numDones;
+
+                // The rewards of ranks in a lobby sum to zero
+                CHECK_LT(std::abs(rewardSums[i]), 1e-4f);
+                rewardSums[i] = 0.0f;
+
+                // The lobby is reset automatically
+                CHECK_EQ(env1.GetRound(i), 0);
+                CHECK_EQ(env1.GetGame(i).GetGameState().phase,
+                         Phase::SELECT_HERO);
+            }
+        }
+
+        for (std::size_t i = 0; i < env1.GetNumLobbies() *
+                                        VecEnv::NUM_PLAYERS *
+                                        VecEnv::OBSERVATION_SIZE;
+             ++i)
+        {
+            CHECK_EQ(env1.GetObservations()[i], env4.GetObservations()[i]);
+        }
+    }
+
+    CHECK_GT(numDones, 0);
+}
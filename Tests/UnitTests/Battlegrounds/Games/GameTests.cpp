@@ -9,6 +9,7 @@
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
 #include <Rosetta/Battlegrounds/Games/Game.hpp>
 #include <Rosetta/Battlegrounds/Utils/GameUtils.hpp>
+#include <Rosetta/Common/Utils.hpp>
 
 #include <vector>
 
@@ -224,6 +225,45 @@ TEST_CASE("[Game] - DetermineOpponent")
     }
 }
 
+TEST_CASE("[Game] - DeterminePlayerToFightGhost")
+{
+    Game game;
+    game.Start();
+
+    auto& players = game.GetGameState().players;
+    players.at(0).hero.health = 0;
+    players.at(1).hero.health = 0;
+    players.at(2).hero.health = 0;
+    players.at(3).hero.health = 40;
+    players.at(4).hero.health = 30;
+    players.at(5).hero.health = 20;
+    players.at(6).hero.health = 10;
+    players.at(7).hero.health = 5;
+
+    players.at(0).playState = PlayState::LOST;
+    players.at(1).playState = PlayState::LOST;
+    players.at(2).playState = PlayState::LOST;
+
+    // Bottom 3 are players 5, 6 and 7
+    auto playerData = game.CalculateRank();
+    const std::size_t ghostIdx1 = game.DeterminePlayerToFightGhost(playerData);
+    CHECK_GE(ghostIdx1, 5);
+    CHECK_LE(ghostIdx1, 7);
+    CHECK_EQ(playerData.size(), 4);
+
+    for (auto& player : players)
+    {
+        CHECK_EQ(player.isFoughtGhostLastTurn, player.idx == ghostIdx1);
+    }
+
+    // Can't fight a ghost 2 turns in a row
+    playerData = game.CalculateRank();
+    const std::size_t ghostIdx2 = game.DeterminePlayerToFightGhost(playerData);
+    CHECK_GE(ghostIdx2, 5);
+    CHECK_LE(ghostIdx2, 7);
+    CHECK_NE(ghostIdx2, ghostIdx1);
+}
+
 TEST_CASE("[Game] - Freeze")
 {
     Game game;
@@ -390,4 +430,101 @@ TEST_CASE("[Game] - Rank")
     CHECK_EQ(players.at(5).rank, 5);
     CHECK_EQ(players.at(6).rank, 4);
     CHECK_EQ(players.at(7).rank, 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Game] - Combat with thread pool")
+{
+    // Plays a game with simple actions and returns health of heroes
+    const auto playGame = [](ThreadPool* pool) {
+        SeedRandom(42, 0);
+
+        Game game;
+        game.SetThreadPool(pool);
+        game.Start();
+
+        for (auto& player : game.GetGameState().players)
+        {
+            player.SelectHero(0);
+        }
+
+        PlaySimpleRounds(game, 10);
+
+        std::vector<int> health;
+        for (const auto& player : game.GetGameState().players)
+        {
+            health.emplace_back(player.hero.health);
+        }
+
+        return health;
+    };
+
+    ThreadPool pool(4);
+    const std::vector<int> health1 = playGame(nullptr);
+    const std::vector<int> health2 = playGame(&pool);
+
+    // The result doesn't depend on the thread that simulates battles
+    CHECK_EQ(health1, health2);
+}
+
+TEST_CASE("[Game] - RefCopyFrom")
+{
+    SeedRandom(42, 0);
+
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+    PlaySimpleRounds(game, 3);
+
+    Game copy;
+    copy.RefCopyFrom(game);
+
+    GameState& gameState = game.GetGameState();
+    GameState& copyState = copy.GetGameState();
+    CHECK_EQ(copyState.phase, Phase::RECRUIT);
+
+    for (std::size_t i = 0; i < NUM_BATTLEGROUNDS_PLAYERS; ++i)
+    {
+        Player& player = copyState.players[i];
+        CHECK_EQ(player.remainCoin, gameState.players[i].remainCoin);
+        CHECK_EQ(player.hero.health, gameState.players[i].hero.health);
+        CHECK_EQ(player.recruitField.GetCount(),
+                 gameState.players[i].recruitField.GetCount());
+
+        // Minions of the copy refer to the players of the copy
+        player.recruitField.ForEach([&](MinionData& minion) {
+            CHECK_EQ(&minion.value().GetPlayer(), &player);
+        });
+    }
+
+    // Playing the copy doesn't change the game
+    const int numAvailable = gameState.minionPool.GetNumAvailableMinions(6);
+    const int remainCoin = gameState.players[0].remainCoin;
+
+    copyState.players[0].RefreshTavern();
+    CHECK_EQ(gameState.minionPool.GetNumAvailableMinions(6), numAvailable);
+    CHECK_EQ(gameState.players[0].remainCoin, remainCoin);
+
+    SeedRandom(7, 0);
+    copy.RefCopyFrom(game);
+    PlaySimpleRounds(copy, 3);
+    CHECK_EQ(gameState.phase, Phase::RECRUIT);
+    CHECK_EQ(gameState.minionPool.GetNumAvailableMinions(6), numAvailable);
+
+    // The game and the copy continue in the same way
+    SeedRandom(7, 0);
+    PlaySimpleRounds(game, 3);
+
+    for (std::size_t i = 0; i < NUM_BATTLEGROUNDS_PLAYERS; ++i)
+    {
+        CHECK_EQ(copyState.players[i].hero.health,
+                 gameState.players[i].hero.health);
+        CHECK_EQ(copyState.players[i].recruitField.GetCount(),
+                 gameState.players[i].recruitField.GetCount());
+    }
+    CHECK_EQ(copyState.minionPool.GetNumAvailableMinions(6),
+             gameState.minionPool.GetNumAvailableMinions(6));
+}
@@ -9,6 +9,9 @@
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
 #include <Rosetta/Battlegrounds/Games/Game.hpp>
 #include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Tasks/SimpleTasks/SummonTask.hpp>
+
+#include <algorithm>
 
 using namespace RosettaStone;
 using namespace Battlegrounds;
@@ -157,4 +160,298 @@ TEST_CASE("[Battle] - Next Attacker")
 
     CHECK_EQ(battle.GetPlayer1NextAttacker(), 0);
     CHECK_EQ(battle.GetPlayer2NextAttacker(), 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Battle] - Opponent and card index")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByDbfID(49169));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+    minion1.SetIndex(3);
+    minion2.SetIndex(7);
+
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+
+    Battle battle(player1, player2);
+    player1.battle = &battle;
+    player2.battle = &battle;
+
+    CHECK_EQ(&player1.GetOpponentPlayer(), &player2);
+    CHECK_EQ(&player2.GetOpponentPlayer(), &player1);
+
+    // Minions summoned in the battle take indices after both fields
+    CHECK_EQ(player1.GetNextCardIndex(), 8);
+    CHECK_EQ(player2.GetNextCardIndex(), 9);
+    CHECK_EQ(game.GetNextCardIndex(), 0);
+
+    player1.battle = nullptr;
+    player2.battle = nullptr;
+}
+
+TEST_CASE("[Battle] - Start of Combat tasks in battles back to back")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    game.SetPlayerPair(0, 1);
+
+    // Red Whelp deals 1 damage per other friendly Dragon, so 2 damage here.
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_019")));
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_039")));
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_039")));
+    player1.PlayCard(0, 0);
+    player1.PlayCard(0, 0);
+    player1.PlayCard(0, 0);
+
+    player2.hand.Add(Minion(Cards::FindCardByID("BGS_039")));
+    player2.PlayCard(0, 0);
+    player2.recruitField[0].SetHealth(10);
+
+    player1.isInCombat = true;
+    player2.isInCombat = true;
+
+    Battle battle1(player1, player2);
+    battle1.Initialize();
+
+    CHECK_EQ(battle1.GetPlayer2Field()[0].GetHealth(), 8);
+
+    // The tasks stacked in the first battle must not be repeated again.
+    Battle battle2(player1, player2);
+    battle2.Initialize();
+
+    CHECK_EQ(battle2.GetPlayer2Field()[0].GetHealth(), 8);
+}
+
+TEST_CASE("[Battle] - Summoned minion on task stack")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    game.SetPlayerPair(0, 1);
+
+    // Scallywag summons a 1/1 Pirate that attacks immediately.
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_061")));
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_061")));
+    player1.hand.Add(Minion(Cards::FindCardByID("ICC_038")));
+    player1.PlayCard(0, 0);
+    player1.PlayCard(0, 1);
+    player1.PlayCard(0, 2);
+
+    player2.hand.Add(Minion(Cards::FindCardByID("LOOT_013")));
+    player2.PlayCard(0, 0);
+    player2.recruitField[0].SetHealth(30);
+
+    player1.isInCombat = true;
+    player2.isInCombat = true;
+
+    Battle battle(player1, player2);
+    battle.Initialize();
+
+    player1.battle = &battle;
+    player2.battle = &battle;
+
+    battle.Attack();
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
+    CHECK_EQ(battle.GetPlayer2Field()[0].GetHealth(), 27);
+
+    battle.Attack();
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
+    CHECK_EQ(battle.GetPlayer2Field()[0].GetHealth(), 26);
+
+    // Only the Pirate summoned by the second Scallywag attacks, not the
+    // minion that took the place of the first Pirate.
+    battle.Attack();
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 1);
+    CHECK_EQ(battle.GetPlayer2Field()[0].GetHealth(), 23);
+
+    player1.battle = nullptr;
+    player2.battle = nullptr;
+}
+
+TEST_CASE("[Battle] - ProcessDestroy (Adjacent minions)")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByID("BOT_537"));
+    Minion minion2(Cards::FindCardByID("CFM_315"));
+    Minion minion3(Cards::FindCardByID("CFM_315"));
+    Minion minion4(Cards::FindCardByID("BGS_039"));
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+    player2.recruitField.Add(minion3);
+    player2.recruitField.Add(minion4);
+
+    Battle battle(player1, player2);
+
+    player2.battleField[0].TakeDamage(1);
+    player2.battleField[1].TakeDamage(1);
+
+    // Removing the first minion shifts the second one to its position.
+    battle.ProcessDestroy(true);
+
+    auto& p2Field = battle.GetPlayer2Field();
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 1);
+    CHECK_EQ(p2Field.GetCount(), 1);
+    CHECK_EQ(p2Field[0].GetName(), "Dragonspawn Lieutenant");
+}
+
+TEST_CASE("[Battle] - Summoned minion attacks an empty field")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    game.SetPlayerPair(0, 1);
+
+    // Scallywag and Dragonspawn Lieutenant destroy each other, so the
+    // Pirate that Scallywag summons has no target.
+    player1.hand.Add(Minion(Cards::FindCardByID("BGS_061")));
+    player1.hand.Add(Minion(Cards::FindCardByID("BOT_537")));
+    player1.PlayCard(0, 0);
+    player1.PlayCard(0, 1);
+
+    player2.hand.Add(Minion(Cards::FindCardByID("BGS_039")));
+    player2.PlayCard(0, 0);
+    player2.recruitField[0].SetHealth(2);
+
+    player1.isInCombat = true;
+    player2.isInCombat = true;
+
+    Battle battle(player1, player2);
+    battle.Initialize();
+
+    player1.battle = &battle;
+    player2.battle = &battle;
+
+    CHECK_NOTHROW(battle.Attack());
+    CHECK_EQ(battle.IsDone(), true);
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
+    CHECK_EQ(battle.GetPlayer2Field().GetCount(), 0);
+
+    player1.battle = nullptr;
+    player2.battle = nullptr;
+}
+
+TEST_CASE("[Battle] - SummonTask in a battle")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    game.SetPlayerPair(0, 1);
+
+    player1.hand.Add(Minion(Cards::FindCardByID("BOT_537")));
+    player1.PlayCard(0, 0);
+    player2.hand.Add(Minion(Cards::FindCardByID("BGS_039")));
+    player2.PlayCard(0, 0);
+
+    player1.isInCombat = true;
+    player2.isInCombat = true;
+
+    Battle battle(player1, player2);
+    player1.battle = &battle;
+    player2.battle = &battle;
+
+    const int maxIndex =
+        std::max(battle.GetPlayer1Field()[0].GetIndex(),
+                 battle.GetPlayer2Field()[0].GetIndex());
+
+    SimpleTasks::SummonTask task("BGS_061t", 1);
+    CHECK_EQ(task.Run(player1, player1.battleField[0]),
+             TaskStatus::COMPLETE);
+
+    // The summoned minion belongs to the player and takes the next index.
+    auto& p1Field = battle.GetPlayer1Field();
+    CHECK_EQ(p1Field.GetCount(), 2);
+    CHECK_EQ(p1Field[1].GetIndex(), maxIndex + 1);
+    CHECK_EQ(&p1Field[1].GetPlayer(), &player1);
+
+    player1.battle = nullptr;
+    player2.battle = nullptr;
+}
+
+TEST_CASE("[Battle] - Next Attacker (Destroyed minions)")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(58536));
+    player2.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    game.SetPlayerPair(0, 1);
+
+    Minion minion1(Cards::FindCardByID("BGS_039"));
+    Minion minion2(Cards::FindCardByID("BGS_039"));
+    minion1.SetAttack(1);
+    minion1.SetHealth(3);
+    minion2.SetAttack(1);
+    minion2.SetHealth(1);
+    player1.recruitField.Add(minion1);
+    player1.recruitField.Add(minion2);
+
+    player2.hand.Add(Minion(Cards::FindCardByID("BGS_061")));
+    player2.PlayCard(0, 0);
+    player2.recruitField[0].SetGameTag(GameTag::DIVINE_SHIELD, 1);
+
+    player1.isInCombat = true;
+    player2.isInCombat = true;
+
+    Battle battle(player1, player2);
+    battle.Initialize();
+
+    player1.battle = &battle;
+    player2.battle = &battle;
+
+    battle.Attack();
+    CHECK_EQ(battle.GetPlayer1NextAttacker(), 1);
+    CHECK_EQ(battle.GetPlayer2NextAttacker(), 0);
+
+    // Scallywag destroys a minion and its Pirate destroys the other one, so
+    // the index of next attacker must be moved back into the field.
+    battle.Attack();
+    CHECK_EQ(battle.GetPlayer1Field().GetCount(), 0);
+    CHECK_EQ(battle.GetPlayer2Field().GetCount(), 0);
+    CHECK_EQ(battle.GetPlayer1NextAttacker(), 0);
+    CHECK_EQ(battle.GetPlayer2NextAttacker(), 0);
+
+    player1.battle = nullptr;
+    player2.battle = nullptr;
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatBoard.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[CombatBoard] - Load and Remove")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    FieldZone field;
+    Minion minion1(Cards::FindCardByID("EX1_531"));
+    Minion minion2(Cards::FindCardByID("BGS_039"));
+    Minion minion3(Cards::FindCardByID("GVG_103"));
+    Minion minion4(Cards::FindCardByID("ICC_038"));
+    field.Add(minion1);
+    field.Add(minion2);
+    field.Add(minion3);
+    field.Add(minion4);
+
+    CombatBoard board;
+    board.Load(field);
+    CHECK_EQ(board.GetCount(), 4);
+    CHECK_EQ(board.GetAttack(0), 2);
+    CHECK_EQ(board.GetHealth(2), 2);
+    CHECK_EQ(board.GetKeywords(1), CombatBoard::TAUNT);
+    CHECK_EQ(board.GetKeywords(3),
+             CombatBoard::TAUNT | CombatBoard::DIVINE_SHIELD);
+    CHECK_EQ(board.GetTriggerType(0), TriggerType::DEATH);
+    CHECK_EQ(board.GetTriggerType(2), TriggerType::TURN_START);
+    CHECK_EQ(board.GetAliveMask(), 0b1111);
+    CHECK_EQ(board.GetDestroyedMask(), 0);
+    CHECK_EQ(board.GetAttackerMask(), 0b1111);
+    CHECK_EQ(board.GetTauntMask(), 0b1010);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::DEATH), 0b0001);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::TURN_START), 0b0100);
+
+    field[0].SetAttack(0);
+    field[1].TakeDamage(3);
+    board.Load(field);
+    CHECK_EQ(board.GetAliveMask(), 0b1101);
+    CHECK_EQ(board.GetDestroyedMask(), 0b0010);
+
+    // Destroyed minions can't attack and don't protect others with taunt
+    CHECK_EQ(board.GetAttackerMask(), 0b1100);
+    CHECK_EQ(board.GetTauntMask(), 0b1000);
+
+    board.Remove(1);
+    CHECK_EQ(board.GetCount(), 3);
+    CHECK_EQ(board.GetAttack(1), 1);
+    CHECK_EQ(board.GetTriggerType(1), TriggerType::TURN_START);
+    CHECK_EQ(board.GetAliveMask(), 0b111);
+    CHECK_EQ(board.GetDestroyedMask(), 0);
+    CHECK_EQ(board.GetTauntMask(), 0b100);
+    CHECK_EQ(board.GetAttackerMask(), 0b110);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::DEATH), 0b001);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::TURN_START), 0b010);
+
+    field[0].SetAttack(3);
+    board.Update(0, field[0]);
+    CHECK_EQ(board.GetAttackerMask(), 0b111);
+
+    FieldZone smallField;
+    smallField.Add(minion2);
+    board.Load(smallField);
+    CHECK_EQ(board.GetAttackerMask(), 0b1);
+    CHECK_EQ(board.GetTauntMask(), 0b1);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::DEATH), 0);
+    CHECK_EQ(board.GetTriggerMask(TriggerType::TURN_START), 0);
+}
+
+TEST_CASE("[CombatBoard] - Bit operations")
+{
+    CHECK_EQ(CombatBoard::CountBits(0), 0);
+    CHECK_EQ(CombatBoard::CountBits(0b1011001), 4);
+
+    CHECK_EQ(CombatBoard::FindBit(0b1011001, 0), 0);
+    CHECK_EQ(CombatBoard::FindBit(0b1011001, 2), 4);
+    CHECK_EQ(CombatBoard::FindBit(0b1011001, 3), 6);
+    CHECK_EQ(CombatBoard::FindBit(0b1011001, 4), -1);
+
+    CHECK_EQ(CombatBoard::FindNextBit(0b1011001, 0), 0);
+    CHECK_EQ(CombatBoard::FindNextBit(0b1011001, 1), 3);
+    CHECK_EQ(CombatBoard::FindNextBit(0b1011001, 5), 6);
+    CHECK_EQ(CombatBoard::FindNextBit(0b0011001, 5), 0);
+    CHECK_EQ(CombatBoard::FindNextBit(0, 3), -1);
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[CombatCache] - ComputeHash")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+
+    FieldZone board1;
+    board1.Add(minion1);
+    board1.Add(minion2);
+
+    // The indices of minions are not a part of the board
+    FieldZone board2;
+    Minion minion3(minion1);
+    minion3.SetIndex(10);
+    board2.Add(minion3);
+    board2.Add(minion2);
+    CHECK_EQ(CombatCache::ComputeHash(board1, 2),
+             CombatCache::ComputeHash(board2, 2));
+
+    // Tier, position, stats and keywords are
+    CHECK_NE(CombatCache::ComputeHash(board1, 2),
+             CombatCache::ComputeHash(board1, 3));
+
+    FieldZone board3;
+    board3.Add(minion2);
+    board3.Add(minion1);
+    CHECK_NE(CombatCache::ComputeHash(board1, 2),
+             CombatCache::ComputeHash(board3, 2));
+
+    board2[0].SetAttack(board2[0].GetAttack() + 1);
+    CHECK_NE(CombatCache::ComputeHash(board1, 2),
+             CombatCache::ComputeHash(board2, 2));
+
+    board2[0].SetAttack(board2[0].GetAttack() - 1);
+    board2[0].SetGameTag(GameTag::DIVINE_SHIELD, 0);
+    CHECK_NE(CombatCache::ComputeHash(board1, 2),
+             CombatCache::ComputeHash(board2, 2));
+}
+
+TEST_CASE("[CombatCache] - Estimate")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    ThreadPool pool(2);
+    CombatEstimator estimator(pool);
+    CombatCache cache(estimator, 2);
+
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+    FieldZone board1;
+    FieldZone board2;
+    FieldZone board3;
+    board1.Add(minion1);
+    board1.Add(minion2);
+    board2.Add(minion2);
+    board3.Add(minion1);
+
+    const CombatStats expected =
+        estimator.Estimate(board1, 2, board2, 2, 200, 42);
+
+    CombatStats stats = cache.Estimate(board1, 2, board2, 2, 200, 42);
+    CHECK_EQ(stats.numWins, expected.numWins);
+    CHECK_EQ(stats.damageDealt, expected.damageDealt);
+    CHECK_EQ(cache.GetSize(), 1);
+    CHECK_EQ(cache.GetStats().numMisses, 1);
+
+    // Fewer runs hit, more runs miss and replace the results
+    stats = cache.Estimate(board1, 2, board2, 2, 100, 7);
+    CHECK_EQ(stats.numRuns, 200);
+    CHECK_EQ(cache.GetStats().numHits, 1);
+
+    stats = cache.Estimate(board1, 2, board2, 2, 300, 42);
+    CHECK_EQ(stats.numRuns, 300);
+    CHECK_EQ(cache.GetStats().numMisses, 2);
+    CHECK_EQ(cache.GetSize(), 1);
+
+    // The pair is ordered
+    cache.Estimate(board2, 2, board1, 2, 100);
+    CHECK_EQ(cache.GetSize(), 2);
+    CHECK_EQ(cache.GetStats().numMisses, 3);
+
+    // The least recently used results are evicted
+    const auto key1 = CombatCache::MakeKey(board1, 2);
+    const auto key2 = CombatCache::MakeKey(board2, 2);
+    CHECK(cache.Find(key1, key2) != nullptr);
+
+    cache.Estimate(board3, 2, board2, 2, 100);
+    CHECK_EQ(cache.GetSize(), 2);
+    CHECK_EQ(cache.GetStats().numEvictions, 1);
+    CHECK(cache.Find(key1, key2) != nullptr);
+    CHECK(cache.Find(key2, key1) == nullptr);
+
+    // A board whose hash collides with the stored one is a miss
+    auto collidedKey = key2;
+    collidedKey.slots[0].attack += 1;
+    CHECK(cache.Find(key1, collidedKey) == nullptr);
+
+    CHECK_EQ(cache.GetStats().numHits, 1);
+    CHECK_EQ(cache.GetStats().numMisses, 4);
+    CHECK_EQ(cache.GetStats().GetHitRate(), 0.2);
+
+    cache.Clear();
+    CHECK_EQ(cache.GetSize(), 0);
+    CHECK_EQ(cache.GetStats().GetHitRate(), 0.0);
+}
@@ -0,0 +1,89 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatEstimator.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[CombatEstimator] - Certain result")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    ThreadPool pool(2);
+    CombatEstimator estimator(pool);
+
+    FieldZone board1;
+    FieldZone board2;
+    Minion minion1(Cards::FindCardByDbfID(49169));
+    board1.Add(minion1);
+
+    CombatStats stats = estimator.Estimate(board1, 4, board2, 1, 100);
+    CHECK_EQ(stats.numRuns, 100);
+    CHECK_EQ(stats.numWins, 100);
+    CHECK_EQ(stats.GetWinRate(), 1.0);
+    CHECK_EQ(stats.damageDealt[8], 100);
+    CHECK_EQ(stats.GetExpectedDamage(), 8.0);
+
+    Minion minion2(Cards::FindCardByDbfID(42467));
+    Minion minion3(Cards::FindCardByDbfID(60628));
+    FieldZone board3;
+    FieldZone board4;
+    board3.Add(minion2);
+    board4.Add(minion3);
+
+    stats = estimator.Estimate(board3, 1, board4, 3, 100);
+    CHECK_EQ(stats.numRuns, 100);
+    CHECK_EQ(stats.numLosses, 100);
+    CHECK_EQ(stats.GetLossRate(), 1.0);
+    CHECK_EQ(stats.damageTaken[4], 100);
+    CHECK_EQ(stats.GetExpectedDamage(), -4.0);
+
+    stats = estimator.Estimate(board3, 1, board4, 3, 0);
+    CHECK_EQ(stats.numRuns, 0);
+    CHECK_EQ(stats.GetWinRate(), 0.0);
+}
+
+TEST_CASE("[CombatEstimator] - Random result")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    ThreadPool pool1(1);
+    ThreadPool pool4(4);
+    CombatEstimator estimator1(pool1);
+    CombatEstimator estimator4(pool4);
+
+    FieldZone board1;
+    FieldZone board2;
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+    board1.Add(minion1);
+    board1.Add(minion2);
+    board2.Add(minion1);
+    board2.Add(minion2);
+
+    const CombatStats stats1 =
+        estimator1.Estimate(board1, 2, board2, 2, 1000, 42);
+    const CombatStats stats4 =
+        estimator4.Estimate(board1, 2, board2, 2, 1000, 42);
+
+    CHECK_EQ(stats1.numRuns, 1000);
+    CHECK_EQ(stats1.numWins + stats1.numTies + stats1.numLosses, 1000);
+    CHECK_GT(stats1.numWins, 0);
+    CHECK_GT(stats1.numLosses, 0);
+
+    // The result doesn't depend on the number of threads
+    CHECK_EQ(stats1.numWins, stats4.numWins);
+    CHECK_EQ(stats1.numTies, stats4.numTies);
+    CHECK_EQ(stats1.numLosses, stats4.numLosses);
+    CHECK_EQ(stats1.damageDealt, stats4.damageDealt);
+    CHECK_EQ(stats1.damageTaken, stats4.damageTaken);
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[Hero] - TakeDamage")
+{
+    Game game;
+    game.Start();
+
+    Player& player = game.GetGameState().players[0];
+    player.hero.Initialize(Cards::FindCardByDbfID(58536));
+
+    player.hero.TakeDamage(player, 39);
+    CHECK_EQ(player.hero.health, 1);
+    CHECK_EQ(player.playState, PlayState::PLAYING);
+
+    player.hero.TakeDamage(player, 1);
+    CHECK_EQ(player.playState, PlayState::LOST);
+    CHECK_EQ(player.rank, 8);
+    CHECK_EQ(game.GetGameState().numRemainPlayer, 7);
+
+    // The player who is already defeated fights as the ghost.
+    player.hero.TakeDamage(player, 5);
+    CHECK_EQ(player.hero.health, -5);
+    CHECK_EQ(player.rank, 8);
+    CHECK_EQ(game.GetGameState().numRemainPlayer, 7);
+}
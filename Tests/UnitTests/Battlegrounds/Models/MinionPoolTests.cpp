@@ -0,0 +1,129 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Models/MinionPool.hpp>
+
+#include <set>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[MinionPool] - AddMinionsToTavern and ReturnMinion")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    MinionPool pool;
+    pool.Initialize(Race::MURLOC);
+
+    const auto numTier1 = static_cast<int>(pool.GetMinions(1, 1, true).size());
+    const auto numTotal = static_cast<int>(pool.GetCount());
+    CHECK_EQ(pool.GetNumAvailableMinions(0), 0);
+    CHECK_EQ(pool.GetNumAvailableMinions(1), numTier1);
+    CHECK_EQ(pool.GetNumAvailableMinions(6), numTotal);
+
+    // Draws all minions of tier 1 without replacement
+    Player player;
+    player.currentTier = 1;
+
+    std::set<int> poolIndices;
+    while (pool.GetNumAvailableMinions(1) > 0)
+    {
+        Tavern tavern;
+        pool.AddMinionsToTavern(player, tavern);
+        CHECK(tavern.fieldZone.GetCount() > 0);
+
+        for (int i = 0; i < tavern.fieldZone.GetCount(); ++i)
+        {
+            const Minion& minion = tavern.fieldZone[i];
+            CHECK_EQ(minion.GetTier(), 1);
+            CHECK(poolIndices.insert(minion.GetPoolIndex()).second);
+        }
+    }
+
+    CHECK_EQ(static_cast<int>(poolIndices.size()), numTier1);
+    CHECK_EQ(pool.GetNumAvailableMinions(6), numTotal - numTier1);
+    CHECK(pool.GetMinions(1, 1, true).empty());
+
+    Tavern emptyTavern;
+    pool.AddMinionsToTavern(player, emptyTavern);
+    CHECK_EQ(emptyTavern.fieldZone.GetCount(), 0);
+
+    // Returns a minion twice, and an invalid index
+    const int idx = *poolIndices.begin();
+    pool.ReturnMinion(idx);
+    pool.ReturnMinion(idx);
+    pool.ReturnMinion(-1);
+    pool.ReturnMinion(numTotal);
+    CHECK_EQ(pool.GetNumAvailableMinions(1), 1);
+
+    Tavern tavern;
+    pool.AddMinionsToTavern(player, tavern);
+    CHECK_EQ(tavern.fieldZone.GetCount(), 1);
+    CHECK_EQ(tavern.fieldZone[0].GetPoolIndex(), idx);
+
+    // Returns all minions
+    for (const int poolIdx : poolIndices)
+    {
+        pool.ReturnMinion(poolIdx);
+    }
+    CHECK_EQ(pool.GetNumAvailableMinions(6), numTotal);
+
+    // Draws all minions of all tiers without replacement
+    player.currentTier = 6;
+    poolIndices.clear();
+    while (pool.GetNumAvailableMinions(6) > 0)
+    {
+        Tavern allTavern;
+        pool.AddMinionsToTavern(player, allTavern);
+
+        for (int i = 0; i < allTavern.fieldZone.GetCount(); ++i)
+        {
+            const int poolIdx = allTavern.fieldZone[i].GetPoolIndex();
+            CHECK_LT(poolIdx, numTotal);
+            CHECK(poolIndices.insert(poolIdx).second);
+        }
+    }
+    CHECK_EQ(static_cast<int>(poolIndices.size()), numTotal);
+}
+
+TEST_CASE("[MinionPool] - Copy")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    // Copying a pool doesn't copy the minions in it
+    CHECK_LT(sizeof(MinionPool), NUM_TOTAL_TAVERN_MINIONS * sizeof(Minion));
+
+    MinionPool pool;
+    pool.Initialize(Race::MURLOC);
+    const int numTotal = static_cast<int>(pool.GetCount());
+
+    Player player;
+    player.currentTier = 6;
+
+    MinionPool copy = pool;
+    Tavern tavern;
+    copy.AddMinionsToTavern(player, tavern);
+    CHECK_EQ(copy.GetNumAvailableMinions(6),
+             numTotal - tavern.fieldZone.GetCount());
+    CHECK_EQ(pool.GetNumAvailableMinions(6), numTotal);
+
+    // Drawn minions are made from the cards of their pool index
+    const std::vector<Minion> minions = pool.GetMinions(1, 6, false);
+    for (int i = 0; i < tavern.fieldZone.GetCount(); ++i)
+    {
+        const Minion& minion = tavern.fieldZone[i];
+        const int poolIdx = minion.GetPoolIndex();
+        CHECK_EQ(minions[poolIdx].GetPoolIndex(), poolIdx);
+        CHECK_EQ(minions[poolIdx].GetCard().id, minion.GetCard().id);
+        CHECK_EQ(minion.GetHealth(), minion.GetCard().GetHealth());
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[Player] - UpgradeTavern")
+{
+    Game game;
+    game.Start();
+
+    Player& player = game.GetGameState().players[0];
+    player.currentTier = 1;
+    player.remainCoin = 10;
+
+    for (int tier = 2; tier <= TIER_UPPER_LIMIT; ++tier)
+    {
+        player.coinToUpgradeTavern = 1;
+        CHECK_NOTHROW(player.UpgradeTavern());
+        CHECK_EQ(player.currentTier, tier);
+    }
+
+    // Tavern can't be upgraded anymore
+    const int remainCoin = player.remainCoin;
+    CHECK_NOTHROW(player.UpgradeTavern());
+    CHECK_EQ(player.currentTier, TIER_UPPER_LIMIT);
+    CHECK_EQ(player.remainCoin, remainCoin);
+}
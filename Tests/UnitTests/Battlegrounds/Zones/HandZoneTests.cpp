@@ -0,0 +1,41 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Zones/HandZone.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[HandZone] - Copy Assignment")
+{
+    // Load cards
+    Cards::GetInstance();
+
+    HandZone hand1;
+    hand1.Add(Minion(Cards::FindCardByID("BGS_039")));
+    hand1.Add(Minion(Cards::FindCardByID("BOT_537")));
+
+    HandZone hand2;
+    hand2.Add(Minion(Cards::FindCardByID("BGS_061")));
+    hand2.Add(Minion(Cards::FindCardByID("BGS_061")));
+    hand2.Add(Minion(Cards::FindCardByID("BGS_061")));
+
+    hand2 = hand1;
+    CHECK_EQ(hand2.GetCount(), 2);
+    CHECK_EQ(std::get<Minion>(hand2[0]).GetCard().id, "BGS_039");
+    CHECK_EQ(std::get<Minion>(hand2[1]).GetCard().id, "BOT_537");
+    CHECK_EQ(std::get<Minion>(hand2[1]).GetZonePosition(), 1);
+
+    // The copy doesn't share cards with the original
+    hand2.Remove(hand2[0]);
+    CHECK_EQ(hand1.GetCount(), 2);
+    CHECK_EQ(hand2.GetCount(), 1);
+    CHECK_EQ(std::get<Minion>(hand1[0]).GetCard().id, "BGS_039");
+    CHECK_EQ(std::get<Minion>(hand2[0]).GetCard().id, "BOT_537");
+}
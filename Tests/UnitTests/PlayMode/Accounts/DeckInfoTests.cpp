@@ -50,12 +50,42 @@ TEST_CASE("[DeckInfo] - CardControl")
 
     CHECK_EQ(deck.GetCard(0).second, 2u);
     CHECK(deck.DeleteCard(mageCards.at(0)->id, 1));
-    // CHECK_EQ(deck.GetCard(0).second, 1u);
+    CHECK_EQ(deck.GetCard(0).second, 1u);
+    CHECK_EQ(deck.GetNumOfCards(), 1u);
     CHECK_FALSE(deck.DeleteCard(mageCards.at(0)->id, 4));
     CHECK_FALSE(deck.DeleteCard(druidCards.at(0)->id, 1));
     CHECK_NOTHROW(deck.ShowCardList());
 }
 
+TEST_CASE("[DeckInfo] - DeleteCard")
+{
+    std::vector<Card*> mageCards =
+        Cards::GetInstance().FindCardByClass(CardClass::MAGE);
+
+    DeckInfo deck("Ice Magician", CardClass::MAGE);
+    deck.AddCard(mageCards.at(0)->id, 2);
+    deck.AddCard(mageCards.at(1)->id, 1);
+    CHECK_EQ(deck.GetNumOfCards(), 3u);
+
+    // Deletes only the given number of copies
+    CHECK(deck.DeleteCard(mageCards.at(0)->id, 1));
+    CHECK_EQ(deck.GetNumCardInDeck(mageCards.at(0)->id), 1u);
+    CHECK_EQ(deck.GetUniqueNumOfCards(), 2u);
+    CHECK_EQ(deck.GetNumOfCards(), 2u);
+
+    // Fails without changing the deck if there are not enough copies
+    CHECK_FALSE(deck.DeleteCard(mageCards.at(0)->id, 2));
+    CHECK_EQ(deck.GetNumCardInDeck(mageCards.at(0)->id), 1u);
+    CHECK_EQ(deck.GetNumOfCards(), 2u);
+
+    // Removes the card from the deck when the last copy is deleted
+    CHECK(deck.DeleteCard(mageCards.at(0)->id, 1));
+    CHECK_EQ(deck.GetNumCardInDeck(mageCards.at(0)->id), 0u);
+    CHECK_EQ(deck.GetUniqueNumOfCards(), 1u);
+    CHECK_EQ(deck.GetNumOfCards(), 1u);
+    CHECK_EQ(deck.GetCardIDs().size(), 1u);
+}
+
 TEST_CASE("[DeckInfo] - GetNumCardInDeck")
 {
     std::vector<Card*> mageCards =
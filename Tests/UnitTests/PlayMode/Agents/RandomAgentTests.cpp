@@ -0,0 +1,44 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[RandomAgent] - PlayTurn")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    SeedRandom(5, 0);
+    Game game(config);
+    game.Start();
+
+    // Each call plays exactly one turn
+    for (int turn = 1; turn <= 10 && game.state != State::COMPLETE; ++turn)
+    {
+        CHECK_EQ(game.GetTurn(), turn);
+        CHECK_EQ(game.GetCurrentPlayer(),
+                 turn % 2 == 1 ? game.GetPlayer1() : game.GetPlayer2());
+
+        RandomAgent::PlayTurn(game);
+        CHECK((game.state == State::COMPLETE || game.GetTurn() == turn + 1));
+    }
+
+    // Plays the rest of the game
+    const PlayState playState = RandomAgent::PlayGame(game);
+    CHECK_NE(playState, PlayState::PLAYING);
+}
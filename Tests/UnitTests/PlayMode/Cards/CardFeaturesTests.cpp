@@ -0,0 +1,109 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[CardFeatures] - GetInstance")
+{
+    const CardFeatures& features = CardFeatures::GetInstance();
+    const std::size_t numFeatures = CardFeatures::NUM_FEATURES;
+
+    CHECK_EQ(static_cast<int>(features.GetNumCards()), NUM_ALL_CARDS);
+
+    // Cards are sorted by dbfID and can be found by id or dbfID
+    const std::int32_t* data = features.GetData();
+    for (std::size_t i = 1; i < features.GetNumCards(); ++i)
+    {
+        CHECK_LE(data[(i - 1) * numFeatures + CardFeatures::DBF_ID],
+                 data[i * numFeatures + CardFeatures::DBF_ID]);
+    }
+
+    Card* crocolisk = Cards::FindCardByName("River Crocolisk");
+    const std::size_t idx = features.GetIndexByDbfID(crocolisk->dbfID);
+    CHECK_EQ(features.GetIndexByID(crocolisk->id), idx);
+    CHECK_EQ(features.GetCard(idx), crocolisk);
+
+    const std::int32_t* row = data + idx * numFeatures;
+    CHECK_EQ(row[CardFeatures::COST], 2);
+    CHECK_EQ(row[CardFeatures::ATTACK], 2);
+    CHECK_EQ(row[CardFeatures::HEALTH], 3);
+    CHECK_EQ(row[CardFeatures::CARD_TYPE], static_cast<int>(CardType::MINION));
+    CHECK_EQ(row[CardFeatures::RACE], static_cast<int>(Race::BEAST));
+    CHECK_EQ(row[CardFeatures::KEYWORD_BITS], 0);
+
+    // The health of a weapon is its durability
+    Card* axe = Cards::FindCardByName("Fiery War Axe");
+    row = data + features.GetIndexByDbfID(axe->dbfID) * numFeatures;
+    CHECK_EQ(row[CardFeatures::ATTACK], 3);
+    CHECK_EQ(row[CardFeatures::HEALTH], 2);
+
+    // Divine Shield is the second keyword
+    Card* squire = Cards::FindCardByName("Argent Squire");
+    row = data + features.GetIndexByDbfID(squire->dbfID) * numFeatures;
+    CHECK_EQ(row[CardFeatures::KEYWORD_BITS], 1 << 1);
+
+    // Every card is found at its own row by dbfID
+    for (std::size_t i = 0; i < features.GetNumCards(); ++i)
+    {
+        CHECK_EQ(features.GetIndexByDbfID(features.GetCard(i)->dbfID), i);
+    }
+
+    const int maxDbfID =
+        data[(features.GetNumCards() - 1) * numFeatures + CardFeatures::DBF_ID];
+    CHECK_THROWS_AS(features.GetIndexByDbfID(maxDbfID + 1),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(features.GetIndexByDbfID(-1), std::invalid_argument);
+    CHECK_THROWS_AS(features.GetIndexByID("INVALID"), std::invalid_argument);
+    CHECK_THROWS_AS(features.GetCard(features.GetNumCards()),
+                    std::invalid_argument);
+}
+
+TEST_CASE("[CardFeatures] - Save")
+{
+    const std::vector<Card*> cards = { Cards::FindCardByName("Wisp"),
+                                       Cards::FindCardByName("Fireball") };
+    const CardFeatures features(cards);
+
+    const std::string path = "CardFeaturesTests.bin";
+    features.Save(path);
+
+    std::ifstream fileInput(path, std::ios::binary);
+    char magic[8] = {};
+    std::uint32_t numCards = 0;
+    std::uint32_t numFeatures = 0;
+    std::vector<std::int32_t> data(cards.size() * CardFeatures::NUM_FEATURES);
+
+    fileInput.read(magic, sizeof(magic));
+    fileInput.read(reinterpret_cast<char*>(&numCards), sizeof(numCards));
+    fileInput.read(reinterpret_cast<char*>(&numFeatures),
+                   sizeof(numFeatures));
+    CHECK_EQ(static_cast<std::size_t>(fileInput.tellg()),
+             CardFeatures::HEADER_SIZE);
+    fileInput.read(reinterpret_cast<char*>(data.data()),
+                   static_cast<std::streamsize>(data.size() *
+                                                sizeof(std::int32_t)));
+    fileInput.close();
+    std::remove(path.c_str());
+
+    CHECK_EQ(std::string(magic, sizeof(magic)), "RSCFEAT1");
+    CHECK_EQ(numCards, 2);
+    CHECK_EQ(numFeatures, CardFeatures::NUM_FEATURES);
+    CHECK_EQ(data, std::vector<std::int32_t>(
+                       features.GetData(),
+                       features.GetData() + data.size()));
+}
@@ -6,8 +6,13 @@
 
 #include "doctest_proxy.hpp"
 
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Utils/DeckCode.hpp>
 
+#include <string>
+#include <vector>
+
 using namespace RosettaStone;
 using namespace PlayMode;
 
@@ -82,3 +87,98 @@ TEST_CASE("[DeckString] - Decode")
     CHECK_EQ(info.GetNumCardInDeck("DAL_378"), 2);   // Unleash the Beast
     CHECK_EQ(info.GetNumCardInDeck("TRL_065"), 1);   // Zul'jin
 }
+
+TEST_CASE("[DeckString] - DecodeBatch and EncodeBatch")
+{
+    constexpr std::size_t MAX_CARDS = DeckCodeBatch::MAX_CARDS;
+
+    const std::vector<std::string_view> deckCodes = {
+        "AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=",
+        "AAECAR8I",
+        "AQECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=",
+        "AAICAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=",
+        "AAESAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=",
+        "AAECAh8FCMcDhwTJBK4GoIADp4IDm4UD1pkDC54BqAK1A8UI/gyY8ALv8QL1iQPmlgP5"
+        "lgO+mAMA",
+        "AAECAQAIxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=",
+        "AAECAR8I!",
+        "",
+        "AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMAC54BAqgCArUDAsUIAv4MApjwAgLv8QIC9Y"
+        "kDAuaWAwL5lgMCvpgDAg=="
+    };
+
+    ThreadPool pool(2);
+    const DeckCodeBatch batch = DeckCode::DecodeBatch(pool, deckCodes);
+    CHECK_EQ(batch.size, deckCodes.size());
+
+    const auto getError = [&](std::size_t row) {
+        return static_cast<DeckCodeError>(batch.errors[row]);
+    };
+    const auto getNumCards = [&](std::size_t row) {
+        int numCards = 0;
+        for (std::size_t i = 0; i < MAX_CARDS; ++i)
+        {
+            numCards += batch.counts[row * MAX_CARDS + i];
+        }
+        return numCards;
+    };
+
+    CHECK_EQ(getError(0), DeckCodeError::NONE);
+    CHECK_EQ(getError(1), DeckCodeError::UNEXPECTED_EOF);
+    CHECK_EQ(getError(2), DeckCodeError::INVALID_DECK_CODE);
+    CHECK_EQ(getError(3), DeckCodeError::VERSION_MISMATCH);
+    CHECK_EQ(getError(4), DeckCodeError::INVALID_FORMAT);
+    CHECK_EQ(getError(5), DeckCodeError::INVALID_HERO_COUNT);
+    CHECK_EQ(getError(6), DeckCodeError::INVALID_HERO);
+    CHECK_EQ(getError(7), DeckCodeError::INVALID_BASE64);
+    CHECK_EQ(getError(8), DeckCodeError::INVALID_BASE64);
+    CHECK_EQ(getError(9), DeckCodeError::NONE);
+
+    // The rows match the deck decoded one at a time
+    DeckInfo info = DeckCode::Decode(deckCodes[0]);
+    for (const std::size_t row : { 0u, 9u })
+    {
+        CHECK_EQ(Cards::FindCardByDbfID(batch.heroes[row])->GetCardClass(),
+                 CardClass::HUNTER);
+        CHECK_EQ(batch.formats[row], static_cast<int>(FormatType::STANDARD));
+        CHECK_EQ(getNumCards(row), 30);
+
+        for (std::size_t i = 0; i < MAX_CARDS; ++i)
+        {
+            const int dbfID = batch.dbfIDs[row * MAX_CARDS + i];
+            if (dbfID == 0)
+            {
+                continue;
+            }
+
+            const auto count = static_cast<std::size_t>(
+                batch.counts[row * MAX_CARDS + i]);
+            CHECK_EQ(info.GetNumCardInDeck(Cards::FindCardByDbfID(dbfID)->id),
+                     count);
+        }
+    }
+
+    // Failed rows are filled with 0
+    CHECK_EQ(batch.heroes[1], 0);
+    CHECK_EQ(getNumCards(1), 0);
+
+    // Encoding makes the canonical deck code and skips failed rows
+    const std::vector<std::string> encoded =
+        DeckCode::EncodeBatch(pool, batch);
+    CHECK_EQ(encoded[0], std::string(deckCodes[0]));
+    CHECK_EQ(encoded[9], std::string(deckCodes[0]));
+    CHECK(encoded[1].empty());
+
+    const std::vector<std::string_view> encodedViews(encoded.begin(),
+                                                     encoded.end());
+    const DeckCodeBatch batch2 = DeckCode::DecodeBatch(pool, encodedViews);
+    CHECK_EQ(batch2.errors[0], batch.errors[0]);
+    CHECK_EQ(batch2.errors[9], batch.errors[9]);
+    CHECK_EQ(batch2.dbfIDs, batch.dbfIDs);
+    CHECK_EQ(batch2.counts, batch.counts);
+}
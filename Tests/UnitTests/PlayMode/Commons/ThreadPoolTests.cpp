@@ -0,0 +1,54 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[ThreadPool] - ParallelFor")
+{
+    ThreadPool pool(4);
+    CHECK_EQ(pool.GetNumThreads(), 4);
+
+    std::vector<int> values(1000, 0);
+    pool.ParallelFor(values.size(), [&](std::size_t idx) {
+        values[idx] += static_cast<int>(idx);
+    });
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        CHECK_EQ(values[i], static_cast<int>(i));
+    }
+
+    // Runs again to check the pool can be reused
+    std::atomic<int> count = 0;
+    pool.ParallelFor(100, [&](std::size_t) { ++count; });
+    CHECK_EQ(count, 100);
+}
+
+TEST_CASE("[ThreadPool] - ParallelFor Exception")
+{
+    ThreadPool pool(2);
+
+    CHECK_THROWS_AS(pool.ParallelFor(10,
+                                     [](std::size_t idx) {
+                                         if (idx == 5)
+                                         {
+                                             throw std::logic_error("Test");
+                                         }
+                                     }),
+                    std::logic_error);
+
+    std::atomic<int> count = 0;
+    pool.ParallelFor(10, [&](std::size_t) { ++count; });
+    CHECK_EQ(count, 10);
+}
@@ -17,4 +17,15 @@ TEST_CASE("[Base64] - Decode")
     CHECK_EQ(decoded[1], 2);
     CHECK_EQ(decoded[2], 3);
     CHECK_EQ(decoded[3], 4);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Base64] - Encode")
+{
+    CHECK_EQ(EncodeBase64({ 1, 2, 3, 4 }), "AQIDBA==");
+    CHECK_EQ(EncodeBase64({ 1, 2, 3, 4, 5 }), "AQIDBAU=");
+    CHECK_EQ(EncodeBase64({ 1, 2, 3 }), "AQID");
+    CHECK(EncodeBase64({}).empty());
+
+    const std::vector<unsigned char> bytes = { 0, 255, 128 };
+    CHECK_EQ(DecodeBase64(EncodeBase64(bytes)), bytes);
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/CardSetUtils.hpp>
+
+#include <Rosetta/PlayMode/Actions/Draw.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Environments/ActionSpace.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[ActionSpace] - GetActionMask and Decode")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    // NOTE: Clear the hand to know the position of each card.
+    auto& handZone = *curPlayer->GetHandZone();
+    while (!handZone.IsEmpty())
+    {
+        handZone.Remove(handZone[0]);
+    }
+
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Fireball"));
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+
+    constexpr std::size_t ownHero = 1;
+    constexpr std::size_t opHero = MAX_FIELD_SIZE + 2;
+
+    std::vector<std::uint8_t> mask(ActionSpace::SIZE);
+    std::size_t numActions =
+        ActionSpace::GetActionMask(*curPlayer, mask.data());
+
+    // Fireball: own hero, opponent hero
+    // Wisp x 2: no target at position 0
+    // Fireblast: own hero, opponent hero
+    // End turn
+    CHECK_EQ(numActions, 7);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, ownHero, 0, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, opHero, 0, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, 0, 0, 0)], 0);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(1, 0, 0, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(1, 0, 1, 0)], 0);
+    CHECK_EQ(mask[ActionSpace::HeroPowerAction(ownHero)], 1);
+    CHECK_EQ(mask[ActionSpace::HeroPowerAction(opHero)], 1);
+    CHECK_EQ(mask[ActionSpace::END_TURN], 1);
+
+    game.Process(curPlayer, ActionSpace::Decode(
+                                *curPlayer, ActionSpace::PlayCardAction(
+                                                1, 0, 0, 0)));
+    CHECK_EQ(curPlayer->GetFieldZone()->GetCount(), 1);
+
+    // The second wisp can be placed at both sides of the first wisp
+    ActionSpace::GetActionMask(*curPlayer, mask.data());
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(1, 0, 0, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(1, 0, 1, 0)], 1);
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(1, 0, 2, 0)], 0);
+
+    // Fireball can target the wisp
+    CHECK_EQ(mask[ActionSpace::PlayCardAction(0, ownHero + 1, 0, 0)], 1);
+
+    game.Process(curPlayer,
+                 ActionSpace::Decode(*curPlayer,
+                                     ActionSpace::HeroPowerAction(opHero)));
+    CHECK_EQ(opPlayer->GetHero()->GetHealth(), 29);
+
+    ActionSpace::GetActionMask(*curPlayer, mask.data());
+    CHECK_EQ(mask[ActionSpace::HeroPowerAction(opHero)], 0);
+
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::AttackAction(1, 0)),
+             ActionType::ATTACK);
+    CHECK_EQ(ActionSpace::GetActionType(ActionSpace::END_TURN),
+             ActionType::END_TURN);
+    CHECK_THROWS_AS(ActionSpace::GetActionType(ActionSpace::SIZE),
+                    std::invalid_argument);
+
+    // Empty slots can't be decoded
+    CHECK_THROWS_AS(ActionSpace::Decode(
+                        *curPlayer, ActionSpace::PlayCardAction(5, 0, 0, 0)),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(
+        ActionSpace::Decode(*curPlayer, ActionSpace::AttackAction(3, 0)),
+        std::invalid_argument);
+    CHECK_THROWS_AS(
+        ActionSpace::Decode(*curPlayer, ActionSpace::ChooseAction(0)),
+        std::invalid_argument);
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
+#include <Rosetta/PlayMode/Environments/DeltaEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[DeltaEncoder] - Encode")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    SeedRandom(3, 0);
+    Game game(config);
+    game.Start();
+
+    DeltaEncoder encoder(PlayerType::PLAYER1);
+    std::vector<float> obs(ObservationEncoder::SIZE, -1.0f);
+    std::vector<float> prevObs;
+    std::vector<float> fullObs(ObservationEncoder::SIZE);
+
+    // The first call writes all values
+    encoder.Encode(game, obs.data());
+    CHECK_EQ(encoder.GetChangedRanges().size(), 1);
+    CHECK_EQ(encoder.GetChangedRanges()[0].first, 0);
+    CHECK_EQ(encoder.GetChangedRanges()[0].second, ObservationEncoder::SIZE);
+
+    // Nothing changes without a task
+    encoder.Encode(game, obs.data());
+    CHECK(encoder.GetChangedRanges().empty());
+
+    int numTasks = 0;
+    while (game.state != State::COMPLETE && numTasks < 300)
+    {
+        Player* player = game.GetCurrentPlayer();
+        game.Process(player, RandomAgent::GetRandomTask(player));
+        ++numTasks;
+
+        prevObs = obs;
+        encoder.Encode(game, obs.data());
+        ObservationEncoder::Encode(game, PlayerType::PLAYER1, fullObs.data());
+        CHECK(obs == fullObs);
+
+        // Values outside of changed ranges are untouched
+        std::vector<bool> isChanged(ObservationEncoder::SIZE, false);
+        for (const auto& [begin, end] : encoder.GetChangedRanges())
+        {
+            std::fill(isChanged.begin() + begin, isChanged.begin() + end,
+                      true);
+        }
+
+        int numUntracked = 0;
+        for (std::size_t i = 0; i < ObservationEncoder::SIZE; ++i)
+        {
+            if (!isChanged[i] && obs[i] != prevObs[i])
+            {
+                ++numUntracked;
+            }
+        }
+        CHECK_EQ(numUntracked, 0);
+    }
+
+    // Reset writes all values again
+    encoder.Reset();
+    encoder.Encode(game, obs.data());
+    CHECK_EQ(encoder.GetChangedRanges()[0].second, ObservationEncoder::SIZE);
+}
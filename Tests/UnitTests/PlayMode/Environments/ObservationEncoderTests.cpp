@@ -0,0 +1,178 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/CardSetUtils.hpp>
+
+#include <Rosetta/PlayMode/Actions/Draw.hpp>
+#include <Rosetta/PlayMode/Cards/CardFeatures.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Environments/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace PlayerTasks;
+
+TEST_CASE("[ObservationEncoder] - Encode")
+{
+    using Encoder = ObservationEncoder;
+    const CardFeatures& features = CardFeatures::GetInstance();
+
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    Card* crocolisk = Cards::FindCardByName("River Crocolisk");
+    const auto card1 = Generic::DrawCard(curPlayer, crocolisk);
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+
+    std::vector<float> obs(Encoder::SIZE, -1.0f);
+    Encoder::Encode(game, PlayerType::PLAYER1, obs.data());
+
+    // Global
+    CHECK_EQ(obs[0], 1.0f);
+    CHECK_EQ(obs[1], 1.0f);
+
+    // Hero and mana of player 1
+    const float* player = obs.data() + Encoder::GLOBAL_SIZE;
+    CHECK_EQ(player[0], 30.0f);
+    CHECK_EQ(player[5], 0.0f);
+    CHECK_EQ(player[10], 10.0f);
+    CHECK_EQ(player[11], 2.0f);
+    CHECK_EQ(player[13], 8.0f);
+    CHECK_EQ(player[16],
+             static_cast<float>(curPlayer->GetHandZone()->GetCount()));
+    CHECK_EQ(player[17],
+             static_cast<float>(curPlayer->GetDeckZone()->GetCount()));
+    CHECK_EQ(player[18], 1.0f);
+
+    // Field of player 1
+    const float* minion = player + Encoder::FIELD_OFFSET;
+    CHECK_EQ(minion[0], 1.0f);
+    CHECK_EQ(features.GetCard(static_cast<std::size_t>(minion[1]) - 1),
+             crocolisk);
+    CHECK_EQ(minion[2], 2.0f);
+    CHECK_EQ(minion[3], 3.0f);
+    CHECK_EQ(minion[5], 0.0f);
+    CHECK_EQ(minion[Encoder::MINION_SIZE], 0.0f);
+
+    // Hand of player 1
+    const float* hand = player + Encoder::HAND_OFFSET;
+    const Playable* firstCard = (*curPlayer->GetHandZone())[0];
+    CHECK_EQ(hand[0], 1.0f);
+    CHECK_EQ(features.GetCard(static_cast<std::size_t>(hand[1]) - 1),
+             firstCard->card);
+    CHECK_EQ(hand[2], static_cast<float>(firstCard->GetCost()));
+
+    // Player 2 is encoded after player 1
+    const float* opponent = player + Encoder::PLAYER_SIZE;
+    CHECK_EQ(opponent[18], 0.0f);
+    CHECK_EQ(opponent[16],
+             static_cast<float>(opPlayer->GetHandZone()->GetCount()));
+
+    // The perspective of player 2 swaps blocks
+    Encoder::Encode(game, PlayerType::PLAYER1, obs.data(), false);
+    std::vector<int> obs2(Encoder::SIZE, -1);
+    Encoder::Encode(game, PlayerType::PLAYER2, obs2.data(), false);
+
+    CHECK_EQ(obs2[1], 0);
+    for (std::size_t i = 0; i < Encoder::PLAYER_SIZE; ++i)
+    {
+        CHECK_EQ(static_cast<float>(obs2[Encoder::GLOBAL_SIZE + i]),
+                 opponent[i]);
+        CHECK_EQ(
+            static_cast<float>(
+                obs2[Encoder::GLOBAL_SIZE + Encoder::PLAYER_SIZE + i]),
+            player[i]);
+    }
+}
+
+TEST_CASE("[ObservationEncoder] - Encode with hidden information")
+{
+    using Encoder = ObservationEncoder;
+    const CardFeatures& features = CardFeatures::GetInstance();
+
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    opPlayer->SetTotalMana(10);
+    opPlayer->SetUsedMana(0);
+    const auto secret =
+        Generic::DrawCard(opPlayer, Cards::FindCardByName("Counterspell"));
+    game.Process(opPlayer, PlayCardTask::Spell(secret));
+    game.Process(opPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    const int handCount = opPlayer->GetHandZone()->GetCount();
+    std::vector<float> obs(Encoder::SIZE, -1.0f);
+    Encoder::Encode(game, PlayerType::PLAYER1, obs.data());
+
+    // The counts of player 2 are public
+    const float* opponent = obs.data() + Encoder::GLOBAL_SIZE +
+                            Encoder::PLAYER_SIZE;
+    CHECK_EQ(opponent[16], static_cast<float>(handCount));
+    CHECK_EQ(opponent[17],
+             static_cast<float>(opPlayer->GetDeckZone()->GetCount()));
+    CHECK_EQ(opponent[19], 1.0f);
+
+    // The cards in hand keep only their slots
+    for (int i = 0; i < handCount; ++i)
+    {
+        const float* hand =
+            opponent + Encoder::HAND_OFFSET + i * Encoder::HAND_CARD_SIZE;
+        CHECK_EQ(hand[0], 1.0f);
+        CHECK_EQ(hand[1], 0.0f);
+        CHECK_EQ(hand[2], 0.0f);
+    }
+
+    // The secret keeps its slot and card class
+    const float* secretSlot = opponent + Encoder::SECRET_OFFSET;
+    CHECK_EQ(secretSlot[0], 1.0f);
+    CHECK_EQ(secretSlot[1], 0.0f);
+    CHECK_EQ(secretSlot[2], static_cast<float>(CardClass::MAGE));
+
+    // Player 2 knows its own cards
+    Encoder::Encode(game, PlayerType::PLAYER2, obs.data());
+    const float* player = obs.data() + Encoder::GLOBAL_SIZE;
+    CHECK_EQ(features.GetCard(static_cast<std::size_t>(
+                 player[Encoder::SECRET_OFFSET + 1]) - 1),
+             secret->card);
+    CHECK_EQ(features.GetCard(static_cast<std::size_t>(
+                 player[Encoder::HAND_OFFSET + 1]) - 1),
+             (*opPlayer->GetHandZone())[0]->card);
+}
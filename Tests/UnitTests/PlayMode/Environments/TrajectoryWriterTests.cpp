@@ -0,0 +1,211 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Environments/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Environments/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Environments/VecEnv.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+constexpr TrajectoryShape SHAPE{ 5, 7, 2 };
+
+// Appends \p numSteps steps whose values are made from the index of step.
+void AppendSteps(TrajectoryWriter& writer, int first, int numSteps)
+{
+    std::vector<float> observations;
+    std::vector<std::int32_t> actions;
+    std::vector<std::uint8_t> masks;
+    std::vector<float> rewards;
+    std::vector<std::uint8_t> dones;
+    std::vector<float> stats;
+
+    for (int step = first; step < first + numSteps; ++step)
+    {
+        for (std::size_t i = 0; i < SHAPE.observationSize; ++i)
+        {
+            observations.emplace_back(static_cast<float>(step * 10 + i));
+        }
+        for (std::size_t i = 0; i < SHAPE.actionSize; ++i)
+        {
+            masks.emplace_back(static_cast<std::uint8_t>((step + i) % 2));
+        }
+
+        actions.emplace_back(step);
+        rewards.emplace_back(static_cast<float>(step) * 0.5f);
+        dones.emplace_back(static_cast<std::uint8_t>(step % 3 == 0));
+        stats.emplace_back(static_cast<float>(step));
+        stats.emplace_back(static_cast<float>(-step));
+    }
+
+    writer.Append(numSteps, observations.data(), actions.data(), masks.data(),
+                  rewards.data(), dones.data(), stats.data());
+}
+
+// Checks that the chunks of \p reader hold steps [0, numSteps) in order.
+void CheckSteps(const TrajectoryReader& reader, int numSteps)
+{
+    CHECK_EQ(reader.GetNumSteps(), static_cast<std::size_t>(numSteps));
+
+    int step = 0;
+    for (std::size_t idx = 0; idx < reader.GetNumChunks(); ++idx)
+    {
+        const TrajectoryChunk chunk = reader.GetChunk(idx);
+        for (std::size_t i = 0; i < chunk.numSteps; ++i, ++step)
+        {
+            CHECK_EQ(chunk.actions[i], step);
+            CHECK_EQ(chunk.observations[i * SHAPE.observationSize + 4],
+                     static_cast<float>(step * 10 + 4));
+            CHECK_EQ(chunk.masks[i * SHAPE.actionSize + 3], (step + 3) % 2);
+            CHECK_EQ(chunk.rewards[i], static_cast<float>(step) * 0.5f);
+            CHECK_EQ(chunk.dones[i], step % 3 == 0 ? 1 : 0);
+            CHECK_EQ(chunk.stats[i * SHAPE.numStats + 1],
+                     static_cast<float>(-step));
+        }
+    }
+
+    CHECK_EQ(step, numSteps);
+}
+}  // namespace
+
+TEST_CASE("[TrajectoryWriter] - Write and read")
+{
+    const std::string path = "TrajectoryWriterTests.bin";
+
+    {
+        TrajectoryWriter writer(path, SHAPE, 4);
+        AppendSteps(writer, 0, 3);
+        AppendSteps(writer, 3, 7);
+        CHECK_EQ(writer.GetNumSteps(), 10u);
+        writer.Close();
+
+        CHECK_THROWS_AS(AppendSteps(writer, 10, 1), std::logic_error);
+    }
+
+    TrajectoryReader reader(path);
+    CHECK_EQ(reader.GetShape().observationSize, SHAPE.observationSize);
+    CHECK_EQ(reader.GetShape().actionSize, SHAPE.actionSize);
+    CHECK_EQ(reader.GetShape().numStats, SHAPE.numStats);
+    CHECK_EQ(reader.GetChunkSize(), 4u);
+
+    // Two full chunks and the rest
+    CHECK_EQ(reader.GetNumChunks(), 3u);
+    CHECK_EQ(reader.GetChunk(2).numSteps, 2u);
+    CheckSteps(reader, 10);
+
+    CHECK_THROWS_AS(reader.GetChunk(3), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[TrajectoryWriter] - Read a file that isn't closed")
+{
+    const std::string path = "TrajectoryWriterTests2.bin";
+
+    TrajectoryWriter writer(path, SHAPE, 4);
+    AppendSteps(writer, 0, 6);
+    writer.Flush();
+
+    {
+        // NOTE: The chunks are found by scanning without the index.
+        TrajectoryReader reader(path);
+        CHECK_EQ(reader.GetNumChunks(), 2u);
+        CheckSteps(reader, 6);
+    }
+
+    AppendSteps(writer, 6, 2);
+    writer.Close();
+
+    TrajectoryReader reader(path);
+    CHECK_EQ(reader.GetNumChunks(), 3u);
+    CheckSteps(reader, 8);
+
+    std::remove(path.c_str());
+    CHECK_THROWS_AS(TrajectoryReader{ path }, std::runtime_error);
+}
+
+TEST_CASE("[TrajectoryWriter] - Limit pending chunks")
+{
+    const std::string path = "TrajectoryWriterTests5.bin";
+
+    CHECK_THROWS_AS(TrajectoryWriter(path, SHAPE, 4, 0),
+                    std::invalid_argument);
+
+    {
+        // NOTE: Append() waits for the background thread on every chunk.
+        TrajectoryWriter writer(path, SHAPE, 2, 1);
+        AppendSteps(writer, 0, 100);
+        AppendSteps(writer, 100, 101);
+        writer.Close();
+    }
+
+    TrajectoryReader reader(path);
+    CHECK_EQ(reader.GetNumChunks(), 101u);
+    CheckSteps(reader, 201);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[TrajectoryWriter] - Step VecEnv with writer")
+{
+    const std::string path = "TrajectoryWriterTests3.bin";
+
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    ThreadPool pool(2);
+    VecEnv env(pool, config, 3, 7);
+    env.Reset();
+
+    const std::vector<float> observations(
+        env.GetObservations(),
+        env.GetObservations() + 3 * VecEnv::OBSERVATION_SIZE);
+    const std::vector<int> actions(3, static_cast<int>(ActionSpace::END_TURN));
+    const std::vector<float> stats = { 0.1f, 0.2f, 0.3f };
+
+    TrajectoryWriter writer(
+        path, { VecEnv::OBSERVATION_SIZE, VecEnv::ACTION_SIZE, 1 }, 16);
+    env.Step(actions, writer, stats.data());
+    writer.Close();
+
+    // A step has the observation before the action and the reward after it
+    TrajectoryReader reader(path);
+    CHECK_EQ(reader.GetNumSteps(), 3u);
+
+    const TrajectoryChunk chunk = reader.GetChunk(0);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        CHECK_EQ(chunk.actions[i], actions[i]);
+        CHECK_EQ(chunk.rewards[i], env.GetRewards()[i]);
+        CHECK_EQ(chunk.dones[i], env.GetDones()[i]);
+        CHECK_EQ(chunk.stats[i], stats[i]);
+        CHECK_EQ(chunk.masks[i * VecEnv::ACTION_SIZE + ActionSpace::END_TURN],
+                 1);
+    }
+    CHECK(std::equal(observations.begin(), observations.end(),
+                     chunk.observations));
+
+    const std::string wrongPath = "TrajectoryWriterTests4.bin";
+    TrajectoryWriter wrongWriter(wrongPath, SHAPE, 16);
+    CHECK_THROWS_AS(env.Step(actions, wrongWriter), std::invalid_argument);
+    wrongWriter.Close();
+
+    std::remove(path.c_str());
+    std::remove(wrongPath.c_str());
+}
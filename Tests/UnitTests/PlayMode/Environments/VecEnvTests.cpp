@@ -0,0 +1,121 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Environments/VecEnv.hpp>
+
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    return config;
+}
+
+// Chooses the last valid action, which ends the turn if possible.
+std::vector<int> GetLastActions(VecEnv& env)
+{
+    std::vector<int> actions(env.GetNumEnvs(), 0);
+
+    for (std::size_t i = 0; i < env.GetNumEnvs(); ++i)
+    {
+        const std::uint8_t* mask =
+            env.GetActionMasks() + i * VecEnv::ACTION_SIZE;
+        for (std::size_t j = 0; j < VecEnv::ACTION_SIZE; ++j)
+        {
+            if (mask[j] != 0)
+            {
+                actions[i] = static_cast<int>(j);
+            }
+        }
+    }
+
+    return actions;
+}
+}  // namespace
+
+TEST_CASE("[VecEnv] - Reset")
+{
+    ThreadPool pool(2);
+    VecEnv env(pool, MakeConfig(), 4, 7);
+    env.Reset();
+
+    for (std::size_t i = 0; i < env.GetNumEnvs(); ++i)
+    {
+        const Game& game = env.GetGame(i);
+        CHECK_EQ(game.step, Step::MAIN_ACTION);
+        CHECK_EQ(game.GetCurrentPlayer()->playerType, PlayerType::PLAYER1);
+
+        // Player 1 can always end the turn
+        CHECK_EQ(env.GetActionMasks()[i * VecEnv::ACTION_SIZE +
+                                      ActionSpace::END_TURN],
+                 1);
+        CHECK_EQ(env.GetDones()[i], 0);
+    }
+
+    const int endTurn = static_cast<int>(ActionSpace::END_TURN);
+    CHECK_THROWS_AS(env.Step({ endTurn, endTurn }), std::invalid_argument);
+    CHECK_THROWS_AS(
+        env.Step({ endTurn, endTurn, endTurn,
+                   static_cast<int>(VecEnv::ACTION_SIZE) }),
+        std::invalid_argument);
+}
+
+TEST_CASE("[VecEnv] - Step")
+{
+    ThreadPool pool1(1);
+    ThreadPool pool4(4);
+    VecEnv env1(pool1, MakeConfig(), 4, 42);
+    VecEnv env4(pool4, MakeConfig(), 4, 42);
+    env1.Reset();
+    env4.Reset();
+
+    int numDones = 0;
+    for (int step = 0; step < 200; ++step)
+    {
+        env1.Step(GetLastActions(env1));
+        env4.Step(GetLastActions(env4));
+
+        for (std::size_t i = 0; i < env1.GetNumEnvs(); ++i)
+        {
+            // The result doesn't depend on the number of threads
+            CHECK_EQ(env1.GetDones()[i], env4.GetDones()[i]);
+            CHECK_EQ(env1.GetRewards()[i], env4.GetRewards()[i]);
+
+            if (env1.GetDones()[i] != 0)
+            {
+                ++numDones;
+
+                // The game is reset automatically
+                CHECK_EQ(env1.GetGame(i).state, State::RUNNING);
+            }
+            else
+            {
+                CHECK_EQ(env1.GetRewards()[i], 0.0f);
+            }
+        }
+
+        for (std::size_t i = 0;
+             i < env1.GetNumEnvs() * VecEnv::OBSERVATION_SIZE; ++i)
+        {
+            CHECK_EQ(env1.GetObservations()[i], env4.GetObservations()[i]);
+        }
+    }
+
+    // Player 1 only ends turns, so games end early
+    CHECK_GT(numDones, 0);
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GamePrototype.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[GamePrototype] - CreateGame")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
+        config.player2Deck[i] = Cards::FindCardByName("Fireball");
+    }
+
+    const GamePrototype prototype(config);
+    const Game& source = prototype.GetGame();
+    CHECK_EQ(source.GetPlayer1()->GetHero()->card->id, "HERO_01");
+    CHECK_EQ(source.GetPlayer2()->GetHero()->heroPower->card->id,
+             "HERO_08bp");
+    CHECK_EQ(source.GetPlayer1()->GetDeckZone()->GetCount(), 19);
+    CHECK_EQ(source.GetPlayer2()->GetDeckZone()->GetCount(), 19);
+
+    const auto game1 = prototype.CreateGame();
+    const auto game2 = prototype.CreateGame();
+    Game game3(config);
+
+    for (const Game* game : { game1.get(), game2.get(), &game3 })
+    {
+        const Player* player1 = game->GetPlayer1();
+        const Player* player2 = game->GetPlayer2();
+
+        CHECK_EQ(player1->GetHero()->card->id, "HERO_01");
+        CHECK_EQ(player2->GetHero()->card->id, "HERO_08");
+        CHECK_EQ(player1->baseClass, CardClass::WARRIOR);
+        CHECK_EQ(player2->baseClass, CardClass::MAGE);
+        CHECK_EQ(player1->GetDeckZone()->GetCount(), 19);
+        CHECK_EQ(player2->GetDeckZone()->GetCount(), 19);
+        CHECK_EQ(game->entityList.size(), game3.entityList.size());
+    }
+
+    for (int i = 0; i < 19; ++i)
+    {
+        const Playable* card1 = (*game1->GetPlayer1()->GetDeckZone())[i];
+        const Playable* card3 = (*game3.GetPlayer1()->GetDeckZone())[i];
+
+        CHECK_EQ(card1->card->id, card3->card->id);
+        CHECK_EQ(card1->GetGameTag(GameTag::ENTITY_ID),
+                 card3->GetGameTag(GameTag::ENTITY_ID));
+        CHECK_EQ(card1->GetGameTag(GameTag::CONTROLLER),
+                 card3->GetGameTag(GameTag::CONTROLLER));
+        CHECK_EQ(card1->GetZoneType(), ZoneType::DECK);
+
+        // Entities are copied, not shared with the prototype
+        const Playable* source1 = (*source.GetPlayer1()->GetDeckZone())[i];
+        CHECK_NE(card1, source1);
+        CHECK_EQ(card1->player, game1->GetPlayer1());
+        CHECK_EQ(card1->game, game1.get());
+        CHECK_EQ(card1->GetGameTag(GameTag::ENTITY_ID),
+                 source1->GetGameTag(GameTag::ENTITY_ID));
+    }
+
+    CHECK_NE(game1->GetPlayer1()->GetHero(), source.GetPlayer1()->GetHero());
+    CHECK_EQ(game1->GetPlayer1()->GetHero()->heroPower->player,
+             game1->GetPlayer1());
+    CHECK_EQ(game1->GetNextID(), game3.GetNextID());
+}
+
+TEST_CASE("[GamePrototype] - Independent Games")
+{
+    GameConfig config;
+    config.player1Class = CardClass::PRIEST;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    const GamePrototype prototype(config);
+
+    const auto game1 = prototype.CreateGame();
+    game1->Start();
+    game1->ProcessUntil(Step::MAIN_ACTION);
+
+    const auto game2 = prototype.CreateGame();
+
+    CHECK_EQ(game1->nextStep, Step::MAIN_ACTION);
+    CHECK_EQ(game1->GetPlayer1()->GetHandZone()->GetCount(), 4);
+    CHECK_EQ(game1->GetPlayer1()->GetDeckZone()->GetCount(), 5);
+    CHECK_EQ(game2->GetPlayer1()->GetHandZone()->GetCount(), 0);
+    CHECK_EQ(game2->GetPlayer1()->GetDeckZone()->GetCount(), 9);
+}
@@ -16,7 +16,7 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 using namespace RosettaStone;
 using namespace PlayMode;
@@ -0,0 +1,38 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[Player] - GetNumChanges")
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* player = game.GetPlayer1();
+    Entity* entity = player;
+    const std::size_t numChanges = player->GetNumChanges();
+
+    player->SetGameTag(GameTag::NUM_CARDS_PLAYED_THIS_TURN, 1);
+    CHECK_EQ(player->GetNumChanges(), numChanges + 1);
+
+    // Attributes and auras count changes through Entity
+    entity->IncreaseNumChanges();
+    CHECK_EQ(player->GetNumChanges(), numChanges + 2);
+    CHECK_EQ(entity->GetNumChanges(), player->GetNumChanges());
+}
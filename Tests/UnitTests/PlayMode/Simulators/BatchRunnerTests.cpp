@@ -0,0 +1,261 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Simulators/BatchRunner.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+std::vector<BatchRunner::Matchup> MakeMatchups()
+{
+    DeckInfo mage("Mage", CardClass::MAGE);
+    mage.AddCard(Cards::FindCardByName("Fireball")->id, 2);
+    mage.AddCard(Cards::FindCardByName("Wisp")->id, 2);
+
+    DeckInfo warrior("Warrior", CardClass::WARRIOR);
+    warrior.AddCard(Cards::FindCardByName("Execute")->id, 2);
+    warrior.AddCard(Cards::FindCardByName("Chillwind Yeti")->id, 2);
+
+    return { { mage, warrior }, { warrior, mage } };
+}
+
+void CheckResult(const MatchResult& lhs, const MatchResult& rhs)
+{
+    CHECK_EQ(lhs.numGames, rhs.numGames);
+    CHECK_EQ(lhs.numWins, rhs.numWins);
+    CHECK_EQ(lhs.numLosses, rhs.numLosses);
+    CHECK_EQ(lhs.numTies, rhs.numTies);
+}
+
+void OverwriteByte(const std::string& path, std::streamoff offset)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(offset);
+    const char value = static_cast<char>(file.get() ^ 0xff);
+    file.seekp(offset);
+    file.put(value);
+}
+}  // namespace
+
+TEST_CASE("[SharedCounters] - Add")
+{
+    SharedCounters counters(2, 2, 4);
+    CHECK_EQ(counters.GetJobState(3), JobState::PENDING);
+
+    counters.Add(0, 0, 0, PlayState::WON);
+    counters.Add(1, 0, 1, PlayState::CONCEDED);
+    counters.Add(1, 1, 2, PlayState::TIED);
+    counters.SetJobState(3, JobState::RESUMED);
+
+    CHECK_EQ(counters.GetNumDoneGames(0), 1);
+    CHECK_EQ(counters.GetNumDoneGames(1), 2);
+
+    // Results are summed over all workers
+    const MatchResult result1 = counters.GetResult(0);
+    CHECK_EQ(result1.numGames, 2);
+    CHECK_EQ(result1.numWins, 1);
+    CHECK_EQ(result1.numLosses, 1);
+    CHECK_EQ(result1.numTies, 0);
+
+    const MatchResult result2 = counters.GetResult(1);
+    CHECK_EQ(result2.numGames, 1);
+    CHECK_EQ(result2.numTies, 1);
+
+    CHECK_EQ(counters.GetJobState(0), JobState::WON);
+    CHECK_EQ(counters.GetJobState(1), JobState::LOST);
+    CHECK_EQ(counters.GetJobState(2), JobState::TIED);
+    CHECK_EQ(counters.GetJobState(3), JobState::RESUMED);
+}
+
+TEST_CASE("[BatchRunner] - Run")
+{
+    const auto matchups = MakeMatchups();
+
+    BatchConfig config;
+    config.numGames = 7;
+    config.numThreads = 1;
+    config.seed = 42;
+
+    BatchRunner runner1(matchups, FormatType::STANDARD, config);
+    CHECK(runner1.Run());
+
+    // Each job plays the random stream of its index
+    for (std::size_t i = 0; i < matchups.size(); ++i)
+    {
+        const GamePrototype prototype(MatchSimulator::MakeGameConfig(
+            matchups[i].first, matchups[i].second, FormatType::STANDARD));
+
+        MatchResult expected;
+        for (std::size_t j = 0; j < config.numGames; ++j)
+        {
+            expected.Add(MatchSimulator::PlayGame(prototype, config.seed,
+                                                  i * config.numGames + j));
+        }
+
+        CheckResult(runner1.GetResult(i), expected);
+    }
+
+#if !defined(ROSETTASTONE_WINDOWS)
+    config.numProcesses = 3;
+
+    BatchRunner runner3(matchups, FormatType::STANDARD, config);
+    CHECK(runner3.Run());
+
+    // Shards partition the jobs, so every job is played exactly once
+    const SharedCounters& counters = runner3.GetCounters();
+    CHECK_EQ(counters.GetNumDoneGames(0), 5);
+    CHECK_EQ(counters.GetNumDoneGames(1), 5);
+    CHECK_EQ(counters.GetNumDoneGames(2), 4);
+
+    for (std::size_t job = 0; job < 14; ++job)
+    {
+        CHECK_NE(counters.GetJobState(job), JobState::PENDING);
+        CHECK_NE(counters.GetJobState(job), JobState::RESUMED);
+    }
+
+    // The result doesn't depend on the number of processes
+    for (std::size_t i = 0; i < matchups.size(); ++i)
+    {
+        CheckResult(runner3.GetResult(i), runner1.GetResult(i));
+    }
+#endif
+}
+
+TEST_CASE("[BatchRunner] - Checkpoint")
+{
+    const auto matchups = MakeMatchups();
+    const std::string path = "BatchRunnerTests.ckpt";
+
+    BatchConfig config;
+    config.numGames = 3;
+    config.numThreads = 1;
+    config.seed = 7;
+    config.checkpointPath = path;
+
+    BatchRunner runner1(matchups, FormatType::STANDARD, config);
+    CHECK(runner1.Run());
+
+    BatchRunner runner2(matchups, FormatType::STANDARD, config);
+    CHECK(runner2.Resume());
+
+    // All jobs are loaded from the checkpoint
+    for (std::size_t job = 0; job < 6; ++job)
+    {
+        CHECK_EQ(runner2.GetCounters().GetJobState(job), JobState::RESUMED);
+    }
+
+    for (std::size_t i = 0; i < matchups.size(); ++i)
+    {
+        CheckResult(runner2.GetResult(i), runner1.GetResult(i));
+    }
+
+    // Nothing is left to play
+    CHECK(runner2.Run());
+    CHECK_EQ(runner2.GetCounters().GetNumDoneGames(0), 0);
+
+    for (std::size_t i = 0; i < matchups.size(); ++i)
+    {
+        CheckResult(runner2.GetResult(i), runner1.GetResult(i));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[BatchRunner] - Resume")
+{
+    const auto matchups = MakeMatchups();
+    const std::string path = "BatchRunnerTests3.ckpt";
+
+    BatchConfig config;
+    config.numGames = 5;
+    config.numThreads = 2;
+    config.seed = 11;
+
+    BatchRunner uninterrupted(matchups, FormatType::STANDARD, config);
+    CHECK(uninterrupted.Run());
+
+    // Stops after 4 games
+    config.checkpointPath = path;
+    config.maxGamesPerRun = 4;
+
+    BatchRunner stopped(matchups, FormatType::STANDARD, config);
+    CHECK(stopped.Run());
+    CHECK_EQ(stopped.GetCounters().GetNumDoneGames(0), 4);
+    CHECK_EQ(stopped.GetResult(0).numGames + stopped.GetResult(1).numGames,
+             4);
+
+    // Plays the rest of games from the checkpoint
+    config.maxGamesPerRun = 0;
+
+    BatchRunner resumed(matchups, FormatType::STANDARD, config);
+    CHECK(resumed.Resume());
+    CHECK(resumed.Run());
+    CHECK_EQ(resumed.GetCounters().GetNumDoneGames(0), 6);
+
+    for (std::size_t job = 0; job < 10; ++job)
+    {
+        CHECK_EQ(resumed.GetCounters().GetJobState(job),
+                 job < 4 ? JobState::RESUMED
+                         : uninterrupted.GetCounters().GetJobState(job));
+    }
+
+    for (std::size_t i = 0; i < matchups.size(); ++i)
+    {
+        CheckResult(resumed.GetResult(i), uninterrupted.GetResult(i));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[BatchRunner] - Invalid Checkpoint")
+{
+    const auto matchups = MakeMatchups();
+    const std::string path = "BatchRunnerTests2.ckpt";
+
+    BatchConfig config;
+    config.numGames = 1;
+    config.numThreads = 1;
+    config.checkpointPath = path;
+
+    BatchRunner runner(matchups, FormatType::STANDARD, config);
+    CHECK(runner.Run());
+    CHECK(BatchRunner(matchups, FormatType::STANDARD, config).Resume());
+
+    // Another seed changes the fingerprint
+    BatchConfig otherConfig = config;
+    otherConfig.seed = 1;
+    CHECK_FALSE(
+        BatchRunner(matchups, FormatType::STANDARD, otherConfig).Resume());
+
+    // Other matchups change the fingerprint
+    CHECK_FALSE(BatchRunner({ matchups[1], matchups[0] }, FormatType::STANDARD,
+                            config)
+                    .Resume());
+
+    // Bad magic
+    OverwriteByte(path, 0);
+    CHECK_FALSE(BatchRunner(matchups, FormatType::STANDARD, config).Resume());
+    OverwriteByte(path, 0);
+    CHECK(BatchRunner(matchups, FormatType::STANDARD, config).Resume());
+
+    // Bad fingerprint
+    OverwriteByte(path, 8);
+    CHECK_FALSE(BatchRunner(matchups, FormatType::STANDARD, config).Resume());
+
+    std::remove(path.c_str());
+    CHECK_FALSE(BatchRunner(matchups, FormatType::STANDARD, config).Resume());
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Simulators/DeckOptimizer.hpp>
+#include <Rosetta/PlayMode/Simulators/MatchSimulator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[MatchSimulator] - Run")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+    config.skipMulligan = false;
+
+    ThreadPool pool1(1);
+    ThreadPool pool4(4);
+
+    const MatchResult result1 = MatchSimulator::Run(pool1, config, 8, 42);
+    const MatchResult result4 = MatchSimulator::Run(pool4, config, 8, 42);
+
+    CHECK_EQ(result1.numGames, 8);
+    CHECK_EQ(result1.numWins + result1.numLosses + result1.numTies, 8);
+
+    // The result doesn't depend on the number of threads
+    CHECK_EQ(result1.numWins, result4.numWins);
+    CHECK_EQ(result1.numLosses, result4.numLosses);
+    CHECK_EQ(result1.numTies, result4.numTies);
+}
+
+TEST_CASE("[DeckOptimizer] - Run")
+{
+    DeckInfo opponent("Opponent", CardClass::MAGE);
+    opponent.AddCard(Cards::FindCardByName("Fireball")->id, 2);
+    opponent.AddCard(Cards::FindCardByName("Wisp")->id, 2);
+
+    DeckOptimizerConfig config;
+    config.gauntlet.emplace_back(opponent);
+    config.populationSize = 4;
+    config.numEliteDecks = 2;
+    config.numGenerations = 2;
+    config.numGamesPerOpponent = 2;
+    config.seed = 7;
+
+    ThreadPool pool(2);
+    DeckOptimizer optimizer(pool, config);
+
+    DeckInfo seedDeck("Seed", CardClass::WARRIOR);
+    seedDeck.AddCard(Cards::FindCardByName("Execute")->id, 2);
+
+    const auto decks = optimizer.Run(seedDeck);
+    CHECK_EQ(decks.size(), 4);
+
+    for (std::size_t i = 0; i < decks.size(); ++i)
+    {
+        CHECK(optimizer.IsValidDeck(decks[i].first));
+        CHECK_GE(decks[i].second, 0.0);
+        CHECK_LE(decks[i].second, 1.0);
+
+        if (i > 0)
+        {
+            CHECK_GE(decks[i - 1].second, decks[i].second);
+        }
+    }
+
+    // Elite decks of the first generation are served from the cache
+    CHECK_GE(optimizer.GetNumCacheHits(), 2);
+
+    const std::size_t numEvaluatedDecks = optimizer.GetNumEvaluatedDecks();
+    CHECK_EQ(optimizer.Evaluate(decks[0].first), decks[0].second);
+    CHECK_EQ(optimizer.GetNumEvaluatedDecks(), numEvaluatedDecks);
+
+    CHECK_FALSE(optimizer.IsValidDeck(seedDeck));
+}
+
+TEST_CASE("[DeckOptimizer] - Illegal Seed Deck")
+{
+    DeckInfo opponent("Opponent", CardClass::MAGE);
+    opponent.AddCard(Cards::FindCardByName("Fireball")->id, 2);
+
+    DeckOptimizerConfig config;
+    config.gauntlet.emplace_back(opponent);
+    config.populationSize = 2;
+    config.numEliteDecks = 1;
+    config.numGenerations = 2;
+    config.numGamesPerOpponent = 1;
+    config.seed = 7;
+
+    ThreadPool pool(1);
+    DeckOptimizer optimizer(pool, config);
+
+    // A token and more than 30 cards
+    const std::string boarID = "CS2_boar";
+    DeckInfo seedDeck("Seed", CardClass::WARRIOR);
+    seedDeck.AddCard(boarID, 1);
+    for (const Card* card : Cards::GetStandardCards(CardClass::WARRIOR))
+    {
+        if (seedDeck.GetNumOfCards() > 32)
+        {
+            break;
+        }
+
+        seedDeck.AddCard(card->id, 1);
+        seedDeck.AddCard(card->id, 1);
+    }
+    CHECK_FALSE(optimizer.IsValidDeck(seedDeck));
+
+    const auto decks = optimizer.Run(seedDeck);
+    CHECK_EQ(decks.size(), 2);
+
+    for (const auto& [deck, score] : decks)
+    {
+        CHECK(optimizer.IsValidDeck(deck));
+        const auto cardIDs = deck.GetCardIDs();
+        CHECK_EQ(std::count(cardIDs.begin(), cardIDs.end(), boarID), 0);
+    }
+}
+
+TEST_CASE("[DeckOptimizer] - Empty Gauntlet")
+{
+    ThreadPool pool(1);
+    CHECK_THROWS_AS(DeckOptimizer(pool, DeckOptimizerConfig{}),
+                    std::invalid_argument);
+}
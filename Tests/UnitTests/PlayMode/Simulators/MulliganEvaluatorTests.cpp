@@ -0,0 +1,58 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Simulators/MulliganEvaluator.hpp>
+
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[MulliganEvaluator] - Run")
+{
+    const std::string wisp = Cards::FindCardByName("Wisp")->id;
+    const std::string execute = Cards::FindCardByName("Execute")->id;
+    const std::string fireball = Cards::FindCardByName("Fireball")->id;
+
+    DeckInfo deck("Deck", CardClass::WARRIOR);
+    deck.AddCard(wisp, 2);
+    deck.AddCard(execute, 2);
+
+    DeckInfo opponent("Opponent", CardClass::MAGE);
+    opponent.AddCard(fireball, 2);
+    opponent.AddCard(wisp, 2);
+
+    ThreadPool pool(2);
+    const MulliganEvaluator evaluator(pool, deck, opponent);
+
+    const auto results = evaluator.Run({ wisp, execute, wisp }, true, 2, 42);
+    CHECK_EQ(results.size(), 8);
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        CHECK_EQ(results[i].result.numGames, 2);
+        CHECK_EQ(results[i].keptCardIDs.size() +
+                     results[i].replacedCardIDs.size(),
+                 3);
+
+        if (i > 0)
+        {
+            CHECK_GE(results[i - 1].result.GetWinRate(),
+                     results[i].result.GetWinRate());
+        }
+    }
+
+    // The second player has 4 cards in the opening hand
+    CHECK_THROWS_AS(evaluator.Run({ wisp, execute, wisp }, false, 2, 42),
+                    std::invalid_argument);
+
+    // The deck has only two copies of Wisp
+    CHECK_THROWS_AS(evaluator.Run({ wisp, wisp, wisp }, true, 2, 42),
+                    std::invalid_argument);
+}